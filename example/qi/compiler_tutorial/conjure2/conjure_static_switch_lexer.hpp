@@ -6,11 +6,12 @@
 
 // Auto-generated by boost::lexer, do not edit
 
-#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_JUL_25_2011_07_03_08)
-#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_JUL_25_2011_07_03_08
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_OCT_19_2026_09_02_18)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_OCT_19_2026_09_02_18
 
 #include <boost/detail/iterator.hpp>
 #include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/static_scan.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
 // the generated table of state names and the tokenizer have to be
@@ -35,6 +36,25 @@ std::size_t next_token_conjure_static_switch (std::size_t& /*start_state_*/, boo
     Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
 {
     static std::size_t const npos = static_cast<std::size_t>(~0);
+#if !defined(__GNUC__) || defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)
+    static unsigned char const lookup0_[256] = {
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 1, 1, 35, 35, 1, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        1, 2, 35, 35, 35, 35, 3, 35, 4, 5, 6, 7, 8, 9, 35, 10,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 35, 13, 14, 15, 16, 35,
+        35, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 35, 35, 35, 35, 12,
+        35, 17, 12, 12, 18, 19, 20, 12, 21, 22, 12, 12, 23, 12, 24, 25,
+        12, 12, 26, 27, 28, 29, 30, 31, 12, 12, 12, 32, 33, 34, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35 };
+#endif
 
     if (start_token_ == end_)
     {
@@ -50,79 +70,158 @@ std::size_t next_token_conjure_static_switch (std::size_t& /*start_state_*/, boo
 
     char ch_ = 0;
 
+
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9')) goto state0_1;
-
-    if (ch_ == 't') goto state0_2;
-
-    if (ch_ == 'f') goto state0_3;
-
-    if (ch_ == 'v') goto state0_4;
-
-    if (ch_ == 'i') goto state0_5;
-
-    if (ch_ == 'e') goto state0_6;
-
-    if (ch_ == 'w') goto state0_7;
-
-    if (ch_ == 'r') goto state0_8;
-
-    if (ch_ == '|') goto state0_9;
-
-    if (ch_ == '&') goto state0_10;
-
-    if (ch_ == '=') goto state0_11;
-
-    if (ch_ == '!') goto state0_12;
-
-    if (ch_ == '<') goto state0_13;
-
-    if (ch_ == '>') goto state0_14;
-
-    if (ch_ == '+') goto state0_15;
-
-    if (ch_ == '-') goto state0_16;
-
-    if (ch_ == '*') goto state0_17;
-
-    if (ch_ == '/') goto state0_18;
-
-    if (ch_ == '(') goto state0_19;
-
-    if (ch_ == ')') goto state0_20;
-
-    if (ch_ == '{') goto state0_21;
-
-    if (ch_ == '}') goto state0_22;
-
-    if (ch_ == ',') goto state0_23;
-
-    if (ch_ == ';') goto state0_24;
-
-    if ((ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'g' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'q') || ch_ == 's' || ch_ == 'u' || (ch_ >= 'x' && ch_ <= 'z')) goto state0_25;
-
-    if ((ch_ >= '\t' && ch_ <= '\n') || ch_ == '\r' || ch_ == ' ') goto state0_26;
+#if defined(__GNUC__) && !defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)
+    {
+        static void* const targets_[256] = {
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&state0_26, &&state0_26, &&end,
+            &&end, &&state0_26, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&state0_26, &&state0_12, &&end, &&end,
+            &&end, &&end, &&state0_10, &&end,
+            &&state0_19, &&state0_20, &&state0_17, &&state0_15,
+            &&state0_23, &&state0_16, &&end, &&state0_18,
+            &&state0_1, &&state0_1, &&state0_1, &&state0_1,
+            &&state0_1, &&state0_1, &&state0_1, &&state0_1,
+            &&state0_1, &&state0_1, &&end, &&state0_24,
+            &&state0_13, &&state0_11, &&state0_14, &&end,
+            &&end, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&end,
+            &&end, &&end, &&end, &&state0_25,
+            &&end, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_6, &&state0_3, &&state0_25,
+            &&state0_25, &&state0_5, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_25,
+            &&state0_25, &&state0_25, &&state0_8, &&state0_25,
+            &&state0_2, &&state0_25, &&state0_4, &&state0_7,
+            &&state0_25, &&state0_25, &&state0_25, &&state0_21,
+            &&state0_9, &&state0_22, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end };
+        goto *targets_[static_cast<unsigned char>(ch_)];
+    }
+#else
+    switch (lookup0_[static_cast<unsigned char>(ch_)])
+    {
+    case 11:
+        goto state0_1;
+    case 28:
+        goto state0_2;
+    case 20:
+        goto state0_3;
+    case 30:
+        goto state0_4;
+    case 22:
+        goto state0_5;
+    case 19:
+        goto state0_6;
+    case 31:
+        goto state0_7;
+    case 26:
+        goto state0_8;
+    case 33:
+        goto state0_9;
+    case 3:
+        goto state0_10;
+    case 15:
+        goto state0_11;
+    case 2:
+        goto state0_12;
+    case 14:
+        goto state0_13;
+    case 16:
+        goto state0_14;
+    case 7:
+        goto state0_15;
+    case 9:
+        goto state0_16;
+    case 6:
+        goto state0_17;
+    case 10:
+        goto state0_18;
+    case 4:
+        goto state0_19;
+    case 5:
+        goto state0_20;
+    case 32:
+        goto state0_21;
+    case 34:
+        goto state0_22;
+    case 8:
+        goto state0_23;
+    case 13:
+        goto state0_24;
+    case 12: case 17: case 18: case 21: case 23: case 24: case 25: case 27:
+    case 29:
+        goto state0_25;
+    case 1:
+        goto state0_26;
+    }
     goto end;
+#endif
 
 state0_1:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '0' && next_ <= '9')))
+            break;
+    }
     end_state_ = true;
-    id_ = 35;
+    id_ = 37;
     uid_ = 0;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
-
-    if ((ch_ >= '0' && ch_ <= '9')) goto state0_1;
     goto end;
 
 state0_2:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -131,13 +230,12 @@ state0_2:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'r') goto state0_27;
     goto end;
 
 state0_3:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -146,13 +244,12 @@ state0_3:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'b' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'a') goto state0_28;
     goto end;
 
 state0_4:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -161,13 +258,12 @@ state0_4:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'n') || (ch_ >= 'p' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'o') goto state0_29;
     goto end;
 
 state0_5:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -176,15 +272,13 @@ state0_5:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'e') || (ch_ >= 'g' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'n') goto state0_30;
-
     if (ch_ == 'f') goto state0_31;
     goto end;
 
 state0_6:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -193,13 +287,12 @@ state0_6:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'l') goto state0_32;
     goto end;
 
 state0_7:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -208,13 +301,12 @@ state0_7:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'g') || (ch_ >= 'i' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'h') goto state0_33;
     goto end;
 
 state0_8:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -223,7 +315,6 @@ state0_8:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'e') goto state0_34;
     goto end;
 
@@ -300,6 +391,7 @@ state0_15:
     id_ = 393241;
     uid_ = 16;
     end_token_ = curr_;
+
     goto end;
 
 state0_16:
@@ -307,6 +399,7 @@ state0_16:
     id_ = 393242;
     uid_ = 17;
     end_token_ = curr_;
+
     goto end;
 
 state0_17:
@@ -314,6 +407,7 @@ state0_17:
     id_ = 131099;
     uid_ = 18;
     end_token_ = curr_;
+
     goto end;
 
 state0_18:
@@ -334,6 +428,7 @@ state0_19:
     id_ = 40;
     uid_ = 21;
     end_token_ = curr_;
+
     goto end;
 
 state0_20:
@@ -341,6 +436,7 @@ state0_20:
     id_ = 41;
     uid_ = 22;
     end_token_ = curr_;
+
     goto end;
 
 state0_21:
@@ -348,6 +444,7 @@ state0_21:
     id_ = 123;
     uid_ = 23;
     end_token_ = curr_;
+
     goto end;
 
 state0_22:
@@ -355,6 +452,7 @@ state0_22:
     id_ = 125;
     uid_ = 24;
     end_token_ = curr_;
+
     goto end;
 
 state0_23:
@@ -362,6 +460,7 @@ state0_23:
     id_ = 44;
     uid_ = 25;
     end_token_ = curr_;
+
     goto end;
 
 state0_24:
@@ -369,37 +468,42 @@ state0_24:
     id_ = 59;
     uid_ = 27;
     end_token_ = curr_;
+
     goto end;
 
 state0_25:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '0' && next_ <= '9') || (next_ >= 'A' && next_ <= 'Z') || next_ == '_' || (next_ >= 'a' && next_ <= 'z')))
+            break;
+    }
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
-
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
     goto end;
 
 state0_26:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '\t' && next_ <= '\n') || next_ == '\r' || next_ == ' '))
+            break;
+    }
     end_state_ = true;
-    id_ = 34;
+    id_ = 36;
     uid_ = 30;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
-
-    if ((ch_ >= '\t' && ch_ <= '\n') || ch_ == '\r' || ch_ == ' ') goto state0_26;
     goto end;
 
 state0_27:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -408,13 +512,12 @@ state0_27:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'u') goto state0_42;
     goto end;
 
 state0_28:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -423,13 +526,12 @@ state0_28:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'l') goto state0_43;
     goto end;
 
 state0_29:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -438,13 +540,12 @@ state0_29:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'i') goto state0_44;
     goto end;
 
 state0_30:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -453,7 +554,6 @@ state0_30:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 't') goto state0_45;
     goto end;
 
@@ -472,7 +572,7 @@ state0_31:
 
 state0_32:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -481,13 +581,12 @@ state0_32:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 's') goto state0_46;
     goto end;
 
 state0_33:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -496,13 +595,12 @@ state0_33:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'i') goto state0_47;
     goto end;
 
 state0_34:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -511,7 +609,6 @@ state0_34:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 't') goto state0_48;
     goto end;
 
@@ -520,6 +617,7 @@ state0_35:
     id_ = 131084;
     uid_ = 8;
     end_token_ = curr_;
+
     goto end;
 
 state0_36:
@@ -527,6 +625,7 @@ state0_36:
     id_ = 131085;
     uid_ = 9;
     end_token_ = curr_;
+
     goto end;
 
 state0_37:
@@ -534,6 +633,7 @@ state0_37:
     id_ = 131089;
     uid_ = 10;
     end_token_ = curr_;
+
     goto end;
 
 state0_38:
@@ -541,6 +641,7 @@ state0_38:
     id_ = 131090;
     uid_ = 11;
     end_token_ = curr_;
+
     goto end;
 
 state0_39:
@@ -548,6 +649,7 @@ state0_39:
     id_ = 131092;
     uid_ = 13;
     end_token_ = curr_;
+
     goto end;
 
 state0_40:
@@ -555,21 +657,22 @@ state0_40:
     id_ = 131094;
     uid_ = 15;
     end_token_ = curr_;
+
     goto end;
 
 state0_41:
+    curr_ = static_::scan_to(curr_, end_, '*');
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*') goto state0_41;
-
+    if ((ch_ >= '\0' && ch_ <= ')') || static_cast<unsigned char>(ch_) >= 43) goto state0_41;
     if (ch_ == '*') goto state0_49;
     goto end;
 
 state0_42:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -578,13 +681,12 @@ state0_42:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'e') goto state0_50;
     goto end;
 
 state0_43:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -593,13 +695,12 @@ state0_43:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 's') goto state0_42;
     goto end;
 
 state0_44:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -608,7 +709,6 @@ state0_44:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'c') || (ch_ >= 'e' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'd') goto state0_51;
     goto end;
 
@@ -627,7 +727,7 @@ state0_45:
 
 state0_46:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -636,13 +736,12 @@ state0_46:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'e') goto state0_52;
     goto end;
 
 state0_47:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -651,13 +750,12 @@ state0_47:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'l') goto state0_53;
     goto end;
 
 state0_48:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -666,25 +764,29 @@ state0_48:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'u') goto state0_54;
     goto end;
 
 state0_49:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!(next_ == '*'))
+            break;
+    }
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
     if (ch_ == '*') goto state0_49;
-
-    if (ch_ != '*' && ch_ != '/') goto state0_55;
-
+    if ((ch_ >= '\0' && ch_ <= ')') || (ch_ >= '+' && ch_ <= '.') || static_cast<unsigned char>(ch_) >= 48) goto state0_55;
     if (ch_ == '/') goto state0_56;
     goto end;
 
 state0_50:
     end_state_ = true;
-    id_ = 36;
+    id_ = 38;
     uid_ = 1;
     end_token_ = curr_;
 
@@ -723,7 +825,7 @@ state0_52:
 
 state0_53:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -732,13 +834,12 @@ state0_53:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'e') goto state0_57;
     goto end;
 
 state0_54:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -747,25 +848,25 @@ state0_54:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'r') goto state0_58;
     goto end;
 
 state0_55:
+    curr_ = static_::scan_to(curr_, end_, '*');
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*') goto state0_55;
-
+    if ((ch_ >= '\0' && ch_ <= ')') || static_cast<unsigned char>(ch_) >= 43) goto state0_55;
     if (ch_ == '*') goto state0_59;
     goto end;
 
 state0_56:
     end_state_ = true;
-    id_ = 33;
+    id_ = 35;
     uid_ = 29;
     end_token_ = curr_;
+
     goto end;
 
 state0_57:
@@ -783,7 +884,7 @@ state0_57:
 
 state0_58:
     end_state_ = true;
-    id_ = 32;
+    id_ = 34;
     uid_ = 28;
     end_token_ = curr_;
 
@@ -792,19 +893,23 @@ state0_58:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_25;
-
     if (ch_ == 'n') goto state0_60;
     goto end;
 
 state0_59:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!(next_ == '*'))
+            break;
+    }
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*' && ch_ != '/') goto state0_55;
-
+    if ((ch_ >= '\0' && ch_ <= ')') || (ch_ >= '+' && ch_ <= '.') || static_cast<unsigned char>(ch_) >= 48) goto state0_55;
     if (ch_ == '/') goto state0_56;
-
     if (ch_ == '*') goto state0_59;
     goto end;
 
@@ -819,6 +924,7 @@ state0_60:
     ++curr_;
 
     if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    goto end;
 
 end:
     if (end_state_)
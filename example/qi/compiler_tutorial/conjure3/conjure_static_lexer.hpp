@@ -6,11 +6,12 @@
 
 // Auto-generated by boost::lexer, do not edit
 
-#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_JUL_25_2011_07_25_53)
-#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_JUL_25_2011_07_25_53
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_OCT_19_2026_08_47_40)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_OCT_19_2026_08_47_40
 
 #include <boost/detail/iterator.hpp>
 #include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/static_scan.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
 // the generated table of state names and the tokenizer have to be
@@ -39,366 +40,500 @@ std::size_t next_token_conjure_static (std::size_t& /*start_state_*/, bool& /*bo
 
     static std::size_t const npos = static_cast<std::size_t>(~0);
     static std::size_t const lookup_[256] = {
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 7, 7, 41, 41, 7, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        7, 8, 41, 41, 41, 41, 9, 41,
-        10, 11, 12, 13, 14, 15, 41, 16,
-        17, 17, 17, 17, 17, 17, 17, 17,
-        17, 17, 41, 19, 20, 21, 22, 41,
-        41, 18, 18, 18, 18, 18, 18, 18,
-        18, 18, 18, 18, 18, 18, 18, 18,
-        18, 18, 18, 18, 18, 18, 18, 18,
-        18, 18, 18, 41, 41, 41, 41, 18,
-        41, 23, 18, 18, 24, 25, 26, 18,
-        27, 28, 18, 18, 29, 18, 30, 31,
-        18, 18, 32, 33, 34, 35, 36, 37,
-        18, 18, 18, 38, 39, 40, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41,
-        41, 41, 41, 41, 41, 41, 41, 41 };
-    static std::size_t const dfa_alphabet_ = 42;
-    static std::size_t const dfa_[2604] = {
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 8, 7, 45, 45, 7, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        8, 9, 45, 45, 45, 10, 11, 45,
+        12, 13, 14, 15, 16, 17, 45, 18,
+        19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 45, 21, 22, 23, 24, 45,
+        45, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 45, 45, 45, 25, 20,
+        45, 26, 20, 20, 27, 28, 29, 20,
+        30, 31, 20, 20, 32, 20, 33, 34,
+        20, 20, 35, 36, 37, 38, 39, 40,
+        20, 20, 20, 41, 42, 43, 44, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45 };
+    static std::size_t const dfa_alphabet_ = 46;
+    static std::size_t const dfa_[3680] = {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 30, 30, 21,
+        15, 16, 23, 24, 13, 11, 27, 12,
+        14, 2, 29, 28, 19, 10, 20, 17,
+        29, 29, 7, 4, 29, 6, 29, 29,
+        29, 9, 29, 3, 29, 5, 8, 25,
+        18, 26, 22, 0, 1, 37, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 2,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 34, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 31, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 32, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        33, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 34, 47, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 29, 29,
+        29, 35, 29, 29, 29, 34, 29, 29,
+        29, 29, 29, 29, 29, 0, 0, 0,
+        0, 0, 1, 34, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 36, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 37, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 38, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 1048577, 8, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 39, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 393241, 32, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 41, 0, 0, 0, 0, 0, 0,
+        0, 40, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        1, 393242, 33, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 43, 0, 0, 0, 0, 0, 42,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 131099,
+        34, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 27, 13, 11, 20, 21, 18, 16,
-        24, 17, 19, 2, 26, 25, 14, 12,
-        15, 26, 26, 7, 4, 26, 6, 26,
-        26, 26, 9, 26, 3, 26, 5, 8,
-        22, 10, 23, 0, 1, 35, 0, 0,
+        0, 0, 0, 0, 0, 44, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 2, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 131100, 35, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 28, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        1, 32, 28, 0, 0, 0, 0, 0,
+        0, 0, 46, 0, 0, 0, 47, 0,
+        0, 0, 0, 45, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 29,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 26,
-        26, 30, 26, 26, 26, 26, 26, 26,
-        0, 0, 0, 0, 1, 32, 28, 0,
+        0, 0, 1, 131101, 36, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 32, 26,
-        26, 26, 31, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 33, 26, 26, 26, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        1, 32, 28, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 34, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
+        0, 48, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 35, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
         0, 0, 0, 0, 0, 0, 0, 0,
+        1, 131088, 23, 0, 0, 0, 0, 0,
+        0, 0, 0, 50, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 49,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 131087,
+        22, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 51, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 36, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 37,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 131086, 21, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 52, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 61, 26, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 53, 0,
+        0, 0, 1, 131091, 28, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 38, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        54, 55, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 262177, 20, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 39,
+        1, 131093, 30, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 57,
+        56, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 131091, 12, 0,
+        0, 0, 0, 0, 0, 0, 1, 262177,
+        40, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 58, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 40, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 1, 131093,
-        14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 262176, 39, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 41, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 393241, 16, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 40, 41, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 393242, 17, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        1, 41, 42, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 131099, 18, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 123,
+        43, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 125, 44, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 44, 45, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 59, 46, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 36, 49, 0,
+        0, 0, 0, 30, 30, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 34, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        59, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 29, 29,
+        60, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 61, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 34, 47, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 62, 29, 29, 29, 0, 0, 0,
+        0, 0, 1, 65538, 4, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 63, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 64, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 34, 47, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 65, 29, 29, 29, 0, 0, 0,
+        0, 0, 1, 131089, 26, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1048578, 9, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 1, 131100,
-        19, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 42, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 40, 21, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 786462,
+        37, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 41, 22, 0, 0, 0,
+        0, 0, 0, 0, 1, 1048579, 10, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 123, 23, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 786463, 38, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 1, 125,
-        24, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1048580, 11, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 44, 25, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1048581,
+        12, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 59, 27, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 46, 46, 46, 46, 46,
+        46, 46, 66, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 1, 35, 48, 0, 0, 0,
+        0, 0, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47,
+        47, 47, 47, 47, 47, 47, 47, 47,
+        1, 1048582, 13, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 32, 28, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 34,
-        30, 0, 0, 0, 0, 27, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1048583,
+        14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 131085, 20, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 1048584, 15, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 32, 28, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 43, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 44,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        0, 0, 0, 0, 1, 32, 28, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 26, 26,
-        45, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        46, 26, 26, 26, 0, 0, 0, 0,
-        1, 65538, 4, 0, 0, 0, 0, 0,
+        1, 1048585, 16, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 47, 26, 26, 26, 26,
-        0, 0, 0, 0, 1, 32, 28, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 26, 26,
-        48, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        49, 26, 26, 26, 0, 0, 0, 0,
-        1, 131084, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 131084,
+        19, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 131095, 24, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 131085, 9, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 67, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 131092, 29, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 131089, 10, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 1, 131090,
-        11, 0, 0, 0, 0, 0, 0, 0,
+        1, 131096, 25, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 68,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 131094,
+        31, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        1, 131092, 13, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 131090, 27, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 1, 131094, 15, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1, 34, 47, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 42, 42, 42, 42, 42,
-        50, 42, 42, 42, 42, 42, 42, 42,
-        42, 42, 42, 42, 42, 42, 42, 42,
-        42, 42, 42, 42, 42, 42, 42, 42,
-        42, 42, 42, 42, 42, 42, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 51,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        1, 32, 28, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 69, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 43, 26, 26, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 59, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 52, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 70, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
         0, 0, 0, 0, 1, 65537, 3, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 53,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        1, 32, 28, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 26, 26, 54, 26, 26,
-        26, 26, 26, 26, 26, 26, 0, 0,
-        0, 0, 1, 32, 28, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 55, 26, 26,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 56, 56, 56, 56, 56,
-        50, 56, 56, 56, 57, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 1, 36,
+        0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 0, 0, 0,
+        0, 0, 1, 34, 47, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 71, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 29, 29,
+        72, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 73, 29, 29, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 74, 74, 74, 74, 74,
+        74, 74, 66, 74, 74, 74, 75, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 1, 1048586, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1048587, 18, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 38,
         1, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        1, 65536, 2, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 26, 26, 0, 0, 0, 0, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 1, 65536, 2, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 29,
+        29, 0, 0, 0, 0, 0, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 0, 0, 0,
         0, 0, 1, 65539, 5, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        0, 0, 0, 0, 1, 32, 28, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 58, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 59, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 56,
-        56, 56, 56, 56, 60, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 1, 33, 29, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 1, 65540, 6, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 26, 26, 0,
-        0, 0, 0, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 0, 0, 0, 0, 1, 32,
-        28, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 26,
-        26, 0, 0, 0, 0, 26, 26, 26,
-        26, 26, 26, 26, 61, 26, 26, 26,
-        26, 26, 26, 26, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 56,
-        56, 56, 56, 56, 60, 56, 56, 56,
-        57, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 56, 56, 56, 56, 56, 56,
-        56, 56, 1, 65541, 7, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 26, 26, 0, 0, 0,
-        0, 26, 26, 26, 26, 26, 26, 26,
-        26, 26, 26, 26, 26, 26, 26, 26,
-        0, 0, 0, 0 };
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0,
+        1, 34, 47, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 76, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 77, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 74, 74, 74, 74, 74,
+        74, 74, 78, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 1, 35, 48, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65540, 6, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 29, 29, 0, 0, 0,
+        0, 0, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 0, 0, 0, 0, 0, 1, 34,
+        47, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 29, 29, 0, 0, 0, 0, 0,
+        29, 29, 29, 29, 29, 29, 29, 79,
+        29, 29, 29, 29, 29, 29, 29, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 74, 74, 74, 74, 74,
+        74, 74, 78, 74, 74, 74, 75, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 1, 65541, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 29, 29, 0,
+        0, 0, 0, 0, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 0, 0, 0, 0, 0 };
 
     if (start_token_ == end_)
     {
@@ -6,11 +6,12 @@
 
 // Auto-generated by boost::lexer, do not edit
 
-#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_JUL_25_2011_07_25_53)
-#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_JUL_25_2011_07_25_53
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_OCT_19_2026_09_02_26)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_CONJURE_STATIC_SWITCH_OCT_19_2026_09_02_26
 
 #include <boost/detail/iterator.hpp>
 #include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/static_scan.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
 // the generated table of state names and the tokenizer have to be
@@ -35,6 +36,25 @@ std::size_t next_token_conjure_static_switch (std::size_t& /*start_state_*/, boo
     Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
 {
     static std::size_t const npos = static_cast<std::size_t>(~0);
+#if !defined(__GNUC__) || defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)
+    static unsigned char const lookup0_[256] = {
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 2, 1, 39, 39, 1, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        2, 3, 39, 39, 39, 4, 5, 39, 6, 7, 8, 9, 10, 11, 39, 12,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 39, 15, 16, 17, 18, 39,
+        39, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 39, 39, 39, 19, 14,
+        39, 20, 14, 14, 21, 22, 23, 14, 24, 25, 14, 14, 26, 14, 27, 28,
+        14, 14, 29, 30, 31, 32, 33, 34, 14, 14, 14, 35, 36, 37, 38, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+        39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39 };
+#endif
 
     if (start_token_ == end_)
     {
@@ -50,414 +70,567 @@ std::size_t next_token_conjure_static_switch (std::size_t& /*start_state_*/, boo
 
     char ch_ = 0;
 
+
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9')) goto state0_1;
-
-    if (ch_ == 't') goto state0_2;
-
-    if (ch_ == 'f') goto state0_3;
-
-    if (ch_ == 'v') goto state0_4;
-
-    if (ch_ == 'i') goto state0_5;
-
-    if (ch_ == 'e') goto state0_6;
-
-    if (ch_ == 'w') goto state0_7;
-
-    if (ch_ == 'r') goto state0_8;
-
-    if (ch_ == '|') goto state0_9;
-
-    if (ch_ == '&') goto state0_10;
-
-    if (ch_ == '=') goto state0_11;
-
-    if (ch_ == '!') goto state0_12;
-
-    if (ch_ == '<') goto state0_13;
-
-    if (ch_ == '>') goto state0_14;
-
-    if (ch_ == '+') goto state0_15;
-
-    if (ch_ == '-') goto state0_16;
-
-    if (ch_ == '*') goto state0_17;
-
-    if (ch_ == '/') goto state0_18;
-
-    if (ch_ == '(') goto state0_19;
-
-    if (ch_ == ')') goto state0_20;
-
-    if (ch_ == '{') goto state0_21;
-
-    if (ch_ == '}') goto state0_22;
-
-    if (ch_ == ',') goto state0_23;
-
-    if (ch_ == ';') goto state0_24;
-
-    if ((ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'g' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'q') || ch_ == 's' || ch_ == 'u' || (ch_ >= 'x' && ch_ <= 'z')) goto state0_25;
-
-    if ((ch_ >= '\t' && ch_ <= '\n') || ch_ == '\r' || ch_ == ' ') goto state0_26;
+#if defined(__GNUC__) && !defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)
+    {
+        static void* const targets_[256] = {
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&state0_29, &&state0_29, &&end,
+            &&end, &&state0_29, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&state0_29, &&state0_20, &&end, &&end,
+            &&end, &&state0_14, &&state0_15, &&end,
+            &&state0_22, &&state0_23, &&state0_12, &&state0_10,
+            &&state0_26, &&state0_11, &&end, &&state0_13,
+            &&state0_1, &&state0_1, &&state0_1, &&state0_1,
+            &&state0_1, &&state0_1, &&state0_1, &&state0_1,
+            &&state0_1, &&state0_1, &&end, &&state0_27,
+            &&state0_18, &&state0_9, &&state0_19, &&end,
+            &&end, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&end,
+            &&end, &&end, &&state0_16, &&state0_28,
+            &&end, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_6, &&state0_3, &&state0_28,
+            &&state0_28, &&state0_5, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_28,
+            &&state0_28, &&state0_28, &&state0_8, &&state0_28,
+            &&state0_2, &&state0_28, &&state0_4, &&state0_7,
+            &&state0_28, &&state0_28, &&state0_28, &&state0_24,
+            &&state0_17, &&state0_25, &&state0_21, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end,
+            &&end, &&end, &&end, &&end };
+        goto *targets_[static_cast<unsigned char>(ch_)];
+    }
+#else
+    switch (lookup0_[static_cast<unsigned char>(ch_)])
+    {
+    case 13:
+        goto state0_1;
+    case 31:
+        goto state0_2;
+    case 23:
+        goto state0_3;
+    case 33:
+        goto state0_4;
+    case 25:
+        goto state0_5;
+    case 22:
+        goto state0_6;
+    case 34:
+        goto state0_7;
+    case 29:
+        goto state0_8;
+    case 17:
+        goto state0_9;
+    case 9:
+        goto state0_10;
+    case 11:
+        goto state0_11;
+    case 8:
+        goto state0_12;
+    case 12:
+        goto state0_13;
+    case 4:
+        goto state0_14;
+    case 5:
+        goto state0_15;
+    case 19:
+        goto state0_16;
+    case 36:
+        goto state0_17;
+    case 16:
+        goto state0_18;
+    case 18:
+        goto state0_19;
+    case 3:
+        goto state0_20;
+    case 38:
+        goto state0_21;
+    case 6:
+        goto state0_22;
+    case 7:
+        goto state0_23;
+    case 35:
+        goto state0_24;
+    case 37:
+        goto state0_25;
+    case 10:
+        goto state0_26;
+    case 15:
+        goto state0_27;
+    case 14: case 20: case 21: case 24: case 26: case 27: case 28: case 30:
+    case 32:
+        goto state0_28;
+    case 1: case 2:
+        goto state0_29;
+    }
     goto end;
+#endif
 
 state0_1:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '0' && next_ <= '9')))
+            break;
+    }
     end_state_ = true;
-    id_ = 35;
+    id_ = 37;
     uid_ = 0;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
-
-    if ((ch_ >= '0' && ch_ <= '9')) goto state0_1;
     goto end;
 
 state0_2:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'r') goto state0_27;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'r') goto state0_30;
     goto end;
 
 state0_3:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'b' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'a') goto state0_28;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'b' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'a') goto state0_31;
     goto end;
 
 state0_4:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'n') || (ch_ >= 'p' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'o') goto state0_29;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'n') || (ch_ >= 'p' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'o') goto state0_32;
     goto end;
 
 state0_5:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'e') || (ch_ >= 'g' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'n') goto state0_30;
-
-    if (ch_ == 'f') goto state0_31;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'e') || (ch_ >= 'g' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'n') goto state0_33;
+    if (ch_ == 'f') goto state0_34;
     goto end;
 
 state0_6:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'l') goto state0_32;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'l') goto state0_35;
     goto end;
 
 state0_7:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'g') || (ch_ >= 'i' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'h') goto state0_33;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'g') || (ch_ >= 'i' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'h') goto state0_36;
     goto end;
 
 state0_8:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'e') goto state0_34;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'e') goto state0_37;
     goto end;
 
 state0_9:
+    end_state_ = true;
+    id_ = 1048577;
+    uid_ = 8;
+    end_token_ = curr_;
+
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '|') goto state0_35;
+    if (ch_ == '=') goto state0_38;
     goto end;
 
 state0_10:
+    end_state_ = true;
+    id_ = 393241;
+    uid_ = 32;
+    end_token_ = curr_;
+
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '&') goto state0_36;
+    if (ch_ == '=') goto state0_39;
+    if (ch_ == '+') goto state0_40;
     goto end;
 
 state0_11:
     end_state_ = true;
-    id_ = 61;
-    uid_ = 26;
+    id_ = 393242;
+    uid_ = 33;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '=') goto state0_37;
+    if (ch_ == '=') goto state0_41;
+    if (ch_ == '-') goto state0_42;
     goto end;
 
 state0_12:
     end_state_ = true;
-    id_ = 262177;
-    uid_ = 20;
+    id_ = 131099;
+    uid_ = 34;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '=') goto state0_38;
+    if (ch_ == '=') goto state0_43;
     goto end;
 
 state0_13:
     end_state_ = true;
-    id_ = 131091;
-    uid_ = 12;
+    id_ = 131100;
+    uid_ = 35;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '=') goto state0_39;
+    if (ch_ == '=') goto state0_44;
+    if (ch_ == '*') goto state0_45;
+    if (ch_ == '/') goto state0_46;
     goto end;
 
 state0_14:
     end_state_ = true;
-    id_ = 131093;
-    uid_ = 14;
+    id_ = 131101;
+    uid_ = 36;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '=') goto state0_40;
+    if (ch_ == '=') goto state0_47;
     goto end;
 
 state0_15:
     end_state_ = true;
-    id_ = 393241;
-    uid_ = 16;
+    id_ = 131088;
+    uid_ = 23;
     end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if (ch_ == '=') goto state0_48;
+    if (ch_ == '&') goto state0_49;
     goto end;
 
 state0_16:
     end_state_ = true;
-    id_ = 393242;
-    uid_ = 17;
+    id_ = 131087;
+    uid_ = 22;
     end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if (ch_ == '=') goto state0_50;
     goto end;
 
 state0_17:
     end_state_ = true;
-    id_ = 131099;
-    uid_ = 18;
+    id_ = 131086;
+    uid_ = 21;
     end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if (ch_ == '=') goto state0_51;
+    if (ch_ == '|') goto state0_52;
     goto end;
 
 state0_18:
     end_state_ = true;
-    id_ = 131100;
-    uid_ = 19;
+    id_ = 131091;
+    uid_ = 28;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '*') goto state0_41;
+    if (ch_ == '<') goto state0_53;
+    if (ch_ == '=') goto state0_54;
     goto end;
 
 state0_19:
     end_state_ = true;
-    id_ = 40;
-    uid_ = 21;
+    id_ = 131093;
+    uid_ = 30;
     end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if (ch_ == '>') goto state0_55;
+    if (ch_ == '=') goto state0_56;
     goto end;
 
 state0_20:
     end_state_ = true;
-    id_ = 41;
-    uid_ = 22;
+    id_ = 262177;
+    uid_ = 40;
     end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if (ch_ == '=') goto state0_57;
     goto end;
 
 state0_21:
     end_state_ = true;
-    id_ = 123;
-    uid_ = 23;
+    id_ = 262176;
+    uid_ = 39;
     end_token_ = curr_;
+
     goto end;
 
 state0_22:
     end_state_ = true;
-    id_ = 125;
-    uid_ = 24;
+    id_ = 40;
+    uid_ = 41;
     end_token_ = curr_;
+
     goto end;
 
 state0_23:
     end_state_ = true;
-    id_ = 44;
-    uid_ = 25;
+    id_ = 41;
+    uid_ = 42;
     end_token_ = curr_;
+
     goto end;
 
 state0_24:
     end_state_ = true;
-    id_ = 59;
-    uid_ = 27;
+    id_ = 123;
+    uid_ = 43;
     end_token_ = curr_;
+
     goto end;
 
 state0_25:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 125;
+    uid_ = 44;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
-
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
     goto end;
 
 state0_26:
+    end_state_ = true;
+    id_ = 44;
+    uid_ = 45;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_27:
+    end_state_ = true;
+    id_ = 59;
+    uid_ = 46;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_28:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '0' && next_ <= '9') || (next_ >= 'A' && next_ <= 'Z') || next_ == '_' || (next_ >= 'a' && next_ <= 'z')))
+            break;
+    }
     end_state_ = true;
     id_ = 34;
-    uid_ = 30;
+    uid_ = 47;
     end_token_ = curr_;
 
-    if (curr_ == end_) goto end;
-    ch_ = *curr_;
-    ++curr_;
+    goto end;
+
+state0_29:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '\t' && next_ <= '\n') || next_ == '\r' || next_ == ' '))
+            break;
+    }
+    end_state_ = true;
+    id_ = 36;
+    uid_ = 49;
+    end_token_ = curr_;
 
-    if ((ch_ >= '\t' && ch_ <= '\n') || ch_ == '\r' || ch_ == ' ') goto state0_26;
     goto end;
 
-state0_27:
+state0_30:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'u') goto state0_42;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'u') goto state0_58;
     goto end;
 
-state0_28:
+state0_31:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'l') goto state0_43;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'l') goto state0_59;
     goto end;
 
-state0_29:
+state0_32:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'i') goto state0_44;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'i') goto state0_60;
     goto end;
 
-state0_30:
+state0_33:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 't') goto state0_45;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 't') goto state0_61;
     goto end;
 
-state0_31:
+state0_34:
     end_state_ = true;
     id_ = 65538;
     uid_ = 4;
@@ -467,152 +640,273 @@ state0_31:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_32:
+state0_35:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 's') goto state0_46;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 's') goto state0_62;
     goto end;
 
-state0_33:
+state0_36:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'i') goto state0_47;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'h') || (ch_ >= 'j' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'i') goto state0_63;
     goto end;
 
-state0_34:
+state0_37:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 't') goto state0_48;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 's') || (ch_ >= 'u' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 't') goto state0_64;
     goto end;
 
-state0_35:
+state0_38:
     end_state_ = true;
-    id_ = 131084;
-    uid_ = 8;
+    id_ = 131089;
+    uid_ = 26;
     end_token_ = curr_;
+
     goto end;
 
-state0_36:
+state0_39:
     end_state_ = true;
-    id_ = 131085;
+    id_ = 1048578;
     uid_ = 9;
     end_token_ = curr_;
+
     goto end;
 
-state0_37:
+state0_40:
     end_state_ = true;
-    id_ = 131089;
+    id_ = 786462;
+    uid_ = 37;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_41:
+    end_state_ = true;
+    id_ = 1048579;
     uid_ = 10;
     end_token_ = curr_;
+
     goto end;
 
-state0_38:
+state0_42:
     end_state_ = true;
-    id_ = 131090;
+    id_ = 786463;
+    uid_ = 38;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_43:
+    end_state_ = true;
+    id_ = 1048580;
     uid_ = 11;
     end_token_ = curr_;
+
     goto end;
 
-state0_39:
+state0_44:
     end_state_ = true;
-    id_ = 131092;
+    id_ = 1048581;
+    uid_ = 12;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_45:
+    curr_ = static_::scan_to(curr_, end_, '*');
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    if ((ch_ >= '\0' && ch_ <= ')') || static_cast<unsigned char>(ch_) >= 43) goto state0_45;
+    if (ch_ == '*') goto state0_65;
+    goto end;
+
+state0_46:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!((next_ >= '\0' && next_ <= '\t') || (next_ >= '\v' && next_ <= '\f') || static_cast<unsigned char>(next_) >= 14))
+            break;
+    }
+    end_state_ = true;
+    id_ = 35;
+    uid_ = 48;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_47:
+    end_state_ = true;
+    id_ = 1048582;
     uid_ = 13;
     end_token_ = curr_;
+
     goto end;
 
-state0_40:
+state0_48:
     end_state_ = true;
-    id_ = 131094;
+    id_ = 1048583;
+    uid_ = 14;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_49:
+    end_state_ = true;
+    id_ = 131085;
+    uid_ = 20;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_50:
+    end_state_ = true;
+    id_ = 1048584;
     uid_ = 15;
     end_token_ = curr_;
+
     goto end;
 
-state0_41:
+state0_51:
+    end_state_ = true;
+    id_ = 1048585;
+    uid_ = 16;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_52:
+    end_state_ = true;
+    id_ = 131084;
+    uid_ = 19;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_53:
+    end_state_ = true;
+    id_ = 131095;
+    uid_ = 24;
+    end_token_ = curr_;
+
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*') goto state0_41;
+    if (ch_ == '=') goto state0_66;
+    goto end;
+
+state0_54:
+    end_state_ = true;
+    id_ = 131092;
+    uid_ = 29;
+    end_token_ = curr_;
 
-    if (ch_ == '*') goto state0_49;
     goto end;
 
-state0_42:
+state0_55:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 131096;
+    uid_ = 25;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
+    if (ch_ == '=') goto state0_67;
+    goto end;
+
+state0_56:
+    end_state_ = true;
+    id_ = 131094;
+    uid_ = 31;
+    end_token_ = curr_;
 
-    if (ch_ == 'e') goto state0_50;
     goto end;
 
-state0_43:
+state0_57:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 131090;
+    uid_ = 27;
+    end_token_ = curr_;
+
+    goto end;
+
+state0_58:
+    end_state_ = true;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 's') goto state0_42;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'e') goto state0_68;
     goto end;
 
-state0_44:
+state0_59:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'c') || (ch_ >= 'e' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'r') || (ch_ >= 't' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 's') goto state0_58;
+    goto end;
+
+state0_60:
+    end_state_ = true;
+    id_ = 34;
+    uid_ = 47;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
 
-    if (ch_ == 'd') goto state0_51;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'c') || (ch_ >= 'e' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'd') goto state0_69;
     goto end;
 
-state0_45:
+state0_61:
     end_state_ = true;
     id_ = 65537;
     uid_ = 3;
@@ -622,69 +916,87 @@ state0_45:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_46:
+state0_62:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'e') goto state0_52;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'e') goto state0_70;
     goto end;
 
-state0_47:
+state0_63:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'l') goto state0_53;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'k') || (ch_ >= 'm' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'l') goto state0_71;
     goto end;
 
-state0_48:
+state0_64:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'u') goto state0_54;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 't') || (ch_ >= 'v' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'u') goto state0_72;
     goto end;
 
-state0_49:
+state0_65:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!(next_ == '*'))
+            break;
+    }
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ == '*') goto state0_49;
+    if (ch_ == '*') goto state0_65;
+    if ((ch_ >= '\0' && ch_ <= ')') || (ch_ >= '+' && ch_ <= '.') || static_cast<unsigned char>(ch_) >= 48) goto state0_73;
+    if (ch_ == '/') goto state0_74;
+    goto end;
+
+state0_66:
+    end_state_ = true;
+    id_ = 1048586;
+    uid_ = 17;
+    end_token_ = curr_;
 
-    if (ch_ != '*' && ch_ != '/') goto state0_55;
+    goto end;
+
+state0_67:
+    end_state_ = true;
+    id_ = 1048587;
+    uid_ = 18;
+    end_token_ = curr_;
 
-    if (ch_ == '/') goto state0_56;
     goto end;
 
-state0_50:
+state0_68:
     end_state_ = true;
-    id_ = 36;
+    id_ = 38;
     uid_ = 1;
     end_token_ = curr_;
 
@@ -692,10 +1004,10 @@ state0_50:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_51:
+state0_69:
     end_state_ = true;
     id_ = 65536;
     uid_ = 2;
@@ -705,10 +1017,10 @@ state0_51:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_52:
+state0_70:
     end_state_ = true;
     id_ = 65539;
     uid_ = 5;
@@ -718,57 +1030,56 @@ state0_52:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_53:
+state0_71:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'e') goto state0_57;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'd') || (ch_ >= 'f' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'e') goto state0_75;
     goto end;
 
-state0_54:
+state0_72:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'r') goto state0_58;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'q') || (ch_ >= 's' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'r') goto state0_76;
     goto end;
 
-state0_55:
+state0_73:
+    curr_ = static_::scan_to(curr_, end_, '*');
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*') goto state0_55;
-
-    if (ch_ == '*') goto state0_59;
+    if ((ch_ >= '\0' && ch_ <= ')') || static_cast<unsigned char>(ch_) >= 43) goto state0_73;
+    if (ch_ == '*') goto state0_77;
     goto end;
 
-state0_56:
+state0_74:
     end_state_ = true;
-    id_ = 33;
-    uid_ = 29;
+    id_ = 35;
+    uid_ = 48;
     end_token_ = curr_;
+
     goto end;
 
-state0_57:
+state0_75:
     end_state_ = true;
     id_ = 65540;
     uid_ = 6;
@@ -778,37 +1089,41 @@ state0_57:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
     goto end;
 
-state0_58:
+state0_76:
     end_state_ = true;
-    id_ = 32;
-    uid_ = 28;
+    id_ = 34;
+    uid_ = 47;
     end_token_ = curr_;
 
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_25;
-
-    if (ch_ == 'n') goto state0_60;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'm') || (ch_ >= 'o' && ch_ <= 'z')) goto state0_28;
+    if (ch_ == 'n') goto state0_78;
     goto end;
 
-state0_59:
+state0_77:
+    for (/**/; curr_ != end_; ++curr_)
+    {
+        char const next_ = *curr_;
+
+        if (!(next_ == '*'))
+            break;
+    }
     if (curr_ == end_) goto end;
     ch_ = *curr_;
     ++curr_;
 
-    if (ch_ != '*' && ch_ != '/') goto state0_55;
-
-    if (ch_ == '/') goto state0_56;
-
-    if (ch_ == '*') goto state0_59;
+    if ((ch_ >= '\0' && ch_ <= ')') || (ch_ >= '+' && ch_ <= '.') || static_cast<unsigned char>(ch_) >= 48) goto state0_73;
+    if (ch_ == '/') goto state0_74;
+    if (ch_ == '*') goto state0_77;
     goto end;
 
-state0_60:
+state0_78:
     end_state_ = true;
     id_ = 65541;
     uid_ = 7;
@@ -818,7 +1133,8 @@ state0_60:
     ch_ = *curr_;
     ++curr_;
 
-    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_25;
+    if ((ch_ >= '0' && ch_ <= '9') || (ch_ >= 'A' && ch_ <= 'Z') || ch_ == '_' || (ch_ >= 'a' && ch_ <= 'z')) goto state0_28;
+    goto end;
 
 end:
     if (end_state_)
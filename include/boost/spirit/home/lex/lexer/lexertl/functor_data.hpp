@@ -15,6 +15,7 @@
 #include <boost/spirit/home/support/detail/lexer/rules.hpp>
 #include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/semantic_action_data.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/wrap_action.hpp>
 #include <boost/mpl/bool.hpp>
@@ -58,7 +59,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
               : first_(first), last_(last)
               , state_machine_(data_.state_machine_)
               , rules_(data_.rules_)
-              , bol_(data_.state_machine_.data()._seen_BOL_assertion) {}
+              , bol_(data_.state_machine_.seen_bol_assertion()) {}
 
             // The following functions are used by the implementation of the 
             // placeholder '_state'.
@@ -187,7 +188,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             Iterator& first_;
             Iterator last_;
 
-            boost::lexer::basic_state_machine<char_type> const& state_machine_;
+            packed_state_machine<char_type> const& state_machine_;
             boost::lexer::basic_rules<char_type> const& rules_;
 
             bool bol_;      // helper storing whether last character was \n
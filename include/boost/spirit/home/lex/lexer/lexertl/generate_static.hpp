@@ -22,6 +22,11 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/scoped_array.hpp>
 
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace boost { namespace spirit { namespace lex { namespace lexertl
 {
@@ -413,9 +418,9 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             }
             else
             {
-                os_ << "            std::size_t index = *curr_++\n";
+                os_ << "            std::size_t index = *curr_++;\n";
             }
-            os_ << "            bol = (index == '\n') ? true : false;\n";
+            os_ << "            bol = (index == '\\n') ? true : false;\n";
             os_ << "            std::size_t const state_ = ptr_[\n";
             os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
 
@@ -440,9 +445,9 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             }
             else
             {
-                os_ << "            std::size_t index = *curr_++\n";
+                os_ << "            std::size_t index = *curr_++;\n";
             }
-            os_ << "            bol = (index == '\n') ? true : false;\n";
+            os_ << "            bol = (index == '\\n') ? true : false;\n";
             os_ << "            std::size_t const state_ = ptr_[\n";
             os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
 
@@ -467,9 +472,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             }
             else
             {
-                os_ << "            std::size_t index = *curr_++\n";
+                os_ << "            std::size_t index = *curr_++;\n";
             }
-            os_ << "            bol = (index == '\n') ? true : false;\n";
             os_ << "            std::size_t const state_ = ptr_[\n";
             os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
 
@@ -577,7 +581,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
         if (sm_.data()._seen_BOL_assertion)
         {
-            os_ << "        bol_ = (*start_token_ == '\n') ? true : false;\n";
+            os_ << "        bol_ = (*start_token_ == '\\n') ? true : false;\n";
         }
 
         os_ << "        id_ = npos;\n";
@@ -629,8 +633,11 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // generate function body testing the character sets of the transitions
+    // of every state, this is used for wide character lexers (see
+    // generate_function_body_switch below)
     template <typename Char>
-    bool generate_function_body_switch(std::basic_ostream<Char> & os_
+    bool generate_function_body_switch_charsets(std::basic_ostream<Char> & os_
       , boost::lexer::basic_state_machine<Char> const &sm_)
     {
         typedef typename boost::lexer::basic_state_machine<Char>::iterator
@@ -749,7 +756,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                     }
                     if (iter_->eol_index != boost::lexer::npos)
                     {
-                        os_ << "\n    if (ch_ == '\n') goto state" << dfa_
+                        os_ << "\n    if (ch_ == '\\n') goto state" << dfa_
                             << '_' << iter_->eol_index << ";\n";
                     }
                     os_ << "    ++curr_;\n";
@@ -872,6 +879,569 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         return os_.good();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // emit 'goto <state>;' for the given row of the DFA (row 0 is the dead
+    // state, the labels of the states are counted from the start row 1)
+    template <typename Char>
+    inline void generate_goto(std::basic_ostream<Char> &os_, std::size_t dfa_
+      , std::size_t row_)
+    {
+        if (row_ == 0)
+            os_ << "goto end;\n";
+        else
+            os_ << "goto state" << dfa_ << '_' << row_ - 1 << ";\n";
+    }
+
+    // emit the case labels for the given character classes, 8 per line
+    template <typename Char>
+    inline void generate_cases(std::basic_ostream<Char> &os_
+      , std::vector<std::size_t> const& classes_, char const* indent_)
+    {
+        for (std::size_t i_ = 0; i_ < classes_.size (); ++i_)
+        {
+            if (i_ != 0 && i_ % 8 == 0)
+                os_ << '\n' << indent_;
+            else if (i_ != 0)
+                os_ << ' ';
+            os_ << "case " << classes_[i_] << ':';
+        }
+        os_ << '\n';
+    }
+
+    // the ranges of the (unsigned) characters leading from the given row of
+    // a DFA to the state 'next_'
+    typedef std::vector<std::pair<std::size_t, std::size_t> > char_ranges;
+
+    inline char_ranges get_ranges(std::size_t const* row_
+      , std::size_t const* lookup_, std::size_t next_)
+    {
+        char_ranges ranges_;
+        for (std::size_t i_ = 0; i_ < 256; ++i_)
+        {
+            if (row_[lookup_[i_]] != next_)
+                continue;
+
+            if (!ranges_.empty () && ranges_.back ().second + 1 == i_)
+                ranges_.back ().second = i_;
+            else
+                ranges_.push_back (std::make_pair (i_, i_));
+        }
+        return ranges_;
+    }
+
+    // emit the condition testing whether the character 'ch_' is in one of
+    // the given ranges
+    template <typename Char>
+    inline void generate_ranges(std::basic_ostream<Char> &os_
+      , char_ranges const& ranges_, char const* ch_)
+    {
+        for (std::size_t i_ = 0; i_ < ranges_.size (); ++i_)
+        {
+            std::size_t const first_ = ranges_[i_].first;
+            std::size_t const last_ = ranges_[i_].second;
+
+            if (i_ != 0)
+                os_ << " || ";
+
+            if (last_ < 128)
+            {
+                // plain characters compare the same whether char is signed
+                if (first_ == last_)
+                {
+                    os_ << ch_ << " == '" << get_charlit(Char(first_)) << '\'';
+                }
+                else
+                {
+                    os_ << '(' << ch_ << " >= '" << get_charlit(Char(first_))
+                        << "' && " << ch_ << " <= '"
+                        << get_charlit(Char(last_)) << "')";
+                }
+            }
+            else if (first_ == 0)
+            {
+                os_ << "static_cast<unsigned char>(" << ch_ << ") <= "
+                    << last_;
+            }
+            else if (last_ == 255)
+            {
+                os_ << "static_cast<unsigned char>(" << ch_ << ") >= "
+                    << first_;
+            }
+            else
+            {
+                os_ << "(static_cast<unsigned char>(" << ch_ << ") >= "
+                    << first_ << " && static_cast<unsigned char>(" << ch_
+                    << ") <= " << last_ << ')';
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // generate function body of a switch based tokenizer for narrow
+    // characters:
+    //
+    //  - states with few transitions compare the next character against
+    //    the character ranges of their transitions,
+    //  - the other states map the characters to their equivalence classes
+    //    (the columns of the DFA tables) using a lookup table per lexer
+    //    state, and switch on the class of the next character,
+    //  - states having many different successors jump through a table of
+    //    label addresses indexed by the character instead if the compiler
+    //    supports computed gotos (define BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO
+    //    to disable those),
+    //  - states looping on themselves first skip all characters of the loop
+    //    in a tight loop, using static_::scan_to (memchr for pointers) if a
+    //    single character leaves the loop.
+    template <typename Char>
+    bool generate_function_body_switch(std::basic_ostream<Char> & os_
+      , boost::lexer::basic_state_machine<Char> const &sm_)
+    {
+        using boost::lexer::dead_state_index;
+
+        // states with at least this number of different successors use a
+        // computed goto, the characters of states needing at most this
+        // number of character ranges are compared directly instead of
+        // looking up their classes
+        std::size_t const computed_goto_targets = 4;
+        std::size_t const max_ranges = 8;
+
+        std::size_t const lookups_ = sm_.data()._lookup->front ()->size ();
+        if (lookups_ != 256)
+        {
+            // the lookup tables for wide characters would be far too large
+            return generate_function_body_switch_charsets(os_, sm_);
+        }
+
+        boost::lexer::detail::internals const& internals_ = sm_.data();
+        std::size_t const dfas_ = internals_._dfa->size ();
+        bool const seen_bol_ = internals_._seen_BOL_assertion;
+
+        // the number of rows of the DFA of every lexer state, and whether
+        // the label of a row is used
+        std::vector<std::size_t> states_(dfas_, 0);
+        std::vector<std::vector<bool> > referenced_(dfas_);
+
+        for (std::size_t dfa_ = 0; dfa_ < dfas_; ++dfa_)
+        {
+            std::size_t const alphabet_ = internals_._dfa_alphabet[dfa_];
+            std::vector<std::size_t> const& rows_ = *internals_._dfa[dfa_];
+
+            if (alphabet_ != 0)
+                states_[dfa_] = rows_.size () / alphabet_;
+
+            referenced_[dfa_].resize (states_[dfa_], false);
+            if (states_[dfa_] > 1 && dfas_ > 1)
+                referenced_[dfa_][1] = true;
+
+            for (std::size_t state_ = 1; state_ < states_[dfa_]; ++state_)
+            {
+                std::size_t const* row_ = &rows_[state_ * alphabet_];
+                for (std::size_t i_ = boost::lexer::bol_index;
+                     i_ < alphabet_; ++i_)
+                {
+                    if (i_ != dead_state_index)
+                        referenced_[dfa_][row_[i_]] = true;
+                }
+            }
+        }
+
+        // the states are generated first, the lookup tables of the character
+        // classes are emitted only if any of the states is using them (1 if
+        // those are used without computed gotos only, 2 otherwise)
+        std::basic_ostringstream<Char> body_;
+        std::vector<int> uses_lookup_(dfas_, 0);
+
+        body_ << "\n    if (start_token_ == end_)\n";
+        body_ << "    {\n";
+        body_ << "        unique_id_ = npos;\n";
+        body_ << "        return 0;\n";
+        body_ << "    }\n\n";
+
+        if (seen_bol_)
+        {
+            body_ << "    bool bol = bol_;\n";
+        }
+
+        if (dfas_ > 1)
+        {
+            body_ << "again:\n";
+        }
+
+        body_ << "    Iterator curr_ = start_token_;\n";
+        body_ << "    bool end_state_ = false;\n";
+        body_ << "    std::size_t id_ = npos;\n";
+        body_ << "    std::size_t uid_ = npos;\n";
+
+        if (dfas_ > 1)
+        {
+            body_ << "    std::size_t end_start_state_ = start_state_;\n";
+        }
+
+        if (seen_bol_)
+        {
+            body_ << "    bool end_bol_ = bol;\n";
+        }
+
+        body_ << "    Iterator end_token_ = start_token_;\n";
+        body_ << '\n';
+        body_ << "    char ch_ = 0;\n\n";
+
+        if (dfas_ > 1)
+        {
+            body_ << "    switch (start_state_)\n";
+            body_ << "    {\n";
+
+            for (std::size_t i_ = 0; i_ < dfas_; ++i_)
+            {
+                body_ << "    case " << i_ << ":\n";
+                body_ << "        ";
+                generate_goto(body_, i_, states_[i_] > 1 ? 1 : 0);
+                body_ << "        break;\n";
+            }
+
+            body_ << "    default:\n";
+            body_ << "        goto end;\n";
+            body_ << "        break;\n";
+            body_ << "    }\n";
+        }
+        else if (states_[0] < 2)
+        {
+            body_ << "    goto end;\n";
+        }
+
+        for (std::size_t dfa_ = 0; dfa_ < dfas_; ++dfa_)
+        {
+            std::size_t const alphabet_ = internals_._dfa_alphabet[dfa_];
+            std::size_t const* lookup_ = states_[dfa_] ?
+                &internals_._lookup[dfa_]->front () : 0;
+
+            for (std::size_t state_ = 1; state_ < states_[dfa_]; ++state_)
+            {
+                std::size_t const* row_ =
+                    &(*internals_._dfa[dfa_])[state_ * alphabet_];
+                std::size_t const columns_ = alphabet_ - dead_state_index;
+                std::size_t const bol_state_ = row_[boost::lexer::bol_index];
+                std::size_t const eol_state_ = row_[boost::lexer::eol_index];
+
+                // the classes of the characters leading to the same state
+                typedef std::map<std::size_t, std::vector<std::size_t> >
+                    targets_type;
+                targets_type targets_;
+                for (std::size_t class_ = 1; class_ < columns_; ++class_)
+                {
+                    std::size_t const next_ = row_[dead_state_index + class_];
+                    if (next_ != 0)
+                        targets_[next_].push_back (class_);
+                }
+
+                if (referenced_[dfa_][state_])
+                {
+                    body_ << "\nstate" << dfa_ << '_' << state_ - 1 << ":\n";
+                }
+                else
+                {
+                    body_ << '\n';
+                }
+
+                // skip the characters looping back to this state
+                typename targets_type::const_iterator self_ =
+                    targets_.find (state_);
+                bool looped_ = false;
+                if (self_ != targets_.end () && state_ != 1 &&
+                    bol_state_ == 0 && eol_state_ == 0)
+                {
+                    looped_ = true;
+                    std::size_t leaving_ = 0;
+                    std::size_t leaving_char_ = 0;
+                    for (std::size_t i_ = 0; i_ < 256; ++i_)
+                    {
+                        if (row_[lookup_[i_]] != state_)
+                        {
+                            ++leaving_;
+                            leaving_char_ = i_;
+                        }
+                    }
+
+                    if (leaving_ == 1 && leaving_char_ < 128 && !seen_bol_)
+                    {
+                        body_ << "    curr_ = static_::scan_to(curr_, end_, '"
+                            << get_charlit(Char(leaving_char_)) << "');\n";
+                    }
+                    else if (get_ranges (row_, lookup_, state_).size () <=
+                        max_ranges)
+                    {
+                        body_ << "    for (/**/; curr_ != end_; ++curr_)\n";
+                        body_ << "    {\n";
+                        body_ << "        char const next_ = *curr_;\n\n";
+                        body_ << "        if (!(";
+                        generate_ranges(body_
+                          , get_ranges (row_, lookup_, state_), "next_");
+                        body_ << "))\n";
+                        body_ << "            break;\n";
+                        if (seen_bol_)
+                        {
+                            body_ << "        ch_ = next_;\n";
+                        }
+                        body_ << "    }\n";
+                    }
+                    else
+                    {
+                        std::vector<std::size_t> const& classes_ =
+                            self_->second;
+
+                        uses_lookup_[dfa_] = 2;
+                        body_ << "    for (/**/; curr_ != end_; ++curr_)\n";
+                        body_ << "    {\n";
+                        body_ << "        switch (lookup" << dfa_
+                            << "_[static_cast<unsigned char>(*curr_)])\n";
+                        body_ << "        {\n";
+                        body_ << "        ";
+                        generate_cases(body_, classes_, "        ");
+                        if (seen_bol_)
+                        {
+                            body_ << "            ch_ = *curr_;\n";
+                        }
+                        body_ << "            continue;\n";
+                        body_ << "        }\n";
+                        body_ << "        break;\n";
+                        body_ << "    }\n";
+                    }
+                }
+
+                if (row_[boost::lexer::end_state_index])
+                {
+                    body_ << "    end_state_ = true;\n";
+                    body_ << "    id_ = " << row_[boost::lexer::id_index]
+                        << ";\n";
+                    body_ << "    uid_ = " << row_[boost::lexer::unique_id_index]
+                        << ";\n";
+                    body_ << "    end_token_ = curr_;\n";
+
+                    if (dfas_ > 1)
+                    {
+                        body_ << "    end_start_state_ = "
+                            << row_[boost::lexer::state_index] << ";\n";
+                    }
+
+                    if (seen_bol_)
+                    {
+                        body_ << "    end_bol_ = "
+                            << ((state_ == 1) ? "bol" : "(ch_ == '\\n')")
+                            << ";\n";
+                    }
+                    body_ << '\n';
+                }
+
+                // nothing but the loop leaves this state, and the loop
+                // stopped at a character it does not match
+                if ((targets_.empty () || (looped_ && targets_.size () == 1)) &&
+                    bol_state_ == 0 && eol_state_ == 0)
+                {
+                    body_ << "    goto end;\n";
+                    continue;
+                }
+
+                if (eol_state_ != 0 &&
+                    (*internals_._dfa[dfa_])[eol_state_ * alphabet_ +
+                        boost::lexer::eol_index] == 0)
+                {
+                    // '$' matches at the end of the input as well
+                    body_ << "    if (curr_ == end_) ";
+                    generate_goto(body_, dfa_, eol_state_);
+                }
+                body_ << "    if (curr_ == end_) goto end;\n";
+
+                if (bol_state_ != 0)
+                {
+                    body_ << "    if (" << ((state_ == 1) ? "bol" : "ch_ == '\\n'")
+                        << ") ";
+                    generate_goto(body_, dfa_, bol_state_);
+                }
+                if (eol_state_ != 0)
+                {
+                    body_ << "    if (*curr_ == '\\n') ";
+                    generate_goto(body_, dfa_, eol_state_);
+                }
+
+                if (targets_.empty ())
+                {
+                    body_ << "    goto end;\n";
+                    continue;
+                }
+
+                body_ << "    ch_ = *curr_;\n";
+                body_ << "    ++curr_;\n\n";
+
+                // the character ranges leading to the successors
+                std::vector<char_ranges> ranges_;
+                std::size_t range_count_ = 0;
+                for (typename targets_type::const_iterator it_ =
+                         targets_.begin (); it_ != targets_.end (); ++it_)
+                {
+                    ranges_.push_back (get_ranges (row_, lookup_, it_->first));
+                    range_count_ += ranges_.back ().size ();
+                }
+
+                if (targets_.size () < computed_goto_targets &&
+                    range_count_ <= max_ranges)
+                {
+                    std::size_t i_ = 0;
+                    for (typename targets_type::const_iterator it_ =
+                             targets_.begin (); it_ != targets_.end ();
+                         ++it_, ++i_)
+                    {
+                        body_ << "    if (";
+                        generate_ranges(body_, ranges_[i_], "ch_");
+                        body_ << ") ";
+                        generate_goto(body_, dfa_, it_->first);
+                    }
+                    body_ << "    goto end;\n";
+                    continue;
+                }
+
+                if (targets_.size () >= computed_goto_targets)
+                {
+                    // jump through a table indexed by the character itself,
+                    // saving the lookup of its class
+                    body_ << "#if defined(__GNUC__) && "
+                           "!defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)\n";
+                    body_ << "    {\n";
+                    body_ << "        static void* const targets_[256] = {";
+                    for (std::size_t i_ = 0; i_ < 256; ++i_)
+                    {
+                        std::size_t const next_ = row_[lookup_[i_]];
+
+                        body_ << ((i_ % 4 == 0) ? "\n            " : " ");
+                        if (next_ == 0)
+                            body_ << "&&end";
+                        else
+                            body_ << "&&state" << dfa_ << '_' << next_ - 1;
+                        body_ << ((i_ == 255) ? " };\n" : ",");
+                    }
+                    body_ << "        goto *targets_[static_cast<unsigned char>"
+                           "(ch_)];\n";
+                    body_ << "    }\n";
+                    body_ << "#else\n";
+                }
+
+                if (targets_.size () < computed_goto_targets)
+                    uses_lookup_[dfa_] = 2;
+                else if (uses_lookup_[dfa_] == 0)
+                    uses_lookup_[dfa_] = 1;
+
+                body_ << "    switch (lookup" << dfa_
+                    << "_[static_cast<unsigned char>(ch_)])\n";
+                body_ << "    {\n";
+                for (typename targets_type::const_iterator it_ =
+                         targets_.begin (); it_ != targets_.end (); ++it_)
+                {
+                    std::vector<std::size_t> const& classes_ = it_->second;
+                    body_ << "    ";
+                    generate_cases(body_, classes_, "    ");
+                    body_ << "        ";
+                    generate_goto(body_, dfa_, it_->first);
+                }
+                body_ << "    }\n";
+                body_ << "    goto end;\n";
+
+                if (targets_.size () >= computed_goto_targets)
+                {
+                    body_ << "#endif\n";
+                }
+            }
+        }
+
+        os_ << "    static std::size_t const npos = "
+               "static_cast<std::size_t>(~0);\n";
+
+        // the equivalence classes of the characters, class 0 is used for
+        // the characters not having any transitions
+        for (std::size_t dfa_ = 0; dfa_ < dfas_; ++dfa_)
+        {
+            if (uses_lookup_[dfa_] == 0)
+                continue;
+
+            if (uses_lookup_[dfa_] == 1)
+            {
+                os_ << "#if !defined(__GNUC__) || "
+                       "defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)\n";
+            }
+
+            std::size_t const* lookup_ = &internals_._lookup[dfa_]->front ();
+            std::size_t const columns_ =
+                internals_._dfa_alphabet[dfa_] - dead_state_index;
+
+            os_ << "    static unsigned "
+                << ((columns_ <= 256) ? "char" : "short")
+                << " const lookup" << dfa_ << "_[256] = {\n        ";
+            for (std::size_t i_ = 0; i_ < 256; ++i_)
+            {
+                os_ << lookup_[i_] - dead_state_index;
+                if (i_ == 255)
+                    os_ << " };\n";
+                else if (i_ % 16 == 15)
+                    os_ << ",\n        ";
+                else
+                    os_ << ", ";
+            }
+
+            if (uses_lookup_[dfa_] == 1)
+            {
+                os_ << "#endif\n";
+            }
+        }
+
+        os_ << body_.str ();
+        os_ << "\nend:\n";
+        os_ << "    if (end_state_)\n";
+        os_ << "    {\n";
+        os_ << "        // return longest match\n";
+        os_ << "        start_token_ = end_token_;\n";
+
+        if (dfas_ > 1)
+        {
+            os_ << "        start_state_ = end_start_state_;\n";
+            os_ << "\n        if (id_ == 0)\n";
+            os_ << "        {\n";
+
+            if (seen_bol_)
+            {
+                os_ << "            bol = end_bol_;\n";
+            }
+
+            os_ << "            goto again;\n";
+            os_ << "        }\n";
+
+            if (seen_bol_)
+            {
+                os_ << "        else\n";
+                os_ << "        {\n";
+                os_ << "            bol_ = end_bol_;\n";
+                os_ << "        }\n";
+            }
+        }
+        else if (seen_bol_)
+        {
+            os_ << "        bol_ = end_bol_;\n";
+        }
+
+        os_ << "    }\n";
+        os_ << "    else\n";
+        os_ << "    {\n";
+
+        if (seen_bol_)
+        {
+            os_ << "        bol_ = (*start_token_ == '\\n') ? true : false;\n";
+        }
+        os_ << "        id_ = npos;\n";
+        os_ << "        uid_ = npos;\n";
+        os_ << "    }\n\n";
+
+        os_ << "    unique_id_ = uid_;\n";
+        os_ << "    return id_;\n";
+        return os_.good();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Generate a tokenizer for the given state machine.
     template <typename Char, typename F>
@@ -912,7 +1482,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         os_ << "#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_" << guard << "\n\n";
 
         os_ << "#include <boost/detail/iterator.hpp>\n";
-        os_ << "#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>\n\n";
+        os_ << "#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>\n";
+        os_ << "#include <boost/spirit/home/lex/lexer/lexertl/static_scan.hpp>\n\n";
 
         generate_delimiter(os_);
         os_ << "// the generated table of state names and the tokenizer have to be\n"
@@ -0,0 +1,93 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_HASH_RULES_OCT_19_2026_1022AM)
+#define BOOST_SPIRIT_LEX_LEXERTL_HASH_RULES_OCT_19_2026_1022AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    namespace detail
+    {
+        // FNV-1a, fed with the bytes of 64 bit words
+        inline void hash_word(boost::uint64_t& hash, boost::uint64_t value)
+        {
+            for (int i = 0; i != 8; ++i)
+            {
+                hash ^= (value >> (8 * i)) & 0xff;
+                hash *= UINT64_C(1099511628211);
+            }
+        }
+
+        template <typename Char>
+        inline void hash_string(boost::uint64_t& hash
+          , std::basic_string<Char> const& str)
+        {
+            hash_word(hash, str.size());
+            for (std::size_t i = 0; i != str.size(); ++i)
+                hash_word(hash, static_cast<boost::uint64_t>(str[i]));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Calculate a hash of the given rules: the flags, the lexer states, the
+    //  macros, and the regular expressions together with their token ids,
+    //  unique ids and target states. This identifies the DFA built from the
+    //  rules, as long as the lexertl generator does not change (the locale
+    //  of the rules is not taken into account).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    boost::uint64_t hash_rules(boost::lexer::basic_rules<Char> const& rules)
+    {
+        typedef boost::lexer::basic_rules<Char> rules_type;
+
+        boost::uint64_t hash = UINT64_C(14695981039346656037);
+        detail::hash_word(hash, rules.flags());
+
+        typename rules_type::string_size_t_map const& statemap =
+            rules.statemap();
+        detail::hash_word(hash, statemap.size());
+        for (typename rules_type::string_size_t_map::const_iterator it =
+                 statemap.begin(); it != statemap.end(); ++it)
+        {
+            detail::hash_string(hash, it->first);
+            detail::hash_word(hash, it->second);
+        }
+
+        typename rules_type::string_pair_deque const& macros =
+            rules.macrodeque();
+        detail::hash_word(hash, macros.size());
+        for (std::size_t i = 0; i != macros.size(); ++i)
+        {
+            detail::hash_string(hash, macros[i].first);
+            detail::hash_string(hash, macros[i].second);
+        }
+
+        typename rules_type::string_deque_deque const& regexes =
+            rules.regexes();
+        detail::hash_word(hash, regexes.size());
+        for (std::size_t state = 0; state != regexes.size(); ++state)
+        {
+            detail::hash_word(hash, regexes[state].size());
+            for (std::size_t i = 0; i != regexes[state].size(); ++i)
+            {
+                detail::hash_string(hash, regexes[state][i]);
+                detail::hash_word(hash, rules.ids()[state][i]);
+                detail::hash_word(hash, rules.unique_ids()[state][i]);
+                detail::hash_word(hash, rules.states()[state][i]);
+            }
+        }
+        return hash;
+    }
+}}}}
+
+#endif
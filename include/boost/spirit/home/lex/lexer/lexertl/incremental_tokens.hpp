@@ -0,0 +1,330 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_INCREMENTAL_TOKENS_OCT_19_2026_0631PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_INCREMENTAL_TOKENS_OCT_19_2026_0631PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token_vector.hpp>
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  The tokens replaced by incremental_tokens::retokenize: the tokens
+    //  [first, first + erased) of the former token vector are now the tokens
+    //  [first, first + inserted), all other tokens are unchanged (except for
+    //  their offsets, which are moved by the edit). 'complete' tells whether
+    //  all of the input has been tokenized.
+    struct changed_tokens
+    {
+        changed_tokens()
+          : first(0), erased(0), inserted(0), complete(false) {}
+
+        std::size_t first;
+        std::size_t erased;
+        std::size_t inserted;
+        bool complete;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  incremental_tokens keeps the compact tokens of an input (see
+    //  tokenize_all) up to date while the input is edited. After every edit
+    //  retokenize restarts matching at the last token not depending on the
+    //  edited characters, in the lexer state stored with that token, and
+    //  stops as soon as a token ends after the edit in the same lexer state
+    //  as one of the former tokens, as all tokens from there on are the
+    //  same as before:
+    //
+    //      lexertl::incremental_tokens tokens;
+    //      lexer.tokenize(text.begin(), text.end(), tokens);
+    //
+    //      text.insert(42, 1, 'x');        // one character inserted at 42
+    //      lexertl::changed_tokens changed =
+    //          lexer.retokenize(text.begin(), text.end(), tokens, 42, 0, 1);
+    //
+    //  A token depends on all characters the DFA has looked at for finding
+    //  it, which may be more than the token itself: after "1." the DFA of
+    //  a number allowing for "1.5" looks at the next character, too. These
+    //  are one character for most tokens, the tokens looking further ahead
+    //  are recorded separately.
+    //
+    //  Iterator has to be a random access iterator, the input is limited to
+    //  4GB (see compact_token).
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    class incremental_tokens
+    {
+    public:
+        typedef std::vector<compact_token> token_vector_type;
+
+        incremental_tokens() {}
+
+        token_vector_type const& tokens() const { return tokens_; }
+        std::size_t size() const { return tokens_.size(); }
+
+        void clear()
+        {
+            tokens_.clear();
+            lookahead_.clear();
+        }
+
+        //  Tokenize the whole input [first, last) anew, starting in the lexer
+        //  state 'state'.
+        template <typename Iterator, typename Char>
+        changed_tokens tokenize(packed_state_machine<Char> const& state_machine
+          , Iterator const& first, Iterator const& last
+          , std::size_t state = 0)
+        {
+            std::size_t const erased = tokens_.size();
+            clear();
+
+            changed_tokens changed = retokenize(state_machine, first, last
+              , 0, 0, last - first, state);
+            changed.erased = erased;
+            return changed;
+        }
+
+        //  Update the tokens after the 'erased' characters at 'offset' of the
+        //  input tokenized before have been replaced by the 'inserted'
+        //  characters at 'offset' of [first, last). 'state' is the lexer state
+        //  the tokenization of the whole input starts in.
+        template <typename Iterator, typename Char>
+        changed_tokens retokenize(
+            packed_state_machine<Char> const& state_machine
+          , Iterator const& first, Iterator const& last
+          , std::size_t offset, std::size_t erased, std::size_t inserted
+          , std::size_t state = 0)
+        {
+            typedef basic_iterator_tokeniser<Iterator> tokenizer;
+
+            changed_tokens changed;
+
+            std::size_t const size = last - first;
+            if (state >= state_machine.size() ||
+                boost::uint64_t(size) >= boost::uint64_t(0xffffffffu) ||
+                offset + inserted > size)
+            {
+                return changed;
+            }
+
+            //  restart at the first token having looked at the edit, or at
+            //  the last token (its successor's lexer state is not known)
+            std::size_t restart = first_affected(offset);
+            if (restart == tokens_.size() && restart != 0)
+                --restart;
+
+            std::size_t start = 0;
+            if (restart != tokens_.size())
+            {
+                start = tokens_[restart].offset;
+                state = tokens_[restart].state;
+            }
+
+            bool bol = state_machine.seen_bol_assertion();
+            if (start != 0)
+                bol = (first[start - 1] == '\n') ? true : false;
+
+            //  match the tokens up to where the former ones are found again
+            std::size_t const edit_end = offset + inserted;
+            std::size_t old = restart;
+            token_vector_type fresh;
+            lookahead_vector_type fresh_lookahead;
+
+            Iterator end = first + start;
+            for (std::size_t end_offset = start; /**/; /**/)
+            {
+                if (end_offset > edit_end || (end_offset == edit_end &&
+                    !state_machine.seen_bol_assertion()))
+                {
+                    //  the position of the next token before the edit
+                    std::size_t const old_offset =
+                        end_offset + erased - inserted;
+                    while (old != tokens_.size() &&
+                           tokens_[old].offset < old_offset)
+                    {
+                        ++old;
+                    }
+                    if (old != tokens_.size() &&
+                        tokens_[old].offset == old_offset &&
+                        tokens_[old].state == state)
+                    {
+                        break;
+                    }
+                }
+
+                std::size_t const token_state = state;
+                std::size_t unique_id = boost::lexer::npos;
+                Iterator scan_end = end;
+                std::size_t const id = tokenizer::next(state_machine, state
+                  , bol, end, last, unique_id, scan_end);
+
+                if (0 == id || boost::lexer::npos == id)
+                {
+                    old = tokens_.size();   // the rest is not tokenized
+                    break;
+                }
+
+                std::size_t const length = (end - first) - end_offset;
+                fresh.push_back(
+                    compact_token(id, token_state, end_offset, length));
+                end_offset += length;
+
+                //  looking at the end of the input counts as looking one
+                //  character beyond it
+                std::size_t const scanned = (scan_end == last) ?
+                    size + 1 : std::size_t(scan_end - first);
+                if (scanned > end_offset + 1)
+                {
+                    fresh_lookahead.push_back(lookahead_type(
+                        boost::uint32_t(end_offset)
+                      , boost::uint32_t(scanned)));
+                }
+            }
+
+            //  the former tokens having been matched again before the edit
+            //  are not reported as changed
+            std::size_t same = 0;
+            while (same != fresh.size() && restart + same != old &&
+                   fresh[same].offset + fresh[same].length <= offset &&
+                   equal(fresh[same], tokens_[restart + same]))
+            {
+                ++same;
+            }
+
+            std::size_t const old_end = (old != tokens_.size()) ?
+                tokens_[old].offset : std::size_t(0xffffffffu);
+            replace_lookahead(start, old_end, fresh_lookahead
+              , boost::uint32_t(inserted - erased));
+            replace_tokens(restart, old, fresh
+              , boost::uint32_t(inserted - erased));
+
+            changed.first = restart + same;
+            changed.erased = old - restart - same;
+            changed.inserted = fresh.size() - same;
+            changed.complete = tokens_.empty() ? (size == 0) :
+                (tokens_.back().offset + tokens_.back().length == size);
+            return changed;
+        }
+
+    private:
+        //  the end of a token and the end of the characters looked at for
+        //  finding it (one past the end of the input if it looked at the
+        //  end of the input), for the tokens looking at more than the
+        //  character following them, sorted by their position
+        typedef std::pair<boost::uint32_t, boost::uint32_t> lookahead_type;
+        typedef std::vector<lookahead_type> lookahead_vector_type;
+
+        static bool equal(compact_token const& lhs, compact_token const& rhs)
+        {
+            return lhs.id == rhs.id && lhs.state == rhs.state &&
+                lhs.offset == rhs.offset && lhs.length == rhs.length;
+        }
+
+        struct ends_before
+        {
+            bool operator()(compact_token const& token, std::size_t offset) const
+            {
+                return token.offset + token.length < offset;
+            }
+        };
+
+        //  the first token depending on the character at 'offset'
+        std::size_t first_affected(std::size_t offset) const
+        {
+            //  the tokens ending before the character preceding 'offset'
+            //  did not look at it, unless they are recorded to look further
+            std::size_t affected = std::lower_bound(tokens_.begin()
+              , tokens_.end(), offset, ends_before()) - tokens_.begin();
+
+            typedef lookahead_vector_type::const_iterator iterator;
+            for (iterator it = lookahead_.begin();
+                 it != lookahead_.end() && it->first < offset; ++it)
+            {
+                if (it->second > offset)
+                {
+                    std::size_t const token = std::lower_bound(
+                        tokens_.begin(), tokens_.end(), it->first
+                      , ends_before()) - tokens_.begin();
+                    return (std::min)(token, affected);
+                }
+            }
+            return affected;
+        }
+
+        //  replace the tokens [first, last) by the fresh ones and move the
+        //  tokens following them by 'delta' characters
+        void replace_tokens(std::size_t first, std::size_t last
+          , token_vector_type const& fresh, boost::uint32_t delta)
+        {
+            typedef token_vector_type::iterator iterator;
+
+            if (delta != 0)
+            {
+                for (iterator it = tokens_.begin() + last; it != tokens_.end();
+                     ++it)
+                {
+                    it->offset += delta;
+                }
+            }
+
+            std::size_t const common = (std::min)(fresh.size(), last - first);
+            std::copy(fresh.begin(), fresh.begin() + common
+              , tokens_.begin() + first);
+
+            if (fresh.size() > common)
+            {
+                tokens_.insert(tokens_.begin() + first + common
+                  , fresh.begin() + common, fresh.end());
+            }
+            else
+            {
+                tokens_.erase(tokens_.begin() + first + common
+                  , tokens_.begin() + last);
+            }
+        }
+
+        //  the same for the recorded lookaheads of the tokens ending in
+        //  (first, last]
+        void replace_lookahead(std::size_t first, std::size_t last
+          , lookahead_vector_type const& fresh, boost::uint32_t delta)
+        {
+            typedef lookahead_vector_type::iterator iterator;
+
+            iterator begin = lookahead_.begin();
+            while (begin != lookahead_.end() && begin->first <= first)
+                ++begin;
+            iterator end = begin;
+            while (end != lookahead_.end() && end->first <= last)
+                ++end;
+
+            for (iterator it = end; it != lookahead_.end(); ++it)
+            {
+                it->first += delta;
+                it->second += delta;
+            }
+
+            std::size_t const at = begin - lookahead_.begin();
+            lookahead_.erase(begin, end);
+            lookahead_.insert(lookahead_.begin() + at, fresh.begin()
+              , fresh.end());
+        }
+
+        token_vector_type tokens_;
+        lookahead_vector_type lookahead_;
+    };
+}}}}
+
+#endif
@@ -15,6 +15,10 @@
 #include <boost/spirit/home/support/detail/lexer/consts.hpp>
 #include <boost/spirit/home/support/detail/lexer/size_t.hpp>
 #include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/scan.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/cstdint.hpp>
 #include <vector>
 
 namespace boost { namespace spirit { namespace lex { namespace lexertl
@@ -248,6 +252,340 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             unique_id_ = uid_;
             return id_;
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  The same for the packed tables of a state machine (see
+        //  packed_state_machine.hpp), these are used by the dynamic lexer.
+        typedef packed_state_machine<char_type> packed_state_machine_type;
+        typedef typename packed_state_machine_type::dfa packed_dfa_type;
+
+        static std::size_t next (
+            packed_state_machine_type const& state_machine_
+          , std::size_t &dfa_state_, bool& bol_, Iterator &start_token_
+          , Iterator const& end_, std::size_t& unique_id_)
+        {
+            if (start_token_ == end_)
+            {
+                unique_id_ = boost::lexer::npos;
+                return 0;
+            }
+
+            bool bol = bol_;
+            match_type match_;
+
+            for (;;)
+            {
+                match(state_machine_[dfa_state_], dfa_state_, bol, bol_
+                  , start_token_, end_, match_);
+
+                if (!match_.end_state)
+                    break;
+
+                // return longest match
+                dfa_state_ = match_.next_state;
+                start_token_ = match_.end_token;
+
+                if (match_.id != 0)
+                {
+                    bol_ = match_.bol;
+                    unique_id_ = match_.unique_id;
+                    return match_.id;
+                }
+                bol = match_.bol;
+            }
+
+            bol_ = (start_token_ != end_ && *start_token_ == '\n') ? true : false;
+            unique_id_ = boost::lexer::npos;
+            return boost::lexer::npos;
+        }
+
+        //  The same, also returning the end of the characters the DFA had
+        //  to look at for finding the token in 'scan_end_', which is 'end_'
+        //  if it looked at the end of the input (see incremental_tokens).
+        //  Iterator has to be a random access iterator.
+        static std::size_t next (
+            packed_state_machine_type const& state_machine_
+          , std::size_t &dfa_state_, bool& bol_, Iterator &start_token_
+          , Iterator const& end_, std::size_t& unique_id_, Iterator& scan_end_)
+        {
+            scan_end_ = start_token_;
+            if (start_token_ == end_)
+            {
+                unique_id_ = boost::lexer::npos;
+                return 0;
+            }
+
+            bool bol = bol_;
+            match_type match_;
+
+            for (;;)
+            {
+                match(state_machine_[dfa_state_], dfa_state_, bol, bol_
+                  , start_token_, end_, match_);
+
+                if (scan_end_ < match_.scan_end)
+                    scan_end_ = match_.scan_end;
+
+                if (!match_.end_state)
+                    break;
+
+                // return longest match
+                dfa_state_ = match_.next_state;
+                start_token_ = match_.end_token;
+
+                if (match_.id != 0)
+                {
+                    bol_ = match_.bol;
+                    unique_id_ = match_.unique_id;
+                    return match_.id;
+                }
+                bol = match_.bol;
+            }
+
+            bol_ = (start_token_ != end_ && *start_token_ == '\n') ? true : false;
+            unique_id_ = boost::lexer::npos;
+            return boost::lexer::npos;
+        }
+
+        static std::size_t next (
+            packed_state_machine_type const& state_machine_
+          , bool& bol_, Iterator &start_token_, Iterator const& end_
+          , std::size_t& unique_id_)
+        {
+            if (start_token_ == end_)
+            {
+                unique_id_ = boost::lexer::npos;
+                return 0;
+            }
+
+            match_type match_;
+            match(state_machine_[0], 0, bol_, bol_, start_token_, end_
+              , match_);
+
+            if (match_.end_state) {
+                // return longest match
+                bol_ = match_.bol;
+                start_token_ = match_.end_token;
+                unique_id_ = match_.unique_id;
+                return match_.id;
+            }
+
+            bol_ = *start_token_ == '\n';
+            unique_id_ = boost::lexer::npos;
+            return boost::lexer::npos;
+        }
+
+    private:
+        // the longest match found by a packed DFA
+        struct match_type
+        {
+            bool end_state;
+            std::size_t id;
+            std::size_t unique_id;
+            std::size_t next_state;
+            bool bol;
+            Iterator end_token;
+            Iterator scan_end;      // the end of the characters looked at
+        };
+
+        // select the tables matching the width of the state indices of the
+        // DFA, and whether it has BOL or EOL transitions
+        static void match(packed_dfa_type const& dfa_, std::size_t dfa_state_
+          , bool bol, bool end_bol_, Iterator const& start_token_
+          , Iterator const& end_, match_type& match_)
+        {
+            match_.end_state = false;
+            match_.id = 0;
+            match_.unique_id = boost::lexer::npos;
+            match_.next_state = dfa_state_;
+            match_.bol = end_bol_;
+            match_.end_token = start_token_;
+            match_.scan_end = start_token_;
+
+            if (dfa_.start() == 0)
+                return;     // no token definitions in this lexer state
+
+            switch (dfa_.width()) {
+            case 1:
+                match<boost::uint8_t>(dfa_, bol, start_token_, end_, match_);
+                break;
+            case 2:
+                match<boost::uint16_t>(dfa_, bol, start_token_, end_, match_);
+                break;
+            default:
+                match<boost::uint32_t>(dfa_, bol, start_token_, end_, match_);
+                break;
+            }
+        }
+
+        template <typename Index>
+        static void match(packed_dfa_type const& dfa_, bool bol
+          , Iterator const& start_token_, Iterator const& end_
+          , match_type& match_)
+        {
+            if (dfa_.has_assertions())
+            {
+                match<Index>(dfa_, bol, start_token_, end_, match_
+                  , mpl::true_());
+            }
+            else
+            {
+                match<Index>(dfa_, bol, start_token_, end_, match_
+                  , mpl::false_());
+            }
+        }
+
+        // runs of characters looped on are skipped by searching for the
+        // next exit if the characters of the input are contiguous
+        template <typename Index, typename HasAssertions>
+        static void match(packed_dfa_type const& dfa_, bool bol
+          , Iterator const& start_token_, Iterator const& end_
+          , match_type& match_, HasAssertions)
+        {
+            typedef typename
+                detail::is_contiguous_narrow_iterator<Iterator>::type
+            contiguous;
+
+            match<Index>(dfa_, bol, start_token_, end_, match_
+              , HasAssertions(), contiguous());
+        }
+
+        template <typename Index, typename HasAssertions>
+        static void match(packed_dfa_type const& dfa_, bool bol
+          , Iterator const& start_token_, Iterator const& end_
+          , match_type& match_, HasAssertions, mpl::true_)
+        {
+            if (dfa_.has_scans())
+            {
+                match<Index>(dfa_, bol, start_token_, end_, match_
+                  , HasAssertions(), mpl::true_(), mpl::true_());
+            }
+            else
+            {
+                match<Index>(dfa_, bol, start_token_, end_, match_
+                  , HasAssertions(), mpl::true_(), mpl::false_());
+            }
+        }
+
+        template <typename Index, typename HasAssertions>
+        static void match(packed_dfa_type const& dfa_, bool bol
+          , Iterator const& start_token_, Iterator const& end_
+          , match_type& match_, HasAssertions, mpl::false_)
+        {
+            match<Index>(dfa_, bol, start_token_, end_, match_
+              , HasAssertions(), mpl::false_(), mpl::false_());
+        }
+
+        template <typename Index, typename HasAssertions, typename Contiguous
+          , typename HasScans>
+        static void match(packed_dfa_type const& dfa_, bool bol
+          , Iterator const& start_token_, Iterator const& end_
+          , match_type& match_, HasAssertions, Contiguous, HasScans)
+        {
+            typedef typename
+                boost::lexer::char_traits<char_type>::index_type
+            index_type;
+
+            typename packed_state_machine_type::template tables<Index> const&
+                tables_ = dfa_.get(Index());
+            Index const* lookup_ = tables_.lookup;
+            Index const* transitions_ = tables_.transitions;
+            std::size_t const columns_ = dfa_.columns();
+            std::size_t const accepting_ = dfa_.accepting();
+
+            std::size_t state_ = dfa_.start();
+            Iterator curr_ = start_token_;
+
+            if (state_ <= accepting_)
+            {
+                // the start state keeps the lexer state and BOL flag
+                match_.end_state = true;
+                match_.id = dfa_.accept(state_).id;
+                match_.unique_id = dfa_.accept(state_).unique_id;
+            }
+
+            while (curr_ != end_)
+            {
+                if (HasAssertions::value && dfa_.bol_state(state_) && bol)
+                {
+                    state_ = dfa_.bol_state(state_);
+                }
+                else if (HasAssertions::value && dfa_.eol_state(state_)
+                    && *curr_ == '\n')
+                {
+                    state_ = dfa_.eol_state(state_);
+                }
+                else
+                {
+                    index_type index =
+                        boost::lexer::char_traits<char_type>::call(*curr_++);
+                    bol = (index == '\n') ? true : false;
+                    std::size_t const next_ = transitions_[state_ * columns_
+                      + lookup_[static_cast<std::size_t>(index)]];
+
+                    if (next_ == 0)
+                    {
+                        break;
+                    }
+
+                    if (HasScans::value && next_ == state_ &&
+                        dfa_.scan(state_).scan)
+                    {
+                        // skip the rest of the run, every character of it
+                        // keeps the state (and extends the match)
+                        typename packed_state_machine_type::scan_info const&
+                            scan_ = dfa_.scan(state_);
+                        scan(curr_, end_, bol, scan_, Contiguous());
+                    }
+
+                    state_ = next_;
+                }
+
+                if (state_ <= accepting_)
+                {
+                    accept(dfa_.accept(state_), bol, curr_, match_);
+                }
+            }
+
+            if (HasAssertions::value && curr_ == end_ && dfa_.eol_state(state_))
+            {
+                state_ = dfa_.eol_state(state_);
+
+                if (state_ <= accepting_)
+                {
+                    accept(dfa_.accept(state_), bol, curr_, match_);
+                }
+            }
+            match_.scan_end = curr_;
+        }
+
+        static void scan(Iterator& curr_, Iterator const& end_, bool& bol
+          , typename packed_state_machine_type::scan_info const& scan_
+          , mpl::true_)
+        {
+            Iterator const run_ = curr_;
+            curr_ = detail::scan_to_any(curr_, end_, scan_.chars, scan_.exits);
+            if (curr_ != run_)
+                bol = (*(curr_ - 1) == '\n') ? true : false;
+        }
+
+        static void scan(Iterator&, Iterator const&, bool&
+          , typename packed_state_machine_type::scan_info const&, mpl::false_)
+        {
+            // never used, as there are no scans
+        }
+
+        static void accept(
+            typename packed_state_machine_type::accept_info const& info_
+          , bool bol, Iterator const& curr_, match_type& match_)
+        {
+            match_.end_state = true;
+            match_.id = info_.id;
+            match_.unique_id = info_.unique_id;
+            match_.next_state = info_.next_state;
+            match_.bol = bol;
+            match_.end_token = curr_;
+        }
     };
 
 }}}}
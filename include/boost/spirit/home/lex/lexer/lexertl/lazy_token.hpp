@@ -0,0 +1,408 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_LAZY_TOKEN_OCT_19_2026_0347PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_LAZY_TOKEN_OCT_19_2026_0347PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/detail/assign_to.hpp>
+#include <boost/spirit/home/support/attributes.hpp>
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token_vector.hpp>
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/fusion/include/vector.hpp>
+#include <boost/variant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  token_value_cache is the side table holding the token values
+    //  converted while parsing the compact tokens stored by
+    //  lexer::tokenize (see lazy_token_iterator below). Only the tokens
+    //  whose value has actually been requested by a parser get an entry,
+    //  all others stay 16 byte compact_token's. The entries are kept
+    //  sorted by the index of the token, which mostly means appending
+    //  them, as the tokens are parsed in order.
+    //
+    //  As the values are needed again only when the parser backtracks,
+    //  the cache holds at most 'max_size' values (unless this is 0). When
+    //  it is full the older half of them is dropped, to be converted
+    //  anew if they are ever needed, so that the cache itself stops
+    //  growing after it has filled up for the first time. Values which
+    //  own memory (like std::string) still allocate whenever they are
+    //  converted or moved within the cache.
+    //
+    //  The type of the stored values is the token value type of Token
+    //  (usually a lexertl::token), a variant of all the attribute types of
+    //  the token definitions.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token>
+    class token_value_cache
+    {
+    public:
+        typedef typename Token::token_value_type value_type;
+
+        explicit token_value_cache(std::vector<compact_token> const& tokens
+              , std::size_t max_size = 1024)
+          : tokens_(&tokens), max_size_(max_size) {}
+
+        //  the tokens the values belong to
+        std::vector<compact_token> const& tokens() const { return *tokens_; }
+
+        //  the number of converted values
+        std::size_t size() const { return values_.size(); }
+        void clear() { values_.clear(); }
+
+        //  the value of the token with the given index, if it has been
+        //  converted before, otherwise 0
+        value_type* find(std::size_t index)
+        {
+            if (values_.empty() || values_.back().first < index)
+                return 0;
+
+            //  backtracking mostly returns to the last converted token
+            if (values_.back().first == index)
+                return &values_.back().second;
+
+            typename values_type::iterator it = lower_bound(index);
+            return (it->first == index) ? &it->second : 0;
+        }
+
+        //  add the value of the token with the given index, which must not
+        //  have a value yet
+        void insert(std::size_t index, value_type const& value)
+        {
+            if (0 != max_size_ && values_.size() >= max_size_)
+            {
+                values_.erase(values_.begin()
+                  , values_.begin() + (values_.size() + 1) / 2);
+            }
+
+            if (values_.empty() || values_.back().first < index)
+            {
+                values_.push_back(entry_type(boost::uint32_t(index), value));
+                return;
+            }
+            values_.insert(lower_bound(index)
+              , entry_type(boost::uint32_t(index), value));
+        }
+
+    private:
+        typedef std::pair<boost::uint32_t, value_type> entry_type;
+        typedef std::vector<entry_type> values_type;
+
+        struct compare_index
+        {
+            bool operator()(entry_type const& lhs, std::size_t rhs) const
+            {
+                return lhs.first < rhs;
+            }
+        };
+
+        typename values_type::iterator lower_bound(std::size_t index)
+        {
+            return std::lower_bound(values_.begin(), values_.end(), index
+              , compare_index());
+        }
+
+        std::vector<compact_token> const* tokens_;
+        std::size_t max_size_;
+        values_type values_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  lazy_token is the token type exposed by the lazy_token_iterator. It
+    //  refers to a compact token, converting the matched characters to the
+    //  attribute requested by a token parser on first use and storing the
+    //  result in the token_value_cache, from where it is taken whenever
+    //  the same token is parsed again (i.e. after backtracking). Tokens
+    //  with no token value types (or with lex::omit) never touch the
+    //  cache.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token, typename Iterator = typename Token::iterator_type>
+    class lazy_token
+    {
+    public:
+        typedef typename Token::id_type id_type;
+        typedef typename Token::has_state has_state;
+        typedef typename Token::token_value_type token_value_type;
+        typedef Iterator iterator_type;
+        typedef token_value_cache<Token> cache_type;
+
+        lazy_token(Iterator const& base, compact_token const& token
+              , cache_type& values)
+          : base_(base), token_(&token), values_(&values) {}
+
+        operator id_type() const { return id(); }
+
+        id_type id() const { return id_type(token_->id); }
+        std::size_t state() const { return token_->state; }
+
+        bool is_valid() const
+        {
+            return 0 != token_->id && id_type(boost::lexer::npos) != id();
+        }
+
+        //  the matched characters
+        iterator_range<Iterator> matched() const
+        {
+            Iterator const start = base_ + token_->offset;
+            return iterator_range<Iterator>(start, start + token_->length);
+        }
+
+        //  the index of the token in the vector of compact tokens
+        std::size_t index() const
+        {
+            return token_ - &values_->tokens().front();
+        }
+
+        //  convert the value of the token, or retrieve the cached value
+        template <typename Attribute>
+        void value(Attribute& attr) const
+        {
+            value(attr, static_cast<token_value_type const*>(0));
+        }
+
+    private:
+        //  lex::omit: the attribute is left alone
+        template <typename Attribute>
+        void value(Attribute&, unused_type const*) const {}
+
+        //  no token value types: the attribute is made from the matched
+        //  characters every time, which is cheap
+        template <typename Attribute>
+        void value(Attribute& attr, iterator_range<Iterator> const*) const
+        {
+            iterator_range<Iterator> const r = matched();
+            spirit::traits::assign_to(r.begin(), r.end(), attr);
+        }
+
+        //  a variant of the token value types: convert once, as the token
+        //  does (see assign_to_attribute_from_value for lexertl::token)
+        template <typename Attribute, typename Value>
+        void value(Attribute& attr, Value const*) const
+        {
+            iterator_range<Iterator> const r = matched();
+
+            //  the matched range is always at hand, even if the token has
+            //  been converted to another type before
+            if (is_same<Attribute, iterator_range<Iterator> >::value)
+            {
+                spirit::traits::assign_to(r.begin(), r.end(), attr);
+                return;
+            }
+
+            std::size_t const index = this->index();
+            token_value_type* v = values_->find(index);
+            if (0 != v && 0 != v->which())
+            {
+                spirit::traits::assign_to(boost::get<Attribute>(*v), attr);
+                return;
+            }
+
+            spirit::traits::assign_to(r.begin(), r.end(), attr);
+
+            //  Any attribute type used by a token_def<> has to be listed as
+            //  one of the token value types of Token.
+            if (0 != v)
+                *v = attr;
+            else
+                values_->insert(index, attr);
+        }
+
+        Iterator base_;
+        compact_token const* token_;
+        cache_type* values_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token, typename Iterator>
+    inline bool operator== (lazy_token<Token, Iterator> const& lhs
+      , lazy_token<Token, Iterator> const& rhs)
+    {
+        return lhs.id() == rhs.id();
+    }
+
+    template <typename Token, typename Iterator>
+    inline bool token_is_valid(lazy_token<Token, Iterator> const& t)
+    {
+        return t.is_valid();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  lazy_token_iterator is a random access iterator over the compact
+    //  tokens stored by lexer::tokenize (see tokenize_all), like the
+    //  token_vector_iterator, but exposing lazy_token's instead of
+    //  constructing a full token for every access:
+    //
+    //      std::vector<lexertl::compact_token> tokens;
+    //      if (lexer.tokenize(first, last, tokens))
+    //      {
+    //          lexer_type::token_value_cache_type values(tokens);
+    //          lexer_type::lazy_token_iterator_type
+    //              begin(first, tokens.begin(), values)
+    //            , end(first, tokens.end(), values);
+    //          qi::parse(begin, end, grammar);
+    //      }
+    //
+    //  The cache has to be constructed for the same vector of tokens the
+    //  iterators refer to, and must outlive them.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token, typename Iterator = typename Token::iterator_type>
+    class lazy_token_iterator
+      : public boost::iterator_facade<
+            lazy_token_iterator<Token, Iterator>, lazy_token<Token, Iterator>
+          , std::random_access_iterator_tag, lazy_token<Token, Iterator> >
+    {
+    private:
+        typedef boost::iterator_facade<
+                lazy_token_iterator<Token, Iterator>
+              , lazy_token<Token, Iterator>
+              , std::random_access_iterator_tag, lazy_token<Token, Iterator> >
+            base_type;
+
+    public:
+        typedef lazy_token<Token, Iterator> token_type;
+        typedef Iterator base_iterator_type;
+        typedef token_value_cache<Token> cache_type;
+        typedef std::vector<compact_token>::const_iterator compact_iterator;
+
+        lazy_token_iterator() : base_(), it_(), values_(0) {}
+
+        lazy_token_iterator(Iterator const& base, compact_iterator it
+              , cache_type& values)
+          : base_(base), it_(it), values_(&values) {}
+
+        //  the compact token this iterator refers to
+        compact_token const& compact() const { return *it_; }
+        compact_iterator compact_position() const { return it_; }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        token_type dereference() const
+        {
+            return token_type(base_, *it_, *values_);
+        }
+
+        bool equal(lazy_token_iterator const& rhs) const
+        {
+            return it_ == rhs.it_;
+        }
+
+        void increment() { ++it_; }
+        void decrement() { --it_; }
+
+        void advance(typename base_type::difference_type n)
+        {
+            it_ += n;
+        }
+
+        typename base_type::difference_type
+        distance_to(lazy_token_iterator const& rhs) const
+        {
+            return rhs.it_ - it_;
+        }
+
+        Iterator base_;
+        compact_iterator it_;
+        cache_type* values_;
+    };
+}}}}
+
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Extracting the value of a lazy_token, called from the parse function
+    //  of token_def and the other token parsers.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Attribute, typename Token, typename Iterator>
+    struct assign_to_attribute_from_value<Attribute
+      , lex::lexertl::lazy_token<Token, Iterator> >
+    {
+        static void
+        call(lex::lexertl::lazy_token<Token, Iterator> const& t
+          , Attribute& attr)
+        {
+            t.value(attr);
+        }
+    };
+
+    template <typename Attribute, typename Token, typename Iterator>
+    struct assign_to_container_from_value<Attribute
+          , lex::lexertl::lazy_token<Token, Iterator> >
+      : assign_to_attribute_from_value<Attribute
+          , lex::lexertl::lazy_token<Token, Iterator> >
+    {};
+
+    template <typename Token, typename Iterator>
+    struct assign_to_container_from_value<utree
+          , lex::lexertl::lazy_token<Token, Iterator> >
+      : assign_to_attribute_from_value<utree
+          , lex::lexertl::lazy_token<Token, Iterator> >
+    {};
+
+    //  This is called from the parse function of lexer_def_
+    template <typename Idtype_, typename Token, typename Iterator>
+    struct assign_to_attribute_from_value<
+        fusion::vector2<Idtype_, iterator_range<Iterator> >
+      , lex::lexertl::lazy_token<Token, Iterator> >
+    {
+        static void
+        call(lex::lexertl::lazy_token<Token, Iterator> const& t
+          , fusion::vector2<Idtype_, iterator_range<Iterator> >& attr)
+        {
+            typedef fusion::vector2<Idtype_, iterator_range<Iterator> >
+                attribute_type;
+            attr = attribute_type(t.id(), t.matched());
+        }
+    };
+
+    template <typename Idtype_, typename Token, typename Iterator>
+    struct assign_to_container_from_value<
+            fusion::vector2<Idtype_, iterator_range<Iterator> >
+          , lex::lexertl::lazy_token<Token, Iterator> >
+      : assign_to_attribute_from_value<
+            fusion::vector2<Idtype_, iterator_range<Iterator> >
+          , lex::lexertl::lazy_token<Token, Iterator> >
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Overload debug output for a single token, this integrates lazy tokens
+    // with Qi's simple_trace debug facilities
+    template <typename Token, typename Iterator>
+    struct token_printer_debug<lex::lexertl::lazy_token<Token, Iterator> >
+    {
+        typedef lex::lexertl::lazy_token<Token, Iterator> token_type;
+
+        template <typename Out>
+        static void print(Out& out, token_type const& val)
+        {
+            out << '[';
+            spirit::traits::print_token(out, val.matched());
+            out << ']';
+        }
+    };
+}}}
+
+#endif
@@ -21,6 +21,15 @@
 #include <boost/spirit/home/lex/lexer/lexertl/functor.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/functor_data.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/iterator.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/hash_rules.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token_vector.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/lazy_token.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/incremental_tokens.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/line_index.hpp>
+#if defined(BOOST_SPIRIT_THREADSAFE)
+#include <boost/spirit/home/lex/lexer/lexertl/parallel_build.hpp>
+#endif
 #if defined(BOOST_SPIRIT_LEXERTL_DEBUG)
 #include <boost/spirit/home/support/detail/lexer/debug.hpp>
 #endif
@@ -170,6 +179,17 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         typedef typename Token::id_type id_type;
         typedef iterator<Functor> iterator_type;
 
+        //  The iterator type usable for parsing the tokens stored by
+        //  tokenize() below.
+        typedef token_vector_iterator<Token, Iterator>
+            token_vector_iterator_type;
+
+        //  The iterator type exposing the tokens stored by tokenize() as
+        //  lazy tokens, converting the token values only when needed and
+        //  caching them in a token_value_cache_type.
+        typedef lazy_token_iterator<Token, Iterator> lazy_token_iterator_type;
+        typedef token_value_cache<Token> token_value_cache_type;
+
     private:
         // this type is purely used for the iterator_type construction below
         struct iterator_data_type
@@ -177,13 +197,13 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             typedef typename Functor::semantic_actions_type semantic_actions_type;
 
             iterator_data_type(
-                    boost::lexer::basic_state_machine<char_type> const& sm
+                    packed_state_machine<char_type> const& sm
                   , boost::lexer::basic_rules<char_type> const& rules
                   , semantic_actions_type const& actions)
               : state_machine_(sm), rules_(rules), actions_(actions)
             {}
 
-            boost::lexer::basic_state_machine<char_type> const& state_machine_;
+            packed_state_machine<char_type> const& state_machine_;
             boost::lexer::basic_rules<char_type> const& rules_;
             semantic_actions_type const& actions_;
 
@@ -201,7 +221,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             if (!init_dfa())    // never minimize DFA for dynamic lexers
                 return iterator_type();
 
-            iterator_data_type iterator_data(state_machine_, rules_, actions_);
+            iterator_data_type iterator_data(packed_state_machine_, rules_
+              , actions_);
             return iterator_type(iterator_data, first, last, initial_state);
         }
 
@@ -212,12 +233,82 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             return iterator_type();
         }
 
+        //  Tokenize the whole input [first, last) at once, appending the
+        //  tokens to the given vector (see tokenize_all). Iterator has to
+        //  be a random access iterator, semantic actions are not invoked.
+        //  Returns true if all of the input has been tokenized, otherwise
+        //  the tokens up to the first unmatched character are stored.
+        bool tokenize(Iterator const& first, Iterator const& last
+          , std::vector<compact_token>& tokens
+          , char_type const* initial_state = 0) const
+        {
+            if (!init_dfa())    // never minimize DFA for dynamic lexers
+                return false;
+
+            std::size_t state = 0;
+            if (0 != initial_state)
+            {
+                state = rules_.state(initial_state);
+                if (boost::lexer::npos == state)
+                    return false;
+            }
+            return tokenize_all(packed_state_machine_, first, last, tokens
+              , state) == last;
+        }
+
+        //  Tokenize the whole input [first, last) into 'tokens', which can be
+        //  kept up to date by retokenize() below while the input is edited.
+        //  Returns true if all of the input has been tokenized.
+        bool tokenize(Iterator const& first, Iterator const& last
+          , incremental_tokens& tokens, char_type const* initial_state = 0) const
+        {
+            if (!init_dfa())    // never minimize DFA for dynamic lexers
+                return false;
+
+            std::size_t state = 0;
+            if (0 != initial_state)
+            {
+                state = rules_.state(initial_state);
+                if (boost::lexer::npos == state)
+                    return false;
+            }
+            return tokens.tokenize(packed_state_machine_, first, last
+              , state).complete;
+        }
+
+        //  Update 'tokens' after the 'erased' characters at 'offset' of the
+        //  input tokenized before have been replaced by the 'inserted'
+        //  characters at 'offset' of [first, last), matching again only the
+        //  tokens affected by the edit (see incremental_tokens). Returns the
+        //  range of tokens which has been replaced.
+        changed_tokens retokenize(Iterator const& first, Iterator const& last
+          , incremental_tokens& tokens, std::size_t offset
+          , std::size_t erased, std::size_t inserted
+          , char_type const* initial_state = 0) const
+        {
+            if (!init_dfa())    // never minimize DFA for dynamic lexers
+                return changed_tokens();
+
+            std::size_t state = 0;
+            if (0 != initial_state)
+            {
+                state = rules_.state(initial_state);
+                if (boost::lexer::npos == state)
+                    return changed_tokens();
+            }
+            return tokens.retokenize(packed_state_machine_, first, last
+              , offset, erased, inserted, state);
+        }
+
     protected:
         //  Lexer instances can be created by means of a derived class only.
         lexer(unsigned int flags)
           : flags_(detail::map_flags(flags))
           , rules_(flags_)
           , initialized_dfa_(false)
+#if defined(BOOST_SPIRIT_THREADSAFE)
+          , build_threads_(1)
+#endif
         {}
 
     public:
@@ -330,10 +421,23 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         {
             if (!initialized_dfa_) {
                 state_machine_.clear();
-                typedef boost::lexer::basic_generator<char_type> generator;
-                generator::build (rules_, state_machine_);
-                if (minimize)
-                    generator::minimise (state_machine_);
+#if defined(BOOST_SPIRIT_THREADSAFE)
+                if (1 != build_threads_)
+                {
+                    build_parallel(rules_, state_machine_, minimize
+                      , build_threads_);
+                }
+                else
+#endif
+                {
+                    typedef boost::lexer::basic_generator<char_type> generator;
+                    generator::build (rules_, state_machine_);
+                    if (minimize)
+                        generator::minimise (state_machine_);
+                }
+
+                // the tokenizer uses a compact copy of the tables
+                packed_state_machine_.pack(state_machine_);
 
 #if defined(BOOST_SPIRIT_LEXERTL_DEBUG)
                 boost::lexer::debug::dump(state_machine_, std::cerr);
@@ -348,14 +452,60 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             return true;
         }
 
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+        //  The matches and the semantic actions of an actor_lexer counted
+        //  and timed since it was constructed or the profile was cleared.
+        lexer_profile const& profile() const { return actions_.profile_; }
+        void clear_profile() { actions_.profile_.clear(); }
+
+#endif
+        //  Write the DFA of this lexer to the given stream (opened in binary
+        //  mode), tagged with a hash of the token definitions. The DFA is
+        //  built first if necessary (and minimized if requested).
+        bool save_dfa(std::ostream& os, bool minimize = true) const
+        {
+            if (!init_dfa(minimize))
+                return false;
+            return packed_state_machine_.save(os, hash_rules(rules_));
+        }
+
+        //  Use the DFA written by save_dfa to the given memory (for instance
+        //  a memory mapped file, aligned to 8 bytes) instead of building it,
+        //  if it has been saved for the very same token definitions. The
+        //  tables are used in place, so the memory has to outlive the lexer.
+        //  Returns false if the data can't be used, the DFA is built on first
+        //  use then as usual.
+        bool load_dfa(void const* data, std::size_t size)
+        {
+            state_machine_.clear();
+            initialized_dfa_ = packed_state_machine_.load(data, size
+              , hash_rules(rules_));
+            return initialized_dfa_;
+        }
+
+#if defined(BOOST_SPIRIT_THREADSAFE)
+        //  Build the DFAs of the lexer states concurrently using the given
+        //  number of threads (0: one per hardware thread) whenever the DFA
+        //  is built (see build_parallel). The result is the same as when
+        //  building them one after the other, which is the default (1).
+        void build_threads(std::size_t threads)
+        {
+            build_threads_ = threads;
+        }
+#endif
+
     private:
         // lexertl specific data
         mutable boost::lexer::basic_state_machine<char_type> state_machine_;
+        mutable packed_state_machine<char_type> packed_state_machine_;
         boost::lexer::regex_flags flags_;
         /*mutable*/ basic_rules_type rules_;
 
         typename Functor::semantic_actions_type actions_;
         mutable bool initialized_dfa_;
+#if defined(BOOST_SPIRIT_THREADSAFE)
+        std::size_t build_threads_;
+#endif
 
         // generator functions must be able to access members directly
         template <typename Lexer, typename F>
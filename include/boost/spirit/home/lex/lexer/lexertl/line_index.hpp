@@ -0,0 +1,145 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_LINE_INDEX_OCT_19_2026_0815PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_LINE_INDEX_OCT_19_2026_0815PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/lex/lexer/lexertl/scan.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token_vector.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  line_index holds the offsets of all line ends ('\n') of an input,
+    //  giving the line and column of any position of it, for instance of
+    //  the compact tokens stored by lexer::tokenize:
+    //
+    //      std::vector<lexertl::compact_token> tokens;
+    //      lexer.tokenize(first, last, tokens);
+    //
+    //      lexertl::line_index lines(first, last);
+    //      std::vector<boost::uint32_t> token_lines;
+    //      lines.lines(tokens, token_lines);
+    //
+    //  This is an alternative to tokenizing through a line_pos_iterator,
+    //  which updates the line number on every character the DFA looks at.
+    //  Here the input is searched for line ends once (16 characters at a
+    //  time if SSE2 is available and the input is contiguous), and the
+    //  lines are assigned to the tokens in one pass over both. Lines and
+    //  columns are numbered from 1, the columns count characters. Unlike
+    //  with line_pos_iterator, a '\r' on its own doesn't end a line.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    class line_index
+    {
+    public:
+        typedef std::vector<boost::uint32_t> offset_vector_type;
+
+        line_index() {}
+
+        template <typename Iterator>
+        line_index(Iterator const& first, Iterator const& last)
+        {
+            build(first, last);
+        }
+
+        //  Find the line ends of [first, last), which is limited to 4GB
+        //  (see compact_token).
+        template <typename Iterator>
+        void build(Iterator const& first, Iterator const& last)
+        {
+            typedef typename
+                detail::is_contiguous_narrow_iterator<Iterator>::type
+            contiguous;
+
+            newlines_.clear();
+            build(first, last, contiguous());
+        }
+
+        //  the offsets of the line ends
+        offset_vector_type const& newlines() const { return newlines_; }
+
+        //  the number of lines, the last one possibly being empty
+        std::size_t size() const { return newlines_.size() + 1; }
+
+        //  the line and the column of the character at 'offset'
+        std::size_t line(std::size_t offset) const
+        {
+            return std::lower_bound(newlines_.begin(), newlines_.end()
+              , offset) - newlines_.begin() + 1;
+        }
+
+        std::size_t column(std::size_t offset) const
+        {
+            return offset - line_start(line(offset)) + 1;
+        }
+
+        //  the offset of the first character of the given line
+        std::size_t line_start(std::size_t line) const
+        {
+            return (line <= 1) ? 0 : newlines_[line - 2] + 1;
+        }
+
+        //  Store the line of the first character of each of the given tokens,
+        //  which have to be sorted by their offsets, in 'lines' (replacing
+        //  its content).
+        void lines(std::vector<compact_token> const& tokens
+          , offset_vector_type& lines) const
+        {
+            lines.resize(tokens.size());
+
+            offset_vector_type::const_iterator newline = newlines_.begin();
+            offset_vector_type::const_iterator const end = newlines_.end();
+            boost::uint32_t line = 1;
+            for (std::size_t i = 0; i != tokens.size(); ++i)
+            {
+                //  most tokens don't end a line
+                boost::uint32_t const offset = tokens[i].offset;
+                while (newline != end && *newline < offset)
+                {
+                    ++newline;
+                    ++line;
+                }
+                lines[i] = line;
+            }
+        }
+
+    private:
+        template <typename Iterator>
+        void build(Iterator const& first, Iterator const& last, mpl::true_)
+        {
+            if (first == last)
+                return;
+
+            char const* const begin = reinterpret_cast<char const*>(&*first);
+            newlines_.reserve((last - first) / 32);
+            detail::find_all(begin, begin, begin + (last - first), '\n'
+              , newlines_);
+        }
+
+        template <typename Iterator>
+        void build(Iterator first, Iterator const& last, mpl::false_)
+        {
+            for (boost::uint32_t offset = 0; first != last; ++first, ++offset)
+            {
+                if (*first == '\n')
+                    newlines_.push_back(offset);
+            }
+        }
+
+        offset_vector_type newlines_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,717 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_PACKED_STATE_MACHINE_OCT_19_2026_0412PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_PACKED_STATE_MACHINE_OCT_19_2026_0412PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  packed_state_machine is a compact copy of the tables of a lexertl
+    //  state machine (boost::lexer::basic_state_machine), which is what the
+    //  dynamic lexer uses for tokenizing (see basic_iterator_tokeniser).
+    //
+    //  In the tables of lexertl every cell is a std::size_t, and the rows of
+    //  the transition matrix start with the columns describing the state
+    //  (end state, token id, unique id, lexer state, BOL and EOL
+    //  transitions). In the packed tables
+    //
+    //    - the character lookup and the transition matrix use the smallest
+    //      of 8, 16 or 32 bit indices which can hold every state and column
+    //      index of the DFA of a lexer state,
+    //    - the rows of the transition matrix hold transitions only. The
+    //      states are renumbered such that the accepting states come first
+    //      (1 .. accepting()), their token ids are kept separately,
+    //    - the BOL and EOL transitions are kept separately as well, and only
+    //      for the DFAs having any,
+    //    - for narrow characters, the states looping on all characters but
+    //      at most three are marked, such that the tokenizer can skip runs
+    //      of these (comments, string literals) by searching for the next
+    //      exit (see scan_info).
+    //
+    //  The packed tables can be saved in a binary format (see save), and
+    //  loaded again without building the DFA. The character lookup and the
+    //  transition matrix are used in place when loading, i.e. directly from
+    //  a memory mapped file.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    class packed_state_machine
+    {
+        enum { header_size = 56, byte_order = 0x01020304 };
+
+        static char const* magic()
+        {
+            return "SPXLDFA";   // including the terminating '\0'
+        }
+
+        static std::size_t padded(std::size_t size)
+        {
+            return (size + 7) & ~std::size_t(7);
+        }
+
+        static void write(std::ostream& os, boost::uint64_t value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+
+        static void write(std::ostream& os, void const* data, std::size_t size)
+        {
+            static char const zeros[8] = { 0 };
+            os.write(static_cast<char const*>(data), size);
+            os.write(zeros, padded(size) - size);
+        }
+
+        // reads the words and tables of the binary format
+        struct reader
+        {
+            reader(char const* first, char const* last)
+              : first(first), last(last) {}
+
+            std::size_t remaining() const { return last - first; }
+
+            bool get(std::size_t& value)
+            {
+                boost::uint64_t word = 0;
+                if (remaining() < sizeof(word))
+                    return false;
+
+                std::memcpy(&word, first, sizeof(word));
+                first += sizeof(word);
+                value = static_cast<std::size_t>(word);
+                return value == word;
+            }
+
+            template <typename Index>
+            bool get(Index const*& table, std::size_t count)
+            {
+                if (count > remaining() / sizeof(Index) ||
+                    padded(count * sizeof(Index)) > remaining())
+                {
+                    return false;
+                }
+
+                table = reinterpret_cast<Index const*>(first);
+                first += padded(count * sizeof(Index));
+                return true;
+            }
+
+            char const* first;
+            char const* last;
+        };
+
+    public:
+        typedef Char char_type;
+
+        // what is known about an accepting state
+        struct accept_info
+        {
+            std::size_t id;
+            std::size_t unique_id;
+            std::size_t next_state;     // the lexer state to switch to
+        };
+
+        // a state looping on every character except the 'exits' (0 .. 3)
+        // given characters, the unused entries of 'chars' repeat the last
+        // exit. States with BOL or EOL transitions are never scanned.
+        enum { max_scan_exits = 3 };
+
+        struct scan_info
+        {
+            scan_info() : scan(false), exits(0)
+            {
+                chars[0] = chars[1] = chars[2] = 0;
+            }
+
+            bool scan;
+            unsigned char exits;
+            unsigned char chars[max_scan_exits];
+        };
+
+        // the character lookup and the transition matrix of a DFA, using
+        // state and column indices of type Index
+        template <typename Index>
+        struct tables
+        {
+            tables() : lookup(0), transitions(0) {}
+
+            tables(tables const& rhs)
+              : lookup(rhs.lookup), transitions(rhs.transitions)
+              , lookup_data(rhs.lookup_data)
+              , transitions_data(rhs.transitions_data)
+            {
+                if (!lookup_data.empty())
+                {
+                    lookup = &lookup_data.front();
+                    transitions = &transitions_data.front();
+                }
+            }
+
+            tables& operator=(tables const& rhs)
+            {
+                tables copy(rhs);
+                swap(copy);
+                return *this;
+            }
+
+            void swap(tables& rhs)
+            {
+                std::swap(lookup, rhs.lookup);
+                std::swap(transitions, rhs.transitions);
+                lookup_data.swap(rhs.lookup_data);
+                transitions_data.swap(rhs.transitions_data);
+            }
+
+            // these point into the vectors below, or into the memory the
+            // tables have been loaded from
+            Index const* lookup;
+            Index const* transitions;
+
+            std::vector<Index> lookup_data;
+            std::vector<Index> transitions_data;
+        };
+
+        // the packed DFA of a single lexer state
+        class dfa
+        {
+        public:
+            dfa()
+              : width_(0), columns_(0), states_(0), start_(0), accepting_(0)
+              , lookup_size_(0)
+            {}
+
+            // the size of the state and column indices in bytes (1, 2 or 4)
+            std::size_t width() const { return width_; }
+
+            // the number of columns of the transition matrix, the number of
+            // states (including the dead state 0), the start state (0 if the
+            // lexer state has no token definitions), and the number of
+            // accepting states
+            std::size_t columns() const { return columns_; }
+            std::size_t states() const { return states_; }
+            std::size_t start() const { return start_; }
+            std::size_t accepting() const { return accepting_; }
+
+            bool is_accepting(std::size_t state) const
+            {
+                return state != 0 && state <= accepting_;
+            }
+            accept_info const& accept(std::size_t state) const
+            {
+                return accept_[state - 1];
+            }
+
+            // BOL and EOL transitions (0 if there is none)
+            bool has_assertions() const { return !bol_.empty(); }
+            std::size_t bol_state(std::size_t state) const { return bol_[state]; }
+            std::size_t eol_state(std::size_t state) const { return eol_[state]; }
+
+            // the states to skip runs of characters of (if there are any)
+            bool has_scans() const { return !scans_.empty(); }
+            scan_info const& scan(std::size_t state) const
+            {
+                return scans_[state];
+            }
+
+            tables<boost::uint8_t> const& get(boost::uint8_t) const
+            {
+                return tables8_;
+            }
+            tables<boost::uint16_t> const& get(boost::uint16_t) const
+            {
+                return tables16_;
+            }
+            tables<boost::uint32_t> const& get(boost::uint32_t) const
+            {
+                return tables32_;
+            }
+
+            // the memory used by the tables in bytes
+            std::size_t table_size() const
+            {
+                return width_ * (lookup_size_ + columns_ * states_)
+                  + accept_.size() * sizeof(accept_info)
+                  + (bol_.size() + eol_.size()) * sizeof(std::size_t)
+                  + scans_.size() * sizeof(scan_info);
+            }
+
+        private:
+            friend class packed_state_machine;
+
+            void pack(std::vector<std::size_t> const& lookup
+              , std::size_t alphabet, std::vector<std::size_t> const& rows)
+            {
+                using boost::lexer::dead_state_index;
+
+                states_ = (alphabet != 0) ? rows.size() / alphabet : 0;
+                if (states_ == 0)
+                    return;     // no token definitions for this lexer state
+
+                columns_ = alphabet - dead_state_index;
+
+                // renumber the states, accepting states first
+                std::vector<std::size_t> number(states_, 0);
+                std::size_t next = 1;
+                for (std::size_t s = 1; s != states_; ++s)
+                {
+                    if (rows[s * alphabet + boost::lexer::end_state_index])
+                        number[s] = next++;
+                }
+                accepting_ = next - 1;
+                for (std::size_t s = 1; s != states_; ++s)
+                {
+                    if (!rows[s * alphabet + boost::lexer::end_state_index])
+                        number[s] = next++;
+                }
+                start_ = number[1];
+
+                bool assertions = false;
+                accept_.resize(accepting_);
+                for (std::size_t s = 1; s != states_; ++s)
+                {
+                    std::size_t const* row = &rows[s * alphabet];
+                    if (row[boost::lexer::end_state_index])
+                    {
+                        accept_info& info = accept_[number[s] - 1];
+                        info.id = row[boost::lexer::id_index];
+                        info.unique_id = row[boost::lexer::unique_id_index];
+                        info.next_state = row[boost::lexer::state_index];
+                    }
+                    if (row[boost::lexer::bol_index] || row[boost::lexer::eol_index])
+                        assertions = true;
+                }
+
+                if (assertions)
+                {
+                    bol_.resize(states_, 0);
+                    eol_.resize(states_, 0);
+                    for (std::size_t s = 1; s != states_; ++s)
+                    {
+                        std::size_t const* row = &rows[s * alphabet];
+                        bol_[number[s]] = number[row[boost::lexer::bol_index]];
+                        eol_[number[s]] = number[row[boost::lexer::eol_index]];
+                    }
+                }
+
+                std::size_t const largest = (std::max)(states_, columns_) - 1;
+                if (largest <= 0xff)
+                    fill(tables8_, lookup, alphabet, rows, number);
+                else if (largest <= 0xffff)
+                    fill(tables16_, lookup, alphabet, rows, number);
+                else
+                    fill(tables32_, lookup, alphabet, rows, number);
+            }
+
+            template <typename Index>
+            void fill(tables<Index>& t, std::vector<std::size_t> const& lookup
+              , std::size_t alphabet, std::vector<std::size_t> const& rows
+              , std::vector<std::size_t> const& number)
+            {
+                using boost::lexer::dead_state_index;
+
+                width_ = sizeof(Index);
+                lookup_size_ = lookup.size();
+
+                t.lookup_data.resize(lookup.size());
+                for (std::size_t c = 0; c != lookup.size(); ++c)
+                {
+                    t.lookup_data[c] =
+                        static_cast<Index>(lookup[c] - dead_state_index);
+                }
+
+                t.transitions_data.resize(states_ * columns_, 0);
+                for (std::size_t s = 1; s != states_; ++s)
+                {
+                    std::size_t const* row = &rows[s * alphabet + dead_state_index];
+                    Index* packed = &t.transitions_data[number[s] * columns_];
+                    for (std::size_t c = 0; c != columns_; ++c)
+                        packed[c] = static_cast<Index>(number[row[c]]);
+                }
+
+                t.lookup = &t.lookup_data.front();
+                t.transitions = &t.transitions_data.front();
+                find_scans(t);
+            }
+
+            // mark the states looping on all but a few characters, these
+            // are not saved but found again when loading the tables
+            template <typename Index>
+            void find_scans(tables<Index> const& t)
+            {
+                scans_.clear();
+                if (sizeof(Char) != 1)
+                    return;
+
+                // the number of characters mapped to each column
+                std::vector<std::size_t> chars(columns_, 0);
+                for (std::size_t c = 0; c != lookup_size_; ++c)
+                    ++chars[t.lookup[c]];
+
+                std::vector<scan_info> scans(states_);
+                bool found = false;
+                for (std::size_t s = 1; s != states_; ++s)
+                {
+                    if (has_assertions() && (bol_[s] != 0 || eol_[s] != 0))
+                        continue;
+
+                    Index const* row = t.transitions + s * columns_;
+                    std::size_t exits = 0;
+                    for (std::size_t c = 0; c != columns_; ++c)
+                    {
+                        if (row[c] != s)
+                            exits += chars[c];
+                    }
+                    if (exits > max_scan_exits)
+                        continue;
+
+                    scan_info& info = scans[s];
+                    info.scan = true;
+                    info.exits = static_cast<unsigned char>(exits);
+                    for (std::size_t c = 0, n = 0; c != lookup_size_; ++c)
+                    {
+                        if (row[t.lookup[c]] != s)
+                            info.chars[n++] = static_cast<unsigned char>(c);
+                    }
+                    for (std::size_t n = exits; n != 0 && n != max_scan_exits; ++n)
+                        info.chars[n] = info.chars[n - 1];
+                    found = true;
+                }
+
+                if (found)
+                    scans_.swap(scans);
+            }
+
+            tables<boost::uint8_t>& get(boost::uint8_t)
+            {
+                return tables8_;
+            }
+            tables<boost::uint16_t>& get(boost::uint16_t)
+            {
+                return tables16_;
+            }
+            tables<boost::uint32_t>& get(boost::uint32_t)
+            {
+                return tables32_;
+            }
+
+            // the number of bytes written by save
+            std::size_t binary_size() const
+            {
+                return 7 * 8 + accept_.size() * 3 * 8
+                  + (bol_.size() + eol_.size()) * 8
+                  + padded(lookup_size_ * width_)
+                  + padded(states_ * columns_ * width_);
+            }
+
+            void save(std::ostream& os) const
+            {
+                write(os, width_);
+                write(os, columns_);
+                write(os, states_);
+                write(os, start_);
+                write(os, accepting_);
+                write(os, has_assertions() ? 1 : 0);
+                write(os, lookup_size_);
+
+                for (std::size_t i = 0; i != accept_.size(); ++i)
+                {
+                    write(os, accept_[i].id);
+                    write(os, accept_[i].unique_id);
+                    write(os, accept_[i].next_state);
+                }
+                for (std::size_t i = 0; i != bol_.size(); ++i)
+                    write(os, bol_[i]);
+                for (std::size_t i = 0; i != eol_.size(); ++i)
+                    write(os, eol_[i]);
+
+                switch (width_) {
+                case 1: save(os, tables8_); break;
+                case 2: save(os, tables16_); break;
+                case 4: save(os, tables32_); break;
+                default: break;     // no token definitions
+                }
+            }
+
+            template <typename Index>
+            void save(std::ostream& os, tables<Index> const& t) const
+            {
+                write(os, t.lookup, lookup_size_ * sizeof(Index));
+                write(os, t.transitions, states_ * columns_ * sizeof(Index));
+            }
+
+            bool load(reader& r, std::size_t dfas)
+            {
+                std::size_t assertions = 0;
+                if (!r.get(width_) || !r.get(columns_) || !r.get(states_) ||
+                    !r.get(start_) || !r.get(accepting_) ||
+                    !r.get(assertions) || !r.get(lookup_size_))
+                {
+                    return false;
+                }
+
+                if (states_ == 0)
+                {
+                    // no token definitions for this lexer state
+                    return width_ == 0 && columns_ == 0 && start_ == 0 &&
+                        accepting_ == 0 && assertions == 0 &&
+                        lookup_size_ == 0;
+                }
+
+                std::size_t const lookup_size = (sizeof(Char) == 1) ?
+                    boost::lexer::num_chars : boost::lexer::num_wchar_ts;
+                if (start_ == 0 || start_ >= states_ || accepting_ >= states_ ||
+                    columns_ == 0 || assertions > 1 ||
+                    lookup_size_ != lookup_size ||
+                    states_ > r.remaining() || accepting_ > r.remaining() ||
+                    columns_ > r.remaining() / states_)
+                {
+                    return false;
+                }
+
+                accept_.resize(accepting_);
+                for (std::size_t i = 0; i != accepting_; ++i)
+                {
+                    accept_info& info = accept_[i];
+                    if (!r.get(info.id) || !r.get(info.unique_id) ||
+                        !r.get(info.next_state) || info.next_state >= dfas)
+                    {
+                        return false;
+                    }
+                }
+
+                if (assertions)
+                {
+                    bol_.resize(states_);
+                    eol_.resize(states_);
+                    for (std::size_t i = 0; i != states_; ++i)
+                    {
+                        if (!r.get(bol_[i]) || bol_[i] >= states_)
+                            return false;
+                    }
+                    for (std::size_t i = 0; i != states_; ++i)
+                    {
+                        if (!r.get(eol_[i]) || eol_[i] >= states_)
+                            return false;
+                    }
+                }
+
+                switch (width_) {
+                case 1: return load(r, tables8_);
+                case 2: return load(r, tables16_);
+                case 4: return load(r, tables32_);
+                default: break;
+                }
+                return false;
+            }
+
+            // the character lookup and the transition matrix are used in
+            // place, but are checked for out of range indices
+            template <typename Index>
+            bool load(reader& r, tables<Index>& t)
+            {
+                if (!r.get(t.lookup, lookup_size_) ||
+                    !r.get(t.transitions, states_ * columns_))
+                {
+                    return false;
+                }
+
+                for (std::size_t i = 0; i != lookup_size_; ++i)
+                {
+                    if (t.lookup[i] >= columns_)
+                        return false;
+                }
+                for (std::size_t i = 0; i != states_ * columns_; ++i)
+                {
+                    if (t.transitions[i] >= states_)
+                        return false;
+                }
+
+                find_scans(t);
+                return true;
+            }
+
+            std::size_t width_;
+            std::size_t columns_;
+            std::size_t states_;
+            std::size_t start_;
+            std::size_t accepting_;
+            std::size_t lookup_size_;
+
+            std::vector<accept_info> accept_;
+            std::vector<std::size_t> bol_;
+            std::vector<std::size_t> eol_;
+            std::vector<scan_info> scans_;
+
+            tables<boost::uint8_t> tables8_;
+            tables<boost::uint16_t> tables16_;
+            tables<boost::uint32_t> tables32_;
+        };
+
+        packed_state_machine() : seen_bol_assertion_(false) {}
+
+        explicit packed_state_machine(
+                boost::lexer::basic_state_machine<Char> const& state_machine)
+          : seen_bol_assertion_(false)
+        {
+            pack(state_machine);
+        }
+
+        // (re-)build the packed tables from the given state machine
+        void pack(boost::lexer::basic_state_machine<Char> const& state_machine)
+        {
+            boost::lexer::detail::internals const& internals =
+                state_machine.data();
+
+            std::size_t const size = internals._dfa->size();
+            std::vector<dfa>(size).swap(dfas_);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                dfas_[i].pack(*internals._lookup[i]
+                  , internals._dfa_alphabet[i], *internals._dfa[i]);
+            }
+            seen_bol_assertion_ = internals._seen_BOL_assertion;
+        }
+
+        void clear()
+        {
+            dfas_.clear();
+            seen_bol_assertion_ = false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //
+        //  The binary format written by save consists of 64 bit words in the
+        //  byte order of the writing machine:
+        //
+        //    - the header: the magic "SPXLDFA\0", the format version and a
+        //      byte order mark (32 bit each), the size of a character, the
+        //      hash passed to save, the number of DFAs, whether a BOL
+        //      assertion has been seen, and the size of the data in bytes,
+        //    - for every DFA: the width of the indices, the number of
+        //      columns, states and accepting states, the start state, whether
+        //      there are BOL/EOL transitions, and the size of the character
+        //      lookup, followed by the token id, unique id and lexer state of
+        //      every accepting state, the BOL and EOL transitions (if any),
+        //      and finally the character lookup and the transition matrix
+        //      using indices of the given width, each padded to 8 bytes.
+        //
+        ///////////////////////////////////////////////////////////////////////
+        enum { binary_version = 1 };
+
+        // write the tables to the given stream (which has to be opened in
+        // binary mode) together with the given hash of the rules the state
+        // machine has been built from (see hash_rules)
+        bool save(std::ostream& os, boost::uint64_t hash) const
+        {
+            std::size_t size = header_size;
+            for (std::size_t i = 0; i != dfas_.size(); ++i)
+                size += dfas_[i].binary_size();
+
+            os.write(magic(), 8);
+            boost::uint32_t const version[2] = { binary_version, byte_order };
+            os.write(reinterpret_cast<char const*>(version), sizeof(version));
+            write(os, sizeof(Char));
+            write(os, hash);
+            write(os, dfas_.size());
+            write(os, seen_bol_assertion_ ? 1 : 0);
+            write(os, size);
+
+            for (std::size_t i = 0; i != dfas_.size(); ++i)
+                dfas_[i].save(os);
+
+            return os.good();
+        }
+
+        // use the tables saved in the given memory (aligned to 8 bytes) if
+        // those have been saved with the given hash by a compatible machine.
+        // The character lookup and the transition matrix are not copied, the
+        // memory has to outlive this object (and its copies). Returns false
+        // (leaving this object empty) if the data can't be used.
+        bool load(void const* data, std::size_t size, boost::uint64_t hash)
+        {
+            clear();
+            if (load_binary(static_cast<char const*>(data), size, hash))
+                return true;
+
+            clear();
+            return false;
+        }
+
+        bool empty() const { return dfas_.empty(); }
+
+        // the number of lexer states, and the DFA of each of them
+        std::size_t size() const { return dfas_.size(); }
+        dfa const& operator[](std::size_t state) const { return dfas_[state]; }
+
+        bool seen_bol_assertion() const { return seen_bol_assertion_; }
+
+        // the memory used by the tables of all DFAs in bytes
+        std::size_t table_size() const
+        {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != dfas_.size(); ++i)
+                size += dfas_[i].table_size();
+            return size;
+        }
+
+    private:
+        bool load_binary(char const* data, std::size_t size
+          , boost::uint64_t hash)
+        {
+            if (size < header_size ||
+                reinterpret_cast<std::size_t>(data) % 8 != 0 ||
+                std::memcmp(data, magic(), 8) != 0)
+            {
+                return false;
+            }
+
+            boost::uint32_t version[2] = { 0, 0 };
+            std::memcpy(version, data + 8, sizeof(version));
+            if (version[0] != binary_version || version[1] != byte_order)
+                return false;
+
+            boost::uint64_t header[2] = { 0, 0 };   // character size, hash
+            std::memcpy(header, data + 16, sizeof(header));
+            if (header[0] != sizeof(Char) || header[1] != hash)
+                return false;
+
+            reader r(data + 32, data + size);
+            std::size_t dfas = 0, seen_bol = 0, data_size = 0;
+            if (!r.get(dfas) || !r.get(seen_bol) || !r.get(data_size) ||
+                data_size != size || dfas > r.remaining())
+            {
+                return false;
+            }
+
+            std::vector<dfa>(dfas).swap(dfas_);
+            for (std::size_t i = 0; i != dfas; ++i)
+            {
+                if (!dfas_[i].load(r, dfas))
+                    return false;
+            }
+            seen_bol_assertion_ = seen_bol != 0;
+            return r.remaining() == 0;
+        }
+
+        std::vector<dfa> dfas_;
+        bool seen_bol_assertion_;
+    };
+
+}}}}
+
+#endif
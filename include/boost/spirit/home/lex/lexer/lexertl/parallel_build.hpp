@@ -0,0 +1,178 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_PARALLEL_BUILD_OCT_19_2026_0512PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_PARALLEL_BUILD_OCT_19_2026_0512PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        //  the work shared by the threads building the DFAs, every thread
+        //  takes the next lexer state to build until all are done
+        template <typename Char>
+        class parallel_build
+        {
+        public:
+            typedef boost::lexer::basic_generator<Char> generator;
+            typedef boost::lexer::basic_rules<Char> rules_type;
+            typedef boost::lexer::basic_state_machine<Char> state_machine_type;
+
+            parallel_build(rules_type const& rules
+                  , state_machine_type& state_machine, bool minimise)
+              : rules_(rules), state_machine_(state_machine)
+              , minimise_(minimise), next_(0)
+              , states_(rules.statemap().size())
+              , seen_bol_(states_.size(), 0), seen_eol_(states_.size(), 0)
+              , errors_(states_.size())
+            {
+                //  the states with the most rules first, which keeps the
+                //  threads busy until the end
+                for (std::size_t i = 0; i != states_.size(); ++i)
+                    states_[i] = i;
+                std::stable_sort(states_.begin(), states_.end()
+                  , more_rules(rules));
+            }
+
+            void run()
+            {
+                for (std::size_t state = next(); state != states_.size();
+                     state = next())
+                {
+                    try {
+                        bool bol = false, eol = false;
+                        generator::build_state(rules_, state_machine_, state
+                          , bol, eol);
+                        if (minimise_)
+                            generator::minimise_state(state_machine_, state);
+
+                        seen_bol_[state] = bol;
+                        seen_eol_[state] = eol;
+                    }
+                    catch (...) {
+                        errors_[state] = boost::current_exception();
+                    }
+                }
+            }
+
+            //  rethrow the error of the first failing state (if any), as
+            //  the sequential build would have done, and set the
+            //  assertion flags of the state machine
+            void finish()
+            {
+                bool bol = false, eol = false;
+                for (std::size_t i = 0; i != errors_.size(); ++i)
+                {
+                    if (errors_[i])
+                        boost::rethrow_exception(errors_[i]);
+
+                    bol = bol || seen_bol_[i];
+                    eol = eol || seen_eol_[i];
+                }
+                generator::set_assertions(state_machine_, bol, eol);
+            }
+
+        private:
+            struct more_rules
+            {
+                more_rules(rules_type const& rules) : rules_(rules) {}
+
+                bool operator()(std::size_t lhs, std::size_t rhs) const
+                {
+                    return rules_.regexes()[lhs].size() >
+                        rules_.regexes()[rhs].size();
+                }
+
+                rules_type const& rules_;
+            };
+
+            //  the next state to build, states_.size() if there is none
+            std::size_t next()
+            {
+                boost::mutex::scoped_lock lock(mutex_);
+                return (next_ == states_.size()) ?
+                    next_ : states_[next_++];
+            }
+
+            rules_type const& rules_;
+            state_machine_type& state_machine_;
+            bool const minimise_;
+
+            boost::mutex mutex_;
+            std::size_t next_;
+            std::vector<std::size_t> states_;
+
+            //  written by one thread per state, read after all have ended
+            std::vector<char> seen_bol_;
+            std::vector<char> seen_eol_;
+            std::vector<boost::exception_ptr> errors_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  Generate the DFAs of all lexer states of the given rules into the
+    //  state machine (and minimise them, if requested) using up to
+    //  'threads' threads, one per hardware thread if it is 0. The DFA of
+    //  a lexer state depends on the rules of this state only, therefore
+    //  the result is identical to the one of the sequential
+    //  boost::lexer::generator::build (and minimise), just faster for
+    //  lexers having many states. The same goes for errors in the rules:
+    //  the exception thrown is the one for the first state in error.
+    //
+    //  This is used by the lexer if BOOST_SPIRIT_THREADSAFE is defined
+    //  (see lexer::build_threads) and requires linking with Boost.Thread.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    void build_parallel(boost::lexer::basic_rules<Char> const& rules
+      , boost::lexer::basic_state_machine<Char>& state_machine
+      , bool minimise = false, std::size_t threads = 0)
+    {
+        typedef boost::lexer::basic_generator<Char> generator;
+
+        if (0 == threads)
+            threads = boost::thread::hardware_concurrency();
+        if (threads > rules.statemap().size())
+            threads = rules.statemap().size();
+
+        generator::init(rules, state_machine);
+
+        detail::parallel_build<Char> build(rules, state_machine, minimise);
+        {
+            boost::thread_group group;
+            for (std::size_t i = 1; i < threads; ++i)
+            {
+                try {
+                    group.create_thread(boost::bind(
+                        &detail::parallel_build<Char>::run, &build));
+                }
+                catch (boost::thread_resource_error const&) {
+                    break;      // make do with the threads we've got
+                }
+            }
+            build.run();        // this thread helps, too
+            group.join_all();
+        }
+        build.finish();
+    }
+}}}}
+
+#endif
@@ -0,0 +1,219 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_PROFILE_OCT_19_2026_0902PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_PROFILE_OCT_19_2026_0902PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/lex/lexer/pass_flags.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  lexer_profile collects what an actor_lexer (or static_actor_lexer)
+    //  spends its time on, if BOOST_SPIRIT_LEXERTL_PROFILE is defined: for
+    //  every token definition in every lexer state the number of tokens
+    //  matched and their characters, the number of semantic actions invoked,
+    //  how often these made the match fail or the token ignored, and the time
+    //  spent in them. Without BOOST_SPIRIT_LEXERTL_PROFILE nothing is
+    //  collected and the lexer has no profile.
+    //
+    //      lexer.profile().report(std::cout);
+    //
+    //  Collecting is not synchronized, the lexer should be used by a single
+    //  thread while profiling. Timing the semantic actions requires linking
+    //  with Boost.Chrono.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    class lexer_profile
+    {
+    public:
+        typedef boost::chrono::high_resolution_clock clock_type;
+
+        struct entry
+        {
+            entry()
+              : state(0), unique_id(0), id(0), matches(0), characters(0)
+              , actions(0), failed(0), ignored(0), action_time(0)
+            {}
+
+            std::size_t state;
+            std::size_t unique_id;          // of the token definition
+            std::size_t id;                 // of the tokens, before actions
+            boost::uint64_t matches;
+            boost::uint64_t characters;
+            boost::uint64_t actions;
+            boost::uint64_t failed;         // pass_fail
+            boost::uint64_t ignored;        // pass_ignore
+            boost::uint64_t action_time;    // nanoseconds
+        };
+
+        //  times a semantic action and records its result on destruction
+        class scoped_action
+        {
+        public:
+            scoped_action(lexer_profile& profile, std::size_t state
+                  , std::size_t unique_id, BOOST_SCOPED_ENUM(pass_flags) const& pass)
+              : entry_(profile.get(state, unique_id)), pass_(pass)
+              , start_(clock_type::now())
+            {}
+
+            ~scoped_action()
+            {
+                entry_.action_time += boost::chrono::duration_cast<
+                    boost::chrono::nanoseconds>(clock_type::now() - start_)
+                        .count();
+                ++entry_.actions;
+                if (pass_flags::pass_fail == pass_)
+                    ++entry_.failed;
+                else if (pass_flags::pass_ignore == pass_)
+                    ++entry_.ignored;
+            }
+
+        private:
+            entry& entry_;
+            BOOST_SCOPED_ENUM(pass_flags) const& pass_;
+            clock_type::time_point const start_;
+
+            // silence MSVC warning C4512: assignment operator could not be generated
+            scoped_action& operator= (scoped_action const&);
+        };
+
+        //  a token has been matched by the given token definition
+        void match(std::size_t state, std::size_t unique_id, std::size_t id
+          , std::size_t characters)
+        {
+            entry& e = get(state, unique_id);
+            e.id = id;
+            ++e.matches;
+            e.characters += characters;
+        }
+
+        //  the entries of all token definitions having matched a token,
+        //  the ones having spent the most time in actions first, the ones
+        //  having matched the most tokens next
+        std::vector<entry> entries() const
+        {
+            std::vector<entry> result;
+            for (std::size_t s = 0; s != entries_.size(); ++s)
+            {
+                for (std::size_t u = 0; u != entries_[s].size(); ++u)
+                {
+                    if (entries_[s][u].matches != 0)
+                        result.push_back(entries_[s][u]);
+                }
+            }
+            std::stable_sort(result.begin(), result.end(), more_costly());
+            return result;
+        }
+
+        void clear()
+        {
+            entries_.clear();
+        }
+
+        //  Write a table of the entries to the given stream, followed by
+        //  the totals.
+        template <typename Char, typename Traits>
+        void report(std::basic_ostream<Char, Traits>& os) const
+        {
+            std::vector<entry> const all = entries();
+
+            os << "state" << std::setw(11) << "id"
+               << std::setw(11) << "matches" << std::setw(13) << "chars/token"
+               << std::setw(11) << "actions" << std::setw(11) << "failed"
+               << std::setw(11) << "ignored" << std::setw(13) << "action [ms]"
+               << std::setw(13) << "[ns]/action" << "\n";
+
+            entry total;
+            for (std::size_t i = 0; i != all.size(); ++i)
+            {
+                report(os, all[i], false);
+
+                total.matches += all[i].matches;
+                total.characters += all[i].characters;
+                total.actions += all[i].actions;
+                total.failed += all[i].failed;
+                total.ignored += all[i].ignored;
+                total.action_time += all[i].action_time;
+            }
+            report(os, total, true);
+        }
+
+    private:
+        entry& get(std::size_t state, std::size_t unique_id)
+        {
+            if (entries_.size() <= state)
+                entries_.resize(state + 1);
+
+            std::vector<entry>& entries = entries_[state];
+            if (entries.size() <= unique_id)
+            {
+                std::size_t const size = entries.size();
+                entries.resize(unique_id + 1);
+                for (std::size_t u = size; u != entries.size(); ++u)
+                {
+                    entries[u].state = state;
+                    entries[u].unique_id = u;
+                }
+            }
+            return entries[unique_id];
+        }
+
+        struct more_costly
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const
+            {
+                if (lhs.action_time != rhs.action_time)
+                    return lhs.action_time > rhs.action_time;
+                return lhs.matches > rhs.matches;
+            }
+        };
+
+        template <typename Char, typename Traits>
+        static void report(std::basic_ostream<Char, Traits>& os
+          , entry const& e, bool total)
+        {
+            std::ios_base::fmtflags const flags = os.flags();
+            std::streamsize const precision = os.precision();
+
+            os << std::fixed << std::setprecision(2);
+            if (total)
+                os << "total           ";
+            else
+                os << std::setw(5) << e.state << std::setw(11) << e.id;
+
+            os << std::setw(11) << e.matches
+               << std::setw(13) << (e.matches ?
+                    double(e.characters) / e.matches : 0.)
+               << std::setw(11) << e.actions
+               << std::setw(11) << e.failed
+               << std::setw(11) << e.ignored
+               << std::setw(13) << e.action_time / 1e6
+               << std::setw(13) << (e.actions ?
+                    double(e.action_time) / e.actions : 0.)
+               << "\n";
+
+            os.flags(flags);
+            os.precision(precision);
+        }
+
+        //  indexed by the lexer state and the unique id of the token
+        //  definitions, which are dense in every state
+        std::vector<std::vector<entry> > entries_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,166 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_SCAN_OCT_19_2026_0203PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_SCAN_OCT_19_2026_0203PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/detail/iterator.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//  Define BOOST_SPIRIT_LEXERTL_NO_SIMD to search without SSE2 instructions
+#if !defined(BOOST_SPIRIT_LEXERTL_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BOOST_SPIRIT_LEXERTL_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// helper functions used by the dynamic tokenizer to skip over the runs of
+// characters a DFA state loops on (see packed_state_machine::scan_info),
+// and for finding the lines of an input (see line_index)
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // whether the characters of an input sequence are contiguous in
+        // memory, i.e. it can be searched through a pointer
+        template <typename Iterator>
+        struct is_contiguous_narrow_iterator
+        {
+            typedef typename
+                boost::detail::iterator_traits<Iterator>::value_type
+            char_type;
+            typedef std::basic_string<char_type> string_type;
+            typedef std::vector<char_type> vector_type;
+
+            typedef mpl::bool_<sizeof(char_type) == 1 &&
+                mpl::or_<
+                    is_pointer<Iterator>
+                  , is_same<Iterator, typename string_type::const_iterator>
+                  , is_same<Iterator, typename string_type::iterator>
+                  , is_same<Iterator, typename vector_type::const_iterator>
+                  , is_same<Iterator, typename vector_type::iterator>
+                >::value> type;
+        };
+
+#if defined(BOOST_SPIRIT_LEXERTL_SSE2)
+        inline std::size_t first_bit(unsigned int mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // return the position of the first of the 'count' (0 .. 3) given
+        // characters in [first, last), or 'last' if there is none. The
+        // unused entries of 'chars' have to repeat one of the others.
+        inline char const* scan_to_any(char const* first, char const* last
+          , unsigned char const* chars, std::size_t count)
+        {
+            if (count == 0)
+                return last;
+
+            if (count == 1)
+            {
+                void const* p = std::memchr(first, chars[0], last - first);
+                return p ? static_cast<char const*>(p) : last;
+            }
+
+#if defined(BOOST_SPIRIT_LEXERTL_SSE2)
+            __m128i const c0 = _mm_set1_epi8(static_cast<char>(chars[0]));
+            __m128i const c1 = _mm_set1_epi8(static_cast<char>(chars[1]));
+            __m128i const c2 = _mm_set1_epi8(static_cast<char>(chars[2]));
+            while (last - first >= 16)
+            {
+                __m128i const v =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+                __m128i const found = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1))
+                  , _mm_cmpeq_epi8(v, c2));
+
+                unsigned int const mask = _mm_movemask_epi8(found);
+                if (mask != 0)
+                    return first + first_bit(mask);
+                first += 16;
+            }
+#endif
+            for (/**/; first != last; ++first)
+            {
+                unsigned char const ch = static_cast<unsigned char>(*first);
+                if (ch == chars[0] || ch == chars[1] || ch == chars[2])
+                    break;
+            }
+            return first;
+        }
+
+        // the same for the iterators of contiguous input sequences
+        template <typename Iterator>
+        inline Iterator scan_to_any(Iterator const& first
+          , Iterator const& last, unsigned char const* chars
+          , std::size_t count)
+        {
+            if (first == last)
+                return last;
+
+            char const* const begin = reinterpret_cast<char const*>(&*first);
+            char const* const end = begin + (last - first);
+            return first + (scan_to_any(begin, end, chars, count) - begin);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // append the offsets (from 'base') of all occurrences of 'ch' in
+        // [first, last) to 'offsets' (see line_index)
+        template <typename Offset>
+        inline void find_all(char const* base, char const* first
+          , char const* last, char ch, std::vector<Offset>& offsets)
+        {
+#if defined(BOOST_SPIRIT_LEXERTL_SSE2)
+            __m128i const c = _mm_set1_epi8(ch);
+            while (last - first >= 16)
+            {
+                __m128i const v =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+                unsigned int mask =
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(v, c));
+                while (mask != 0)
+                {
+                    offsets.push_back(
+                        Offset((first - base) + first_bit(mask)));
+                    mask &= mask - 1;
+                }
+                first += 16;
+            }
+#endif
+            for (/**/; first != last; ++first)
+            {
+                if (*first == ch)
+                    offsets.push_back(Offset(first - base));
+            }
+        }
+    }
+}}}}
+
+#endif
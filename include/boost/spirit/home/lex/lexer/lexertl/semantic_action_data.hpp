@@ -15,6 +15,11 @@
 #include <boost/function.hpp>
 #include <vector>
 
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+#include <boost/spirit/home/lex/lexer/lexertl/profile.hpp>
+#include <iterator>
+#endif
+
 namespace boost { namespace spirit { namespace lex { namespace lexertl
 { 
     namespace detail
@@ -49,6 +54,10 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
               , std::size_t& id, std::size_t unique_id, Iterator& end
               , Data& data) const
             {
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+                profile_.match(0, unique_id, id
+                  , std::distance(data.get_first(), end));
+#endif
                 // if there is nothing to invoke, continue with 'match'
                 if (unique_id >= actions_.size() || !actions_[unique_id]) 
                     return pass_flags::pass_normal;
@@ -56,11 +65,19 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 // Note: all arguments might be changed by the invoked semantic 
                 //       action
                 BOOST_SCOPED_ENUM(pass_flags) match = pass_flags::pass_normal;
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+                lexer_profile::scoped_action profile(profile_, 0, unique_id
+                  , match);
+#endif
                 actions_[unique_id](data.get_first(), end, match, id, data);
                 return match;
             }
 
             std::vector<functor_wrapper_type> actions_;
+
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+            mutable lexer_profile profile_;
+#endif
         }; 
 
         // This specialization of semantic_actions will be used if the token
@@ -93,6 +110,10 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
               , std::size_t& id, std::size_t unique_id, Iterator& end
               , Data& data) const
             {
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+                profile_.match(state, unique_id, id
+                  , std::distance(data.get_first(), end));
+#endif
                 // if there is no action defined for this state, return match
                 if (state >= actions_.size())
                     return pass_flags::pass_normal;
@@ -108,11 +129,19 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 // Note: all arguments might be changed by the invoked semantic 
                 //       action
                 BOOST_SCOPED_ENUM(pass_flags) match = pass_flags::pass_normal;
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+                lexer_profile::scoped_action profile(profile_, state, unique_id
+                  , match);
+#endif
                 actions[unique_id](data.get_first(), end, match, id, data);
                 return match;
             }
 
             std::vector<std::vector<functor_wrapper_type> > actions_;
+
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+            mutable lexer_profile profile_;
+#endif
         }; 
     }
 
@@ -232,6 +232,14 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
         bool init_dfa(bool minimize = false) const { return true; }
 
+#if defined(BOOST_SPIRIT_LEXERTL_PROFILE)
+        //  The matches and the semantic actions of a static_actor_lexer
+        //  counted and timed since it was constructed or the profile was
+        //  cleared.
+        lexer_profile const& profile() const { return actions_.profile_; }
+        void clear_profile() { actions_.profile_.clear(); }
+#endif
+
     private:
         typename Functor::semantic_actions_type actions_;
         std::size_t unique_id_;
@@ -0,0 +1,46 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_STATIC_SCAN_OCT_19_2026_0715PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_STATIC_SCAN_OCT_19_2026_0715PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+// helper functions used by the tokenizers generated by generate_static_switch
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    namespace static_
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // return the position of the first occurrence of 'ch' in the given
+        // range (or 'last' if there is none)
+        template <typename Iterator, typename Char>
+        inline Iterator scan_to(Iterator first, Iterator const& last, Char ch)
+        {
+            while (first != last && *first != ch)
+                ++first;
+            return first;
+        }
+
+        inline char const* scan_to(char const* first, char const* last, char ch)
+        {
+            void const* p = std::memchr(first, ch, last - first);
+            return p ? static_cast<char const*>(p) : last;
+        }
+
+        inline char* scan_to(char* first, char* last, char ch)
+        {
+            void* p = std::memchr(first, ch, last - first);
+            return p ? static_cast<char*>(p) : last;
+        }
+    }
+}}}}
+
+#endif
@@ -0,0 +1,182 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_TOKEN_VECTOR_OCT_19_2026_1148AM)
+#define BOOST_SPIRIT_LEX_LEXERTL_TOKEN_VECTOR_OCT_19_2026_1148AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/cstdint.hpp>
+#include <iterator>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  compact_token is the 16 byte record stored by the bulk tokenization
+    //  (see tokenize_all below and lexer::tokenize): the token id, the lexer
+    //  state the token has been matched in, and the position of the matched
+    //  characters as an offset from the start of the input and a length.
+    //  Token ids and inputs are limited to 32 bits.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    struct compact_token
+    {
+        compact_token()
+          : id(0), state(0), offset(0), length(0) {}
+
+        compact_token(std::size_t id_, std::size_t state_
+              , std::size_t offset_, std::size_t length_)
+          : id(boost::uint32_t(id_)), state(boost::uint32_t(state_))
+          , offset(boost::uint32_t(offset_))
+          , length(boost::uint32_t(length_)) {}
+
+        boost::uint32_t id;
+        boost::uint32_t state;
+        boost::uint32_t offset;
+        boost::uint32_t length;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  Tokenize the input [first, last) using the given tables in one go,
+    //  appending a compact_token for every matched token to 'tokens'
+    //  (which is best reserved beforehand). Matching starts in the lexer
+    //  state 'state' and follows the state changes of the token
+    //  definitions, but there are no semantic actions to invoke and the
+    //  state can't be changed while parsing, as all tokens are known
+    //  before.
+    //
+    //  Returns the position where tokenizing stopped, which is 'last'
+    //  unless the next characters did not match any token definition. The
+    //  input is not touched at all if it is longer than 4GB or if there is
+    //  no such state. Iterator has to be a random access iterator.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Char>
+    Iterator tokenize_all(packed_state_machine<Char> const& state_machine
+      , Iterator const& first, Iterator const& last
+      , std::vector<compact_token>& tokens, std::size_t state = 0)
+    {
+        typedef basic_iterator_tokeniser<Iterator> tokenizer;
+
+        if (state >= state_machine.size() ||
+            boost::uint64_t(last - first) > boost::uint64_t(0xffffffffu))
+        {
+            return first;
+        }
+
+        bool bol = state_machine.seen_bol_assertion();
+        std::size_t offset = 0;
+        Iterator end = first;
+
+        for (;;)
+        {
+            Iterator const start = end;
+            std::size_t const token_state = state;
+            std::size_t unique_id = boost::lexer::npos;
+            std::size_t const id = tokenizer::next(state_machine, state, bol
+              , end, last, unique_id);
+
+            if (0 == id || boost::lexer::npos == id)
+                return start;
+
+            std::size_t const length = end - start;
+            tokens.push_back(compact_token(id, token_state, offset, length));
+            offset += length;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  token_vector_iterator is a random access iterator over the compact
+    //  tokens stored by tokenize_all, which can be used instead of the
+    //  lexer iterator with the Qi token parsers (token_def, qi::token,
+    //  qi::tokenid). Dereferencing it constructs a token of the given type
+    //  from the compact token, using the start of the tokenized input
+    //  ('base') to recover the matched characters:
+    //
+    //      std::vector<lexertl::compact_token> tokens;
+    //      if (lexer.tokenize(first, last, tokens))
+    //      {
+    //          lexer_type::token_vector_iterator_type
+    //              begin(first, tokens.begin()), end(first, tokens.end());
+    //          qi::parse(begin, end, grammar);
+    //      }
+    //
+    //  The parsers switching the lexer state (in_state, set_state) are not
+    //  usable with this iterator.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token, typename Iterator = typename Token::iterator_type>
+    class token_vector_iterator
+      : public boost::iterator_facade<
+            token_vector_iterator<Token, Iterator>, Token
+          , std::random_access_iterator_tag, Token>
+    {
+    private:
+        typedef boost::iterator_facade<
+                token_vector_iterator<Token, Iterator>, Token
+              , std::random_access_iterator_tag, Token>
+            base_type;
+
+    public:
+        typedef Token token_type;
+        typedef Iterator base_iterator_type;
+        typedef std::vector<compact_token>::const_iterator compact_iterator;
+
+        token_vector_iterator() : base_(), it_() {}
+
+        token_vector_iterator(Iterator const& base, compact_iterator it)
+          : base_(base), it_(it) {}
+
+        //  the compact token this iterator refers to
+        compact_token const& compact() const { return *it_; }
+        compact_iterator compact_position() const { return it_; }
+
+    private:
+        friend class boost::iterator_core_access;
+
+        Token dereference() const
+        {
+            typedef typename Token::id_type id_type;
+
+            Iterator const start = base_ + it_->offset;
+            return Token(id_type(it_->id), it_->state
+              , start, start + it_->length);
+        }
+
+        bool equal(token_vector_iterator const& rhs) const
+        {
+            return it_ == rhs.it_;
+        }
+
+        void increment() { ++it_; }
+        void decrement() { --it_; }
+
+        void advance(typename base_type::difference_type n)
+        {
+            it_ += n;
+        }
+
+        typename base_type::difference_type
+        distance_to(token_vector_iterator const& rhs) const
+        {
+            return rhs.it_ - it_;
+        }
+
+        Iterator base_;
+        compact_iterator it_;
+    };
+}}}}
+
+#endif
@@ -12,5 +12,6 @@
 #endif
 
 #include <boost/spirit/home/qi/binary/binary.hpp>
+#include <boost/spirit/home/qi/binary/binary_array.hpp>
 
 #endif
@@ -0,0 +1,276 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_BINARY_ARRAY_OCTOBER_19_2026_1107AM)
+#define BOOST_SPIRIT_BINARY_ARRAY_OCTOBER_19_2026_1107AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/binary/binary.hpp>
+#include <boost/spirit/home/qi/directive/repeat.hpp>
+#include <boost/spirit/home/support/detail/binary_copy.hpp>
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//  repeat(n)[p], repeat(min, max)[p] and repeat(min, inf)[p] where p is
+//  one of the binary parsers (byte_, little_dword, big_bin_double, etc.)
+//  compile to a binary_array_parser. It parses all the values in one go
+//  if:
+//
+//      - the input iterator is a pointer to a byte sized type,
+//      - there is no skipper, and
+//      - the attribute is unused or a std::vector of a (non bool)
+//        arithmetic type matching the size and kind (integral or floating
+//        point) of the parsed values.
+//
+//  The values are then copied with a single memcpy into the (resized)
+//  vector and, if needed, byte swapped in place. In all other cases, it
+//  falls back to the element by element repeat parser.
+//
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace qi
+{
+    namespace detail
+    {
+        template <typename Attribute, typename T, typename Enable = void>
+        struct is_binary_array_attribute : mpl::false_ {};
+
+        template <typename V, typename Allocator, typename T>
+        struct is_binary_array_attribute<std::vector<V, Allocator>, T>
+          : mpl::bool_<
+                is_arithmetic<V>::value && !is_same<V, bool>::value
+             && sizeof(V) == sizeof(typename T::type)
+             && is_floating_point<V>::value ==
+                    is_floating_point<typename T::type>::value>
+        {};
+
+        template <typename T>
+        inline std::size_t binary_array_count(T n)
+        {
+            return n > T(0) ? static_cast<std::size_t>(n) : 0;
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_min(exact_iterator<T> const& iter)
+        {
+            return binary_array_count(iter.exact);
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_max(exact_iterator<T> const& iter)
+        {
+            return binary_array_count(iter.exact);
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_min(finite_iterator<T> const& iter)
+        {
+            return binary_array_count(iter.min BOOST_PREVENT_MACRO_SUBSTITUTION);
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_max(finite_iterator<T> const& iter)
+        {
+            return binary_array_count(iter.max BOOST_PREVENT_MACRO_SUBSTITUTION);
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_min(infinite_iterator<T> const& iter)
+        {
+            return binary_array_count(iter.min BOOST_PREVENT_MACRO_SUBSTITUTION);
+        }
+
+        template <typename T>
+        inline std::size_t binary_array_max(infinite_iterator<T> const&)
+        {
+            return std::size_t(-1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+      , int bits, typename LoopIter>
+    struct binary_array_parser
+      : unary_parser<binary_array_parser<T, endian, bits, LoopIter> >
+    {
+        typedef any_binary_parser<T, endian, bits> subject_type;
+        typedef repeat_parser<subject_type, LoopIter> repeat_type;
+
+        template <typename Context, typename Iterator>
+        struct attribute
+          : repeat_type::template attribute<Context, Iterator> {};
+
+        binary_array_parser(subject_type const& subject_, LoopIter const& iter_)
+          : subject(subject_), iter(iter_) {}
+
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse_array(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper
+          , Attribute& attr_, mpl::false_) const
+        {
+            return repeat_type(subject, iter).parse(
+                first, last, context, skipper, attr_);
+        }
+
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse_array(Iterator& first, Iterator const& last
+          , Context& /*context*/, Skipper const& /*skipper*/
+          , Attribute& attr_, mpl::true_) const
+        {
+            std::size_t const size = bits / 8;
+            std::size_t const available = std::size_t(last - first) / size;
+            if (available < detail::binary_array_min(iter))
+                return false;
+
+            std::size_t n = detail::binary_array_max(iter);
+            if (n > available)
+                n = available;
+
+            store(attr_, first, n);
+            first += n * size;
+            return true;
+        }
+
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper
+          , Attribute& attr_) const
+        {
+            typedef typename remove_const<Attribute>::type attribute_type;
+            typedef mpl::bool_<
+                is_pointer<Iterator>::value && sizeof(*first) == 1
+             && is_same<Skipper, unused_type>::value
+             && (is_same<attribute_type, unused_type>::value
+                  || detail::is_binary_array_attribute<attribute_type, T>::value)>
+            is_bulk;
+
+            return parse_array(first, last, context, skipper, attr_, is_bulk());
+        }
+
+        template <typename Context>
+        info what(Context& context) const
+        {
+            return info("repeat", subject.what(context));
+        }
+
+        subject_type subject;
+        LoopIter iter;
+
+    private:
+        template <typename Iterator>
+        static void store(unused_type const&, Iterator, std::size_t) {}
+
+        template <typename V, typename Allocator, typename Iterator>
+        static void store(std::vector<V, Allocator>& attr_
+          , Iterator first, std::size_t n)
+        {
+            if (n == 0)
+                return;
+
+            std::size_t const old_size = attr_.size();
+            attr_.resize(old_size + n);
+            spirit::detail::copy_binary_array<endian, bits>(
+                reinterpret_cast<unsigned char const*>(&*first), n
+              , &attr_[old_size]);
+        }
+
+        // silence MSVC warning C4512: assignment operator could not be generated
+        binary_array_parser& operator= (binary_array_parser const&);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parser generators: make_xxx function (objects)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename N, typename T
+      , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits
+      , typename Modifiers>
+    struct make_directive<
+        terminal_ex<tag::repeat, fusion::vector1<N> >
+      , any_binary_parser<T, endian, bits>, Modifiers>
+    {
+        typedef exact_iterator<N> iterator_type;
+        typedef binary_array_parser<T, endian, bits, iterator_type> result_type;
+
+        template <typename Terminal, typename Subject>
+        result_type operator()(
+            Terminal const& term, Subject const& subject, unused_type) const
+        {
+            return result_type(subject, fusion::at_c<0>(term.args));
+        }
+    };
+
+    template <typename N, typename T
+      , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits
+      , typename Modifiers>
+    struct make_directive<
+        terminal_ex<tag::repeat, fusion::vector2<N, N> >
+      , any_binary_parser<T, endian, bits>, Modifiers>
+    {
+        typedef finite_iterator<N> iterator_type;
+        typedef binary_array_parser<T, endian, bits, iterator_type> result_type;
+
+        template <typename Terminal, typename Subject>
+        result_type operator()(
+            Terminal const& term, Subject const& subject, unused_type) const
+        {
+            return result_type(subject,
+                iterator_type(
+                    fusion::at_c<0>(term.args)
+                  , fusion::at_c<1>(term.args)
+                )
+            );
+        }
+    };
+
+    template <typename N, typename T
+      , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits
+      , typename Modifiers>
+    struct make_directive<
+        terminal_ex<tag::repeat, fusion::vector2<N, inf_type> >
+      , any_binary_parser<T, endian, bits>, Modifiers>
+    {
+        typedef infinite_iterator<N> iterator_type;
+        typedef binary_array_parser<T, endian, bits, iterator_type> result_type;
+
+        template <typename Terminal, typename Subject>
+        result_type operator()(
+            Terminal const& term, Subject const& subject, unused_type) const
+        {
+            return result_type(subject, fusion::at_c<0>(term.args));
+        }
+    };
+}}}
+
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+      , int bits, typename LoopIter, typename Attribute
+      , typename Context, typename Iterator>
+    struct handles_container<
+        qi::binary_array_parser<T, endian, bits, LoopIter>
+      , Attribute, Context, Iterator>
+      : mpl::true_ {};
+}}}
+
+#endif
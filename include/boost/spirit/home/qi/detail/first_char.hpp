@@ -0,0 +1,132 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_FIRST_CHAR_OCTOBER_19_2026_1012AM)
+#define SPIRIT_FIRST_CHAR_OCTOBER_19_2026_1012AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/char/char.hpp>
+#include <boost/spirit/home/qi/string/lit.hpp>
+#include <boost/spirit/home/qi/operator/sequence.hpp>
+#include <boost/spirit/home/qi/operator/expect.hpp>
+#include <boost/spirit/home/qi/action/action.hpp>
+#include <boost/spirit/home/qi/directive/hold.hpp>
+#include <boost/spirit/home/qi/directive/lexeme.hpp>
+#include <boost/spirit/home/qi/directive/omit.hpp>
+#include <boost/spirit/home/support/string_traits.hpp>
+#include <boost/fusion/include/front.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+namespace boost { namespace spirit { namespace qi { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  The index (0..255) of a character in the first character tables of
+    //  the permutation operator, or -1 if it has none. Narrow characters map
+    //  to their unsigned value, wide characters only if they are below 256.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    inline int first_char_index(Char ch)
+    {
+        if (sizeof(Char) == 1)
+            return static_cast<unsigned char>(ch);
+        return static_cast<boost::uint32_t>(ch) < 256u ?
+            static_cast<int>(ch) : -1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  first_char<Component>::call(component) returns the first_char_index
+    //  of the character every match of the component (after pre-skipping)
+    //  starts with, or -1 if it is not known. It is computed for case
+    //  sensitive literals and for the sequences and directives starting
+    //  with one; anything which might match something else (or nothing)
+    //  must stay -1.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Component, typename Enable = void>
+    struct first_char
+    {
+        static int call(Component const&)
+        {
+            return -1;
+        }
+    };
+
+    template <typename Subject>
+    struct first_char_of_subject
+    {
+        template <typename Component>
+        static int call(Component const& component)
+        {
+            return first_char<Subject>::call(component.subject);
+        }
+    };
+
+    template <typename Elements>
+    struct first_char_of_elements
+    {
+        typedef typename remove_const<typename remove_reference<
+            typename fusion::result_of::front<Elements const>::type
+        >::type>::type front_type;
+
+        template <typename Component>
+        static int call(Component const& component)
+        {
+            return first_char<front_type>::call(
+                fusion::front(component.elements));
+        }
+    };
+
+    template <typename CharEncoding, bool no_attribute>
+    struct first_char<literal_char<CharEncoding, no_attribute, false> >
+    {
+        static int
+        call(literal_char<CharEncoding, no_attribute, false> const& component)
+        {
+            return first_char_index(component.ch);
+        }
+    };
+
+    template <typename String, bool no_attribute>
+    struct first_char<literal_string<String, no_attribute> >
+    {
+        static int call(literal_string<String, no_attribute> const& component)
+        {
+            typename literal_string<String, no_attribute>::char_type const*
+                str = traits::get_c_string(component.str);
+            return *str ? first_char_index(*str) : -1;
+        }
+    };
+
+    template <typename Elements>
+    struct first_char<sequence<Elements> >
+      : first_char_of_elements<Elements> {};
+
+    template <typename Elements>
+    struct first_char<expect<Elements> >
+      : first_char_of_elements<Elements> {};
+
+    template <typename Subject, typename Action>
+    struct first_char<action<Subject, Action> >
+      : first_char_of_subject<Subject> {};
+
+    template <typename Subject>
+    struct first_char<hold_directive<Subject> >
+      : first_char_of_subject<Subject> {};
+
+    template <typename Subject>
+    struct first_char<lexeme_directive<Subject> >
+      : first_char_of_subject<Subject> {};
+
+    template <typename Subject>
+    struct first_char<omit_directive<Subject> >
+      : first_char_of_subject<Subject> {};
+}}}}
+
+#endif
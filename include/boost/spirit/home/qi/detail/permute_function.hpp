@@ -11,8 +11,23 @@
 #pragma once
 #endif
 
+#include <boost/spirit/home/qi/skip_over.hpp>
+#include <boost/spirit/home/qi/detail/first_char.hpp>
+#include <boost/spirit/home/support/algorithm/any_if.hpp>
 #include <boost/spirit/home/support/unused.hpp>
+#include <boost/fusion/include/begin.hpp>
+#include <boost/fusion/include/end.hpp>
+#include <boost/fusion/include/next.hpp>
+#include <boost/fusion/include/equal_to.hpp>
+#include <boost/fusion/include/distance.hpp>
+#include <boost/fusion/include/advance.hpp>
+#include <boost/fusion/include/at.hpp>
+#include <boost/fusion/include/size.hpp>
 #include <boost/optional.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <cstddef>
+#include <iterator>
 
 namespace boost { namespace spirit { namespace qi { namespace detail
 {
@@ -32,57 +47,158 @@ namespace boost { namespace spirit { namespace qi { namespace detail
         template <typename Component, typename Attribute>
         bool operator()(Component const& component, Attribute& attr)
         {
-            // return true if the parser succeeds and the slot is not yet taken
-            if (!*taken && component.parse(first, last, context, skipper, attr))
-            {
-                *taken = true;
-                ++taken;
-                return true;
-            }
-            ++taken;
-            return false;
+            return component.parse(first, last, context, skipper, attr);
         }
 
         template <typename Component, typename Attribute>
         bool operator()(Component const& component, boost::optional<Attribute>& attr)
         {
-            // return true if the parser succeeds and the slot is not yet taken
             Attribute val;
-            if (!*taken && component.parse(first, last, context, skipper, val))
+            if (component.parse(first, last, context, skipper, val))
             {
                 attr = val;
-                *taken = true;
-                ++taken;
                 return true;
             }
-            ++taken;
             return false;
         }
 
         template <typename Component>
         bool operator()(Component const& component)
         {
-            // return true if the parser succeeds and the slot is not yet taken
-            if (!*taken && component.parse(first, last, context, skipper, unused))
-            {
-                *taken = true;
-                ++taken;
-                return true;
-            }
-            ++taken;
-            return false;
+            return component.parse(first, last, context, skipper, unused);
+        }
+
+        // the first_char_index of the next input character (after
+        // skipping), or -1 if there is none or if the input is not made of
+        // characters (lexer tokens)
+        int peek() const
+        {
+            typedef typename
+                std::iterator_traits<Iterator>::value_type
+            value_type;
+
+            return peek(mpl::bool_<is_integral<value_type>::value>());
+        }
+
+        int peek(mpl::false_) const
+        {
+            return -1;
+        }
+
+        int peek(mpl::true_) const
+        {
+            Iterator i = first;
+            qi::skip_over(i, last, skipper);
+            return (i == last) ? -1 : first_char_index(*i);
         }
 
         Iterator& first;
         Iterator const& last;
         Context& context;
         Skipper const& skipper;
-        bool* taken;
 
     private:
         // silence MSVC warning C4512: assignment operator could not be generated
         permute_function& operator= (permute_function const&);
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  permute_table holds one function per element of a permutation,
+    //  invoking f with the element and its attribute (see any_if for the
+    //  predicate skipping the elements with an unused attribute), so that
+    //  the permutation can try its elements in any order.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Pred, typename Elements, typename Attribute, typename F>
+    struct permute_table
+    {
+        typedef bool (*function_type)(Elements const&, Attribute&, F&);
+
+        typedef typename fusion::result_of::begin<Elements const>::type first1;
+        typedef typename fusion::result_of::end<Elements const>::type last1;
+        typedef typename fusion::result_of::begin<Attribute>::type first2;
+        typedef typename fusion::result_of::end<Attribute>::type last2;
+
+        permute_table()
+        {
+            fill<first1, first2>(functions
+              , fusion::result_of::equal_to<first1, last1>());
+        }
+
+        static permute_table const& get()
+        {
+            static permute_table const table;
+            return table;
+        }
+
+        template <typename Iterator1, typename Iterator2>
+        static bool call(Elements const& elements, Attribute& attr, F& f)
+        {
+            return f(fusion::at_c<
+                    fusion::result_of::distance<first1, Iterator1>::value
+                >(elements)
+              , spirit::detail::attribute_value<Pred, Iterator1, last2>(
+                    fusion::advance_c<
+                        fusion::result_of::distance<first2, Iterator2>::value
+                    >(fusion::begin(attr))));
+        }
+
+        template <typename Iterator1, typename Iterator2>
+        void fill(function_type*, mpl::true_)
+        {
+        }
+
+        template <typename Iterator1, typename Iterator2>
+        void fill(function_type* f, mpl::false_)
+        {
+            typedef typename fusion::result_of::next<Iterator1>::type next1;
+            typedef typename spirit::detail::result_of::attribute_next<
+                Iterator1, Iterator2, last2, Pred>::type next2;
+
+            *f = &permute_table::call<Iterator1, Iterator2>;
+            fill<next1, next2>(f + 1
+              , fusion::result_of::equal_to<next1, last1>());
+        }
+
+        function_type functions[fusion::result_of::size<Elements>::value];
+    };
+
+    template <typename Pred, typename Elements, typename F>
+    struct permute_table<Pred, Elements, unused_type, F>
+    {
+        typedef bool (*function_type)(Elements const&, unused_type&, F&);
+
+        permute_table()
+        {
+            fill<0>(functions, mpl::false_());
+        }
+
+        static permute_table const& get()
+        {
+            static permute_table const table;
+            return table;
+        }
+
+        template <int I>
+        static bool call(Elements const& elements, unused_type&, F& f)
+        {
+            return f(fusion::at_c<I>(elements));
+        }
+
+        template <int I>
+        void fill(function_type*, mpl::true_)
+        {
+        }
+
+        template <int I>
+        void fill(function_type* f, mpl::false_)
+        {
+            *f = &permute_table::call<I>;
+            fill<I + 1>(f + 1, mpl::bool_<
+                I + 1 == fusion::result_of::size<Elements>::value>());
+        }
+
+        function_type functions[fusion::result_of::size<Elements>::value];
+    };
 }}}}
 
 #endif
@@ -20,6 +20,17 @@
 #include <boost/spirit/home/support/unused.hpp>
 #include <boost/spirit/home/support/has_semantic_action.hpp>
 #include <boost/spirit/home/support/handles_container.hpp>
+#include <boost/spirit/home/support/container.hpp>
+#include <boost/fusion/include/at.hpp>
+#include <boost/fusion/include/size.hpp>
+#include <boost/fusion/include/value_at.hpp>
+#include <boost/fusion/include/is_sequence.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <iterator>
 
 namespace boost { namespace spirit
 {
@@ -29,14 +40,134 @@ namespace boost { namespace spirit
     template <>
     struct use_directive<qi::domain, tag::hold> // enables hold
       : mpl::true_ {};
+
+    template <>
+    struct use_directive<qi::domain, tag::hold_append> // enables hold_append
+      : mpl::true_ {};
 }}
 
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  hold_checkpoint records the state of an attribute before the subject
+    //  of hold_append[] is invoked and restores it if the subject fails.
+    //  The default saves a full copy. Containers with random access
+    //  iterators only remember their size and erase the appended elements,
+    //  and fusion sequences keep one checkpoint per member. Both rely on the
+    //  subject appending to containers only, which is the contract of
+    //  hold_append[].
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Attribute, typename Enable = void>
+    struct hold_checkpoint
+    {
+        explicit hold_checkpoint(Attribute const& attr)
+          : saved(attr) {}
+
+        void rollback(Attribute& attr)
+        {
+            traits::swap_impl(saved, attr);
+        }
+
+        Attribute saved;
+    };
+
+    template <>
+    struct hold_checkpoint<unused_type>
+    {
+        explicit hold_checkpoint(unused_type) {}
+        void rollback(unused_type) {}
+    };
+
+    template <>
+    struct hold_checkpoint<unused_type const> : hold_checkpoint<unused_type>
+    {
+        explicit hold_checkpoint(unused_type)
+          : hold_checkpoint<unused_type>(unused) {}
+    };
+
+    namespace detail
+    {
+        template <typename Container, typename Enable = void>
+        struct is_random_access_container : mpl::false_ {};
+
+        template <typename Container>
+        struct is_random_access_container<Container
+          , typename enable_if<has_iterator<Container> >::type>
+          : is_convertible<
+                typename std::iterator_traits<
+                    typename Container::iterator>::iterator_category
+              , std::random_access_iterator_tag>
+        {};
+
+        template <typename Sequence, int I
+          , int N = fusion::result_of::size<Sequence>::value>
+        struct hold_member_checkpoints
+        {
+            typedef typename remove_reference<typename
+                fusion::result_of::value_at_c<Sequence, I>::type>::type
+            member_type;
+
+            explicit hold_member_checkpoints(Sequence const& seq)
+              : head(fusion::at_c<I>(seq)), tail(seq) {}
+
+            void rollback(Sequence& seq)
+            {
+                head.rollback(fusion::at_c<I>(seq));
+                tail.rollback(seq);
+            }
+
+            hold_checkpoint<member_type> head;
+            hold_member_checkpoints<Sequence, I + 1, N> tail;
+        };
+
+        template <typename Sequence, int N>
+        struct hold_member_checkpoints<Sequence, N, N>
+        {
+            explicit hold_member_checkpoints(Sequence const&) {}
+            void rollback(Sequence&) {}
+        };
+    }
+
+    template <typename Container>
+    struct hold_checkpoint<Container
+      , typename enable_if<mpl::and_<
+            is_container<Container>
+          , detail::is_random_access_container<Container> > >::type>
+    {
+        explicit hold_checkpoint(Container const& c)
+          : size(c.size()) {}
+
+        void rollback(Container& c)
+        {
+            if (c.size() > size)
+                c.erase(c.begin() + size, c.end());
+        }
+
+        typename Container::size_type size;
+    };
+
+    template <typename Sequence>
+    struct hold_checkpoint<Sequence
+      , typename enable_if<mpl::and_<
+            fusion::traits::is_sequence<Sequence>
+          , mpl::not_<is_container<Sequence> > > >::type>
+      : detail::hold_member_checkpoints<Sequence, 0>
+    {
+        explicit hold_checkpoint(Sequence const& seq)
+          : detail::hold_member_checkpoints<Sequence, 0>(seq) {}
+    };
+}}}
+
 namespace boost { namespace spirit { namespace qi
 {
 #ifndef BOOST_SPIRIT_NO_PREDEFINED_TERMINALS
     using spirit::hold;
 #endif
     using spirit::hold_type;
+#ifndef BOOST_SPIRIT_NO_PREDEFINED_TERMINALS
+    using spirit::hold_append;
+#endif
+    using spirit::hold_append_type;
 
     template <typename Subject>
     struct hold_directive : unary_parser<hold_directive<Subject> >
@@ -77,6 +208,49 @@ namespace boost { namespace spirit { namespace qi
         Subject subject;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // hold_append[] has the commit/rollback semantics of hold[] for subjects
+    // which only append to container attributes (no semantic actions, no
+    // attr() or symbols assigning a whole container). Instead of parsing
+    // into a copy of the attribute it takes a traits::hold_checkpoint, which
+    // is O(1) for vectors, strings and deques, and rolls back on failure.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct hold_append_directive : unary_parser<hold_append_directive<Subject> >
+    {
+        typedef Subject subject_type;
+        hold_append_directive(Subject const& subject_)
+          : subject(subject_) {}
+
+        template <typename Context, typename Iterator>
+        struct attribute
+        {
+            typedef typename
+                traits::attribute_of<subject_type, Context, Iterator>::type
+            type;
+        };
+
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper, Attribute& attr_) const
+        {
+            traits::hold_checkpoint<Attribute> checkpoint(attr_);
+            if (subject.parse(first, last, context, skipper, attr_))
+                return true;
+            checkpoint.rollback(attr_);
+            return false;
+        }
+
+        template <typename Context>
+        info what(Context& context) const
+        {
+            return info("hold_append", subject.what(context));
+        }
+
+        Subject subject;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // Parser generators: make_xxx function (objects)
     ///////////////////////////////////////////////////////////////////////////
@@ -89,6 +263,16 @@ namespace boost { namespace spirit { namespace qi
             return result_type(subject);
         }
     };
+
+    template <typename Subject, typename Modifiers>
+    struct make_directive<tag::hold_append, Subject, Modifiers>
+    {
+        typedef hold_append_directive<Subject> result_type;
+        result_type operator()(unused_type, Subject const& subject, unused_type) const
+        {
+            return result_type(subject);
+        }
+    };
 }}}
 
 namespace boost { namespace spirit { namespace traits
@@ -104,6 +288,18 @@ namespace boost { namespace spirit { namespace traits
     struct handles_container<qi::hold_directive<Subject>, Attribute
         , Context, Iterator>
       : unary_handles_container<Subject, Attribute, Context, Iterator> {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct has_semantic_action<qi::hold_append_directive<Subject> >
+      : unary_has_semantic_action<Subject> {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Attribute, typename Context
+        , typename Iterator>
+    struct handles_container<qi::hold_append_directive<Subject>, Attribute
+        , Context, Iterator>
+      : unary_handles_container<Subject, Attribute, Context, Iterator> {};
 }}}
 
 #endif
@@ -0,0 +1,311 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_STATIC_RULE_OCTOBER_19_2026_1012AM)
+#define BOOST_SPIRIT_STATIC_RULE_OCTOBER_19_2026_1012AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/spirit/home/support/info.hpp>
+#include <boost/spirit/home/support/assert_msg.hpp>
+#include <boost/spirit/home/qi/domain.hpp>
+#include <boost/spirit/home/qi/meta_compiler.hpp>
+#include <boost/spirit/home/qi/parser.hpp>
+#include <boost/spirit/home/qi/reference.hpp>
+#include <boost/spirit/home/qi/nonterminal/rule.hpp>
+#include <boost/spirit/home/qi/nonterminal/detail/parameterized.hpp>
+#include <boost/spirit/home/qi/nonterminal/detail/parser_binder.hpp>
+#include <boost/spirit/home/qi/skip_over.hpp>
+
+#include <string>
+
+#if defined(BOOST_MSVC)
+# pragma warning(push)
+# pragma warning(disable: 4355) // 'this' : used in base member initializer list warning
+#endif
+
+namespace boost { namespace spirit { namespace qi
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // static_rule: a rule whose definition is part of its type.
+    //
+    // A qi::rule stores its right hand side in a boost::function, so every
+    // invocation is an indirect call the compiler can not see through, and
+    // copying a rule copies (and usually heap allocates) the stored parser.
+    // A static_rule stores the compiled parser by value instead. It has the
+    // same signature, locals, skipper and encoding as the qi::rule it is
+    // modelled after (the Rule template parameter) and behaves like that
+    // rule in every other respect, but invoking it is a plain (inlinable)
+    // function call and copying it never allocates.
+    //
+    // Since the definition has to be known when the static_rule is created,
+    // a static_rule can not refer to itself. Recursive grammars use static
+    // rules for the leaves and ordinary rules where the recursion is closed:
+    //
+    //      typedef qi::rule<Iterator, int(), space_type> int_rule;
+    //      int_rule expr;
+    //      auto const factor = qi::make_static_rule<int_rule>(
+    //          int_ | '(' >> expr >> ')');
+    //      expr = factor >> *('+' >> factor);
+    //
+    // Use make_static_rule for rule = expr semantics and
+    // make_static_auto_rule for rule %= expr semantics.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Rule, typename Parser, typename Auto = mpl::false_>
+    struct static_rule
+      : proto::extends<
+            typename proto::terminal<
+                reference<static_rule<Rule, Parser, Auto> const>
+            >::type
+          , static_rule<Rule, Parser, Auto>
+        >
+      , parser<static_rule<Rule, Parser, Auto> >
+    {
+        typedef Rule rule_type;
+        typedef Parser parser_type;
+        typedef typename Rule::iterator_type iterator_type;
+        typedef static_rule<Rule, Parser, Auto> this_type;
+        typedef reference<this_type const> reference_;
+        typedef typename proto::terminal<reference_>::type terminal;
+        typedef proto::extends<terminal, this_type> base_type;
+
+        typedef typename Rule::locals_type locals_type;
+        typedef typename Rule::skipper_type skipper_type;
+        typedef typename Rule::sig_type sig_type;
+        typedef typename Rule::encoding_type encoding_type;
+        typedef typename Rule::attr_type attr_type;
+        typedef typename Rule::attr_reference_type attr_reference_type;
+        typedef typename Rule::parameter_types parameter_types;
+        typedef typename Rule::context_type context_type;
+
+        static size_t const params_size = Rule::params_size;
+
+        typedef detail::parser_binder<Parser, Auto> binder_type;
+
+        explicit static_rule(Parser const& p
+              , std::string const& name = "unnamed-rule")
+          : base_type(terminal::make(reference_(*this)))
+          , name_(name)
+          , f(p)
+        {
+        }
+
+        static_rule(static_rule const& rhs)
+          : base_type(terminal::make(reference_(*this)))
+          , name_(rhs.name_)
+          , f(rhs.f)
+        {
+        }
+
+        std::string const& name() const
+        {
+            return name_;
+        }
+
+        void name(std::string const& str)
+        {
+            name_ = str;
+        }
+
+        template <typename Context, typename Iterator_>
+        struct attribute
+        {
+            typedef attr_type type;
+        };
+
+        template <typename Context, typename Skipper, typename Attribute>
+        bool parse(iterator_type& first, iterator_type const& last
+          , Context& /*context*/, Skipper const& skipper
+          , Attribute& attr_param) const
+        {
+            // do a preskip if this is an implied lexeme
+            if (is_same<skipper_type, unused_type>::value)
+                qi::skip_over(first, last, skipper);
+
+            typedef traits::make_attribute<attr_type, Attribute> make_attribute;
+
+            // do down-stream transformation, provides attribute for
+            // rhs parser
+            typedef traits::transform_attribute<
+                typename make_attribute::type, attr_type, domain>
+            transform;
+
+            typename make_attribute::type made_attr = make_attribute::call(attr_param);
+            typename transform::type attr_ = transform::pre(made_attr);
+
+            // If you are seeing a compilation error here, you are probably
+            // trying to use a rule which has inherited attributes, without
+            // passing values for them.
+            context_type context(attr_);
+
+            // If you are seeing a compilation error here stating that the
+            // fourth parameter can't be converted to a required target type
+            // then you are probably trying to use a rule with an
+            // incompatible skipper type.
+            if (f(first, last, context, skipper))
+            {
+                // do up-stream transformation, this integrates the results
+                // back into the original attribute value, if appropriate
+                traits::post_transform(attr_param, attr_);
+                return true;
+            }
+
+            // inform attribute transformation of failed rhs
+            traits::fail_transform(attr_param, attr_);
+            return false;
+        }
+
+        template <typename Context, typename Skipper
+          , typename Attribute, typename Params>
+        bool parse(iterator_type& first, iterator_type const& last
+          , Context& caller_context, Skipper const& skipper
+          , Attribute& attr_param, Params const& params) const
+        {
+            // do a preskip if this is an implied lexeme
+            if (is_same<skipper_type, unused_type>::value)
+                qi::skip_over(first, last, skipper);
+
+            typedef traits::make_attribute<attr_type, Attribute> make_attribute;
+
+            // do down-stream transformation, provides attribute for
+            // rhs parser
+            typedef traits::transform_attribute<
+                typename make_attribute::type, attr_type, domain>
+            transform;
+
+            typename make_attribute::type made_attr = make_attribute::call(attr_param);
+            typename transform::type attr_ = transform::pre(made_attr);
+
+            // If you are seeing a compilation error here, you are probably
+            // trying to use a rule which has inherited attributes, passing
+            // values of incompatible types for them.
+            context_type context(attr_, params, caller_context);
+
+            if (f(first, last, context, skipper))
+            {
+                // do up-stream transformation, this integrates the results
+                // back into the original attribute value, if appropriate
+                traits::post_transform(attr_param, attr_);
+                return true;
+            }
+
+            // inform attribute transformation of failed rhs
+            traits::fail_transform(attr_param, attr_);
+            return false;
+        }
+
+        template <typename Context>
+        info what(Context& /*context*/) const
+        {
+            return info(name_);
+        }
+
+        reference_ alias() const
+        {
+            return reference_(*this);
+        }
+
+        typename proto::terminal<this_type>::type copy() const
+        {
+            typename proto::terminal<this_type>::type result = {*this};
+            return result;
+        }
+
+        // bring in the operator() overloads
+        static_rule const& get_parameterized_subject() const { return *this; }
+        typedef static_rule parameterized_subject_type;
+        #include <boost/spirit/home/qi/nonterminal/detail/fcall.hpp>
+
+        std::string name_;
+        binder_type f;
+
+    private:
+        // static rules are immutable, define a new one instead
+        static_rule& operator=(static_rule const&);
+    };
+}}}
+
+namespace boost { namespace spirit { namespace result_of
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The type of the static_rule created from the expression Expr, modelled
+    // after the qi::rule Rule. Useful where auto is not available.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Rule, typename Expr, typename Auto = mpl::false_>
+    struct static_rule
+    {
+        typedef typename Rule::encoding_modifier_type encoding_modifier_type;
+        typedef qi::static_rule<
+            Rule
+          , typename compile<qi::domain, Expr, encoding_modifier_type>::type
+          , Auto>
+        type;
+    };
+}}}
+
+namespace boost { namespace spirit { namespace qi
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // rule = expr
+    template <typename Rule, typename Expr>
+    inline typename spirit::result_of::static_rule<Rule, Expr>::type
+    make_static_rule(Expr const& expr
+      , std::string const& name = "unnamed-rule")
+    {
+        // Report invalid expression error as early as possible.
+        // If you got an error_invalid_expression error message here,
+        // then the expression (expr) is not a valid spirit qi expression.
+        BOOST_SPIRIT_ASSERT_MATCH(qi::domain, Expr);
+
+        typedef typename spirit::result_of::static_rule<Rule, Expr>::type
+            result_type;
+        return result_type(
+            compile<qi::domain>(expr
+              , typename Rule::encoding_modifier_type())
+          , name);
+    }
+
+    // rule %= expr
+    template <typename Rule, typename Expr>
+    inline typename spirit::result_of::static_rule<Rule, Expr, mpl::true_>::type
+    make_static_auto_rule(Expr const& expr
+      , std::string const& name = "unnamed-rule")
+    {
+        BOOST_SPIRIT_ASSERT_MATCH(qi::domain, Expr);
+
+        typedef typename
+            spirit::result_of::static_rule<Rule, Expr, mpl::true_>::type
+        result_type;
+        return result_type(
+            compile<qi::domain>(expr
+              , typename Rule::encoding_modifier_type())
+          , name);
+    }
+}}}
+
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <
+        typename Rule, typename Parser, typename Auto, typename Attribute
+      , typename Context, typename Iterator>
+    struct handles_container<
+        qi::static_rule<Rule, Parser, Auto>, Attribute, Context, Iterator>
+      : traits::is_container<typename Rule::attr_type>
+    {};
+}}}
+
+#if defined(BOOST_MSVC)
+# pragma warning(pop)
+#endif
+
+#endif
@@ -27,10 +27,17 @@
 #include <boost/preprocessor/seq/elem.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_signed.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/and.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/predef/other/endian.h>
+#include <boost/cstdint.hpp>
 #include <boost/limits.hpp>
+#include <cstddef>
+#include <cstring>
+#include <string>
 
 #if !defined(SPIRIT_NUMERICS_LOOP_UNROLL)
 # define SPIRIT_NUMERICS_LOOP_UNROLL 3
@@ -145,6 +152,25 @@ namespace boost { namespace spirit { namespace qi { namespace detail
             n += static_cast<T>(digit);
             return true;
         }
+
+        // add a block of digits at once: n = n * scale + block
+        template <typename T>
+        inline static void add_block(T& n, T block, T scale, mpl::false_)
+        {
+            n = n * scale + block;
+        }
+
+        template <typename T>
+        inline static bool add_block(T& n, T block, T scale, mpl::true_)
+        {
+            // Ensure n * scale + block will not overflow
+            static T const max = (std::numeric_limits<T>::max)();
+            if (n > (max - block) / scale)
+                return false;
+
+            n = n * scale + block;
+            return true;
+        }
     };
 
     template <unsigned Radix>
@@ -176,6 +202,25 @@ namespace boost { namespace spirit { namespace qi { namespace detail
             n -= static_cast<T>(digit);
             return true;
         }
+
+        // subtract a block of digits at once: n = n * scale - block
+        template <typename T>
+        inline static void add_block(T& n, T block, T scale, mpl::false_)
+        {
+            n = n * scale - block;
+        }
+
+        template <typename T>
+        inline static bool add_block(T& n, T block, T scale, mpl::true_)
+        {
+            // Ensure n * scale - block will not underflow
+            static T const min = (std::numeric_limits<T>::min)();
+            if (n < (min + block) / scale)
+                return false;
+
+            n = n * scale - block;
+            return true;
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -259,6 +304,207 @@ namespace boost { namespace spirit { namespace qi { namespace detail
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  digit_blocks: the fast path of extract_int for long 64 bit decimal
+    //  integers in contiguous character input (character pointers and
+    //  std::string iterators). Eight characters at a time are loaded into
+    //  a 64 bit word, the leading digits among them are found and
+    //  converted with a couple of word operations (SWAR) and added to the
+    //  number with a single overflow check per block.
+    //
+    //  Floating point numbers are always converted digit by digit: they
+    //  are rounded after every digit, and a block of digits added at once
+    //  is not rounded the same way.
+    //
+    //  Define SPIRIT_NUMERICS_DIGIT_BLOCKS to 0 to disable the fast path.
+    ///////////////////////////////////////////////////////////////////////////
+#if !defined(SPIRIT_NUMERICS_DIGIT_BLOCKS)
+# if BOOST_ENDIAN_LITTLE_BYTE
+#  define SPIRIT_NUMERICS_DIGIT_BLOCKS 1
+# else
+#  define SPIRIT_NUMERICS_DIGIT_BLOCKS 0
+# endif
+#endif
+
+    struct digit_block
+    {
+        inline static boost::uint64_t load(char const* p)
+        {
+            boost::uint64_t block;
+            std::memcpy(&block, p, 8);
+            return block;
+        }
+
+        // the number of leading digits in the block
+        inline static unsigned digits(boost::uint64_t block)
+        {
+            boost::uint64_t const ones = ~boost::uint64_t(0) / 0xff;
+            boost::uint64_t const high = ones * 0xf0;
+
+            // a byte is a digit if its high nibble is 3 and stays 3 when
+            // adding 6 (carries only propagate past non-digits)
+            boost::uint64_t const non_digits =
+                ((block & high) | (((block + ones * 0x06) & high) >> 4))
+                    ^ (ones * 0x33);
+
+            if (non_digits == 0)
+                return 8;
+#if defined(__GNUC__)
+            return static_cast<unsigned>(__builtin_ctzll(non_digits)) / 8;
+#else
+            unsigned n = 0;
+            for (boost::uint64_t b = non_digits; (b & 0xff) == 0; b >>= 8)
+                ++n;
+            return n;
+#endif
+        }
+
+        // the value of the first n (1 <= n <= 8) digits of the block
+        inline static boost::uint64_t value(boost::uint64_t block, unsigned n)
+        {
+            boost::uint64_t const ones = ~boost::uint64_t(0) / 0xff;
+
+            // move the digits to the most significant bytes, the zero bytes
+            // shifted in front of them are leading zeros
+            block = (block << (64 - 8 * n)) & (ones * 0x0f);
+
+            // combine pairs of digits, then pairs of pairs and so on
+            block = (block * (10 * 0x100 + 1)) >> 8;
+            block = ((block & (ones * 0xff / 0x101)) * (100 * 0x10000 + 1)) >> 16;
+            return ((block & (~boost::uint64_t(0) / 0x10001))
+                * ((boost::uint64_t(10000) << 32) + 1)) >> 32;
+        }
+
+        inline static boost::uint64_t power(unsigned n)
+        {
+            static boost::uint64_t const powers[] =
+            {
+                1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+            };
+            return powers[n];
+        }
+    };
+
+    template <typename Iterator>
+    struct is_contiguous_char_iterator
+      : mpl::or_<
+            is_same<Iterator, char const*>
+          , is_same<Iterator, char*>
+          , is_same<Iterator, std::string::const_iterator>
+          , is_same<Iterator, std::string::iterator>
+        >
+    {};
+
+    template <typename Accumulator>
+    struct is_decimal_accumulator : mpl::false_ {};
+
+    template <>
+    struct is_decimal_accumulator<positive_accumulator<10> > : mpl::true_ {};
+
+    template <>
+    struct is_decimal_accumulator<negative_accumulator<10> > : mpl::true_ {};
+
+    // 64 bit integers: a 32 bit integer overflows on the next digit
+    // anyway once the blocks would start (after nine or ten digits), so
+    // it keeps the digit by digit loop without the extra branch
+    template <typename T>
+    struct is_digit_block_value
+      : mpl::bool_<is_integral<T>::value && sizeof(T) == 8>
+    {};
+
+    template <typename Accumulator, typename Iterator, typename T
+      , typename Enable = void>
+    struct digit_blocks
+    {
+        // not applicable, extract_int converts digit by digit
+        BOOST_STATIC_CONSTANT(bool, enabled = false);
+
+        inline static bool
+        call(Iterator& /*it*/, Iterator const& /*last*/
+          , std::size_t& /*count*/, T& /*n*/)
+        {
+            return true;
+        }
+    };
+
+#if SPIRIT_NUMERICS_DIGIT_BLOCKS
+    template <typename Accumulator, typename Iterator, typename T>
+    struct digit_blocks<Accumulator, Iterator, T
+      , typename enable_if<
+            mpl::and_<
+                is_decimal_accumulator<Accumulator>
+              , is_contiguous_char_iterator<Iterator>
+              , is_digit_block_value<T>
+            >
+        >::type>
+    {
+        BOOST_STATIC_CONSTANT(bool, enabled = true);
+
+        // check for overflow only where a digit by digit conversion would
+        // start checking
+        inline static bool
+        add(T& n, boost::uint64_t block, unsigned digits, std::size_t count)
+        {
+            static std::size_t const
+                overflow_free = digits_traits<T, 10>::value - 1;
+
+            T const scale = static_cast<T>(digit_block::power(digits));
+            if (!traits::check_overflow<T>::value
+                || count + digits <= overflow_free)
+            {
+                Accumulator::add_block(n, static_cast<T>(block), scale
+                  , mpl::false_());
+                return true;
+            }
+            return Accumulator::add_block(n, static_cast<T>(block), scale
+              , mpl::true_());
+        }
+
+        // convert the rest of the number, return false on over/underflow
+        // (at least eight digits of the number precede it)
+        inline static bool
+        call(Iterator& it, Iterator const& last, std::size_t& count, T& n)
+        {
+            while (last - it >= 8)
+            {
+                boost::uint64_t const block = digit_block::load(&*it);
+                unsigned const digits = digit_block::digits(block);
+                if (digits == 0)
+                    return true;
+
+                if (!add(n, digit_block::value(block, digits), digits, count))
+                    return false;   //  over/underflow!
+
+                it += digits;
+                count += digits;
+                if (digits != 8)
+                    return true;
+            }
+
+            std::ptrdiff_t const rest = last - it;
+            if (rest == 0)
+                return true;
+
+            // the last few characters of the input: load the eight
+            // characters ending at last (the digits already converted
+            // before them) and shift the remaining ones into place,
+            // followed by zero bytes, which are not digits
+            boost::uint64_t const block =
+                digit_block::load(&*it - (8 - rest)) >> (8 * (8 - rest));
+            unsigned const digits = digit_block::digits(block);
+            if (digits == 0)
+                return true;
+
+            if (!add(n, digit_block::value(block, digits), digits, count))
+                return false;   //  over/underflow!
+
+            it += digits;
+            count += digits;
+            return true;
+        }
+    };
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     //  extract_int: main code for extracting integers
     ///////////////////////////////////////////////////////////////////////////
@@ -439,6 +685,27 @@ namespace boost { namespace spirit { namespace qi { namespace detail
                 BOOST_PP_REPEAT(
                     SPIRIT_NUMERICS_LOOP_UNROLL
                   , SPIRIT_NUMERIC_INNER_LOOP, _)
+
+                // a long number: convert the rest in blocks of digits, where
+                // possible (the first eight digits are converted faster one
+                // by one, as long as the branch predictor can tell where
+                // the numbers end). The blocks work on copies, which keeps
+                // the variables of the loop above in registers.
+                if (digit_blocks<Accumulator, Iterator, attribute_type>::enabled
+                    && count >= 7)
+                {
+                    Iterator rest = it;
+                    std::size_t digits = count;
+                    attribute_type n = val;
+                    if (!digit_blocks<Accumulator, Iterator, attribute_type>::
+                            call(rest, last, digits, n))
+                    {
+                        return false;
+                    }
+                    traits::assign_to(n, attr);
+                    first = rest;
+                    return true;
+                }
             }
 
             traits::assign_to(val, attr);
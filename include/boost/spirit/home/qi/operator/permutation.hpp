@@ -14,15 +14,16 @@
 #include <boost/spirit/home/qi/meta_compiler.hpp>
 #include <boost/spirit/home/qi/detail/permute_function.hpp>
 #include <boost/spirit/home/qi/detail/attributes.hpp>
-#include <boost/spirit/home/support/algorithm/any_if_ns.hpp>
 #include <boost/spirit/home/support/detail/what_function.hpp>
 #include <boost/spirit/home/support/has_semantic_action.hpp>
 #include <boost/spirit/home/support/handles_container.hpp>
 #include <boost/spirit/home/support/info.hpp>
 #include <boost/fusion/include/size.hpp>
+#include <boost/fusion/include/for_each.hpp>
 #include <boost/optional.hpp>
-#include <boost/foreach.hpp>
-#include <boost/array.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <bitset>
+#include <cstddef>
 
 namespace boost { namespace spirit
 {
@@ -62,8 +63,15 @@ namespace boost { namespace spirit { namespace qi
             type;
         };
 
+        typedef std::bitset<fusion::result_of::size<Elements>::value>
+            flags_type;
+
         permutation(Elements const& elements_)
-          : elements(elements_) {}
+          : elements(elements_), dispatch(false)
+        {
+            first_char_function f(first_chars, dispatch);
+            fusion::for_each(elements, f);
+        }
 
         template <typename Iterator, typename Context
           , typename Skipper, typename Attribute>
@@ -75,28 +83,57 @@ namespace boost { namespace spirit { namespace qi
             detail::permute_function<Iterator, Context, Skipper>
                 f(first, last, context, skipper);
 
-            boost::array<bool, fusion::result_of::size<Elements>::value> flags;
-            BOOST_FOREACH(bool& taken, flags)
-            {
-                taken = false;
-            }
-
             // wrap the attribute in a tuple if it is not a tuple
-            typename traits::wrap_if_not_tuple<Attribute>::type attr_local(attr_);
-
-            // We have a bool array 'flags' with one flag for each parser.
-            // permute_function sets the slot to true when the corresponding
-            // parser successful matches. We loop until there are no more
-            // successful parsers.
-
-            bool result = false;
-            f.taken = flags.begin();
-            while (spirit::any_if_ns(elements, attr_local, f, predicate()))
+            typedef typename traits::wrap_if_not_tuple<Attribute>::type
+                attribute_type;
+            attribute_type attr_local(attr_);
+
+            typedef detail::permute_table<predicate, Elements
+              , typename remove_reference<attribute_type>::type
+              , detail::permute_function<Iterator, Context, Skipper>
+            > table_type;
+            table_type const& table = table_type::get();
+
+            // We have a bitset 'flags' with one flag for each parser, set
+            // when the corresponding parser successfully matches. At each
+            // position we try the parsers not matched yet, in order,
+            // starting after the one which matched last (this is what
+            // looping over all the parsers until none of them matches
+            // did). If the first character of some of the parsers is
+            // known, only those matching the next input character (and
+            // those with an unknown one) are tried. We stop when no parser
+            // matches or all of them did.
+            std::size_t const size = fusion::result_of::size<Elements>::value;
+            flags_type flags;
+            std::size_t next = 0;
+            std::size_t matched = 0;
+
+            while (matched != size)
             {
-                f.taken = flags.begin();
-                result = true;
+                int const ch = dispatch ? f.peek() : -1;
+
+                std::size_t index = next;
+                std::size_t tried = 0;
+                for (/**/; tried != size; ++tried)
+                {
+                    if (!flags[index] &&
+                        (ch < 0 || first_chars[index] < 0 ||
+                         first_chars[index] == ch) &&
+                        table.functions[index](elements, attr_local, f))
+                    {
+                        break;
+                    }
+                    if (++index == size)
+                        index = 0;
+                }
+                if (tried == size)
+                    break;
+
+                flags[index] = true;
+                next = (index + 1 == size) ? 0 : index + 1;
+                ++matched;
             }
-            return result;
+            return matched != 0;
         }
 
         template <typename Context>
@@ -109,6 +146,33 @@ namespace boost { namespace spirit { namespace qi
         }
 
         Elements elements;
+
+        // the first character of each parser (see detail::first_char),
+        // dispatch is true if at least one of them is known
+        int first_chars[fusion::result_of::size<Elements>::value];
+        bool dispatch;
+
+    private:
+        struct first_char_function
+        {
+            first_char_function(int* first_chars_, bool& dispatch_)
+              : first_chars(first_chars_), dispatch(dispatch_) {}
+
+            template <typename Component>
+            void operator()(Component const& component) const
+            {
+                *first_chars = detail::first_char<Component>::call(component);
+                if (*first_chars++ >= 0)
+                    dispatch = true;
+            }
+
+            mutable int* first_chars;
+            bool& dispatch;
+
+        private:
+            // silence MSVC warning C4512: assignment operator could not be generated
+            first_char_function& operator= (first_char_function const&);
+        };
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -261,8 +261,9 @@ public:
         {
             qi::skip_over(first, last, skipper);
 
+            lookup_read_guard<Lookup> guard(*lookup);
             if (value_type* val_ptr
-                = lookup->find(first, last, Filter()))
+                = guard.find(first, last, Filter()))
             {
                 spirit::traits::assign_to(*val_ptr, attr_);
                 return true;
@@ -24,6 +24,32 @@ namespace boost { namespace spirit { namespace qi
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  symbols::parse looks up the input through a lookup_read_guard, which
+    //  it holds while it assigns the value found to the attribute. Lookup tables
+    //  which can be modified while other threads parse (see tst_snapshot.hpp)
+    //  keep the value alive as long as the guard exists.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lookup>
+    struct lookup_read_guard
+    {
+        explicit lookup_read_guard(Lookup const& lookup_)
+          : lookup(lookup_) {}
+
+        template <typename Iterator, typename Filter>
+        typename Lookup::value_type*
+        find(Iterator& first, Iterator last, Filter filter) const
+        {
+            return lookup.find(first, last, filter);
+        }
+
+        Lookup const& lookup;
+
+    private:
+        // silence MSVC warning C4512: assignment operator could not be generated
+        lookup_read_guard& operator= (lookup_read_guard const&);
+    };
+
     template <typename Char, typename T>
     struct tst
     {
@@ -0,0 +1,299 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_TST_SNAPSHOT_OCTOBER_19_2026_0310PM)
+#define BOOST_SPIRIT_TST_SNAPSHOT_OCTOBER_19_2026_0310PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/string/tst.hpp>
+#include <boost/atomic.hpp>
+#include <boost/call_traits.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost { namespace spirit { namespace qi
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  tst_snapshot is a Lookup for symbols which may be modified while other
+    //  threads are parsing with it. The entries are kept in an immutable
+    //  Lookup (a tst by default), which readers use without taking a lock.
+    //  Every modification copies the current Lookup, modifies the copy and
+    //  publishes it atomically, so the parsers see either the old or the new
+    //  set of entries, never a partially modified one. The old Lookup is
+    //  deleted as soon as no reader which might still use it is left.
+    //
+    //  Readers announce themselves in one of 64 counters, chosen by the
+    //  address of their stack, so parsing threads rarely contend on the
+    //  same counter (threads may share one, and the counter of a thread
+    //  may change with the depth of its stack). Writers are serialized
+    //  and wait for the readers (which only stay for a single lookup)
+    //  before deleting the old Lookup. Every modification copies the
+    //  whole table: add many entries at once by assigning a complete
+    //  table (symbols::operator=) instead of one by one.
+    //
+    //  A writer waits until every counter has been seen at zero once after
+    //  publishing, so it may be starved by readers keeping the counters
+    //  busy without pause. for_each holds a reader count while it calls
+    //  the function: a function modifying the same table deadlocks.
+    //
+    //  The values returned by find (and by symbols::find, prefix_find and
+    //  at) stay valid until the next modification only.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T, typename Lookup = tst<Char, T> >
+    struct tst_snapshot
+    {
+        typedef Char char_type; // the character type
+        typedef T value_type; // the value associated with each entry
+        typedef Lookup lookup_type;
+
+        tst_snapshot()
+          : current(new Lookup())
+          , writing(false)
+        {
+            init();
+        }
+
+        ~tst_snapshot()
+        {
+            delete current.load(boost::memory_order_relaxed);
+            for (std::size_t i = 0; i != reader_slots; ++i)
+                readers[i].~reader_slot();
+        }
+
+        tst_snapshot(tst_snapshot const& rhs)
+          : current(0)
+          , writing(false)
+        {
+            init();
+            current.store(rhs.copy(), boost::memory_order_relaxed);
+        }
+
+        tst_snapshot& operator=(tst_snapshot const& rhs)
+        {
+            if (this != &rhs)
+            {
+                write_lock lock(*this);
+                publish(rhs.copy());
+            }
+            return *this;
+        }
+
+        template <typename Iterator, typename Filter>
+        T* find(Iterator& first, Iterator last, Filter filter) const
+        {
+            read_lock lock(*this);
+            return current.load(boost::memory_order_seq_cst)->
+                find(first, last, filter);
+        }
+
+        template <typename Iterator>
+        T* find(Iterator& first, Iterator last) const
+        {
+            return find(first, last, tst_pass_through());
+        }
+
+        template <typename Iterator>
+        T* add(
+            Iterator first
+          , Iterator last
+          , typename boost::call_traits<T>::param_type val)
+        {
+            write_lock lock(*this);
+            Lookup* next = new Lookup(*current.load(boost::memory_order_relaxed));
+            T* result = 0;
+            try
+            {
+                result = next->add(first, last, val);
+            }
+            catch (...)
+            {
+                delete next;
+                throw;
+            }
+            publish(next);
+            return result;
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            write_lock lock(*this);
+            Lookup* next = new Lookup(*current.load(boost::memory_order_relaxed));
+            try
+            {
+                next->remove(first, last);
+            }
+            catch (...)
+            {
+                delete next;
+                throw;
+            }
+            publish(next);
+        }
+
+        void clear()
+        {
+            write_lock lock(*this);
+            publish(new Lookup());
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            read_lock lock(*this);
+            current.load(boost::memory_order_seq_cst)->for_each(f);
+        }
+
+    private:
+        template <typename Lookup_>
+        friend struct lookup_read_guard;
+
+        // the readers of a thread count themselves in the reader slot
+        // selected by the address of their stack, every slot is kept on a
+        // cache line of its own: the slots start at the first cache line
+        // boundary of reader_storage, whatever alignment the tst_snapshot
+        // itself is allocated with
+        enum { reader_slots = 64, cache_line = 64 };
+
+        struct reader_slot
+        {
+            boost::atomic<std::size_t> count;
+            char padding[cache_line - sizeof(boost::atomic<std::size_t>)];
+        };
+
+        static std::size_t reader_slot_index()
+        {
+            char local;
+            boost::uint32_t const page = static_cast<boost::uint32_t>(
+                reinterpret_cast<std::size_t>(&local) >> 12);
+            return (page * 2654435769u) >> 26;      // 0 .. 63
+        }
+
+        struct read_lock
+        {
+            explicit read_lock(tst_snapshot const& lookup_)
+              : lookup(lookup_), slot(reader_slot_index())
+            {
+                lookup.readers[slot].count.fetch_add(1
+                  , boost::memory_order_seq_cst);
+            }
+
+            ~read_lock()
+            {
+                lookup.readers[slot].count.fetch_sub(1
+                  , boost::memory_order_release);
+            }
+
+            tst_snapshot const& lookup;
+            std::size_t slot;
+
+        private:
+            // silence MSVC warning C4512: assignment operator could not be generated
+            read_lock& operator= (read_lock const&);
+        };
+
+        struct write_lock
+        {
+            explicit write_lock(tst_snapshot& lookup_)
+              : lookup(lookup_)
+            {
+                for (unsigned k = 0;
+                    lookup.writing.exchange(true, boost::memory_order_acquire);
+                    ++k)
+                {
+                    boost::detail::yield(k);
+                }
+            }
+
+            ~write_lock()
+            {
+                lookup.writing.store(false, boost::memory_order_release);
+            }
+
+            tst_snapshot& lookup;
+
+        private:
+            // silence MSVC warning C4512: assignment operator could not be generated
+            write_lock& operator= (write_lock const&);
+        };
+
+        void init()
+        {
+            std::size_t const misalignment =
+                reinterpret_cast<std::size_t>(reader_storage) % cache_line;
+            readers = reinterpret_cast<reader_slot*>(reader_storage
+              + (cache_line - misalignment) % cache_line);
+
+            for (std::size_t i = 0; i != reader_slots; ++i)
+            {
+                new (&readers[i]) reader_slot;
+                readers[i].count.store(0, boost::memory_order_relaxed);
+            }
+        }
+
+        Lookup* copy() const
+        {
+            read_lock lock(*this);
+            return new Lookup(*current.load(boost::memory_order_seq_cst));
+        }
+
+        // publish the next Lookup (called by the writer holding the lock),
+        // wait until no reader might use the old one anymore and delete it
+        void publish(Lookup* next)
+        {
+            Lookup* old = current.load(boost::memory_order_relaxed);
+            current.store(next, boost::memory_order_seq_cst);
+
+            // A reader which counted itself before the new Lookup was
+            // published is seen here; one which counts itself later loads
+            // the new Lookup.
+            for (std::size_t i = 0; i != reader_slots; ++i)
+            {
+                for (unsigned k = 0;
+                    readers[i].count.load(boost::memory_order_seq_cst) != 0;
+                    ++k)
+                {
+                    boost::detail::yield(k);
+                }
+            }
+            delete old;
+        }
+
+        boost::atomic<Lookup*> current;
+        boost::atomic<bool> writing;
+        char reader_storage[(reader_slots + 1) * cache_line];
+        reader_slot* readers;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  keep the Lookup used by symbols::parse alive until the value found
+    //  has been assigned to the attribute
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T, typename Lookup>
+    struct lookup_read_guard<tst_snapshot<Char, T, Lookup> >
+      : tst_snapshot<Char, T, Lookup>::read_lock
+    {
+        explicit lookup_read_guard(tst_snapshot<Char, T, Lookup> const& snapshot)
+          : tst_snapshot<Char, T, Lookup>::read_lock(snapshot)
+          , current(snapshot.current.load(boost::memory_order_seq_cst))
+        {}
+
+        template <typename Iterator, typename Filter>
+        T* find(Iterator& first, Iterator last, Filter filter) const
+        {
+            return current->find(first, last, filter);
+        }
+
+        Lookup const* current;
+    };
+}}}
+
+#endif
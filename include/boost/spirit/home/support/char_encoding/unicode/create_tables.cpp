@@ -44,6 +44,7 @@ using boost::phoenix::ref;
 using boost::uint8_t;
 using boost::uint16_t;
 using boost::uint32_t;
+using boost::int32_t;
 
 // a char range
 struct ucd_range
@@ -338,7 +339,7 @@ private:
     ucd_vector info;
 };
 
-template <typename T, uint32_t block_size_ = 256>
+template <typename T, uint32_t block_size_ = 256, typename Stage1 = uint8_t>
 class ucd_table_builder
 {
 public:
@@ -346,6 +347,7 @@ public:
     static uint32_t const block_size = block_size_;
     static uint32_t const full_span = 0x110000;
     typedef T value_type;
+    typedef Stage1 stage1_type;
 
     ucd_table_builder() : p(new T[full_span])
     {
@@ -360,7 +362,17 @@ public:
         info.collect(p, field, collect_properties);
     }
 
-    void build(std::vector<uint8_t>& stage1, std::vector<T const*>& stage2)
+    T& operator[](uint32_t ch)
+    {
+        return p[ch];
+    }
+
+    T const& operator[](uint32_t ch) const
+    {
+        return p[ch];
+    }
+
+    void build(std::vector<Stage1>& stage1, std::vector<T const*>& stage2)
     {
         std::cout << "building tables" << std::endl;
         std::map<block_ptr, std::vector<T const*> > blocks;
@@ -368,7 +380,7 @@ public:
             blocks[block_ptr(i)].push_back(i);
 
         // Not enough bits to store the block indices.
-        BOOST_ASSERT(blocks.size() < (1 << (sizeof(uint8_t) * 8)));
+        BOOST_ASSERT(blocks.size() < (1u << (sizeof(Stage1) * 8)));
 
         typedef std::pair<block_ptr, std::vector<T const*> > blocks_value_type;
         std::map<T const*, std::vector<T const*> > sorted_blocks;
@@ -426,8 +438,8 @@ void print_table(Out& out, C const& c, bool trailing_comma, int width = 4, int g
     typename C::size_type size = c.size();
     BOOST_ASSERT(size > 1);
     print_tab(out, tab);
-    out << std::setw(width) << int(c[0]);
-    for (C::size_type i = 1; i < size; ++i)
+    out << std::setw(width) << static_cast<unsigned long>(c[0]);
+    for (typename C::size_type i = 1; i < size; ++i)
     {
         out << ", ";
         if ((i % group) == 0)
@@ -435,7 +447,7 @@ void print_table(Out& out, C const& c, bool trailing_comma, int width = 4, int g
             out << std::endl;
             print_tab(out, tab);
         }
-        out << std::setw(width) << int(c[i]);
+        out << std::setw(width) << static_cast<unsigned long>(c[i]);
     }
 
     if (trailing_comma)
@@ -483,29 +495,31 @@ char const* get_int_type_name(int size)
 }
 
 template <typename Out, typename Builder>
-void print_file(Out& out, Builder& builder, int field_width, char const* name)
+void print_tables(Out& out, Builder& builder, int field_width, char const* name)
 {
     std::cout << "Generating " << name << " tables" << std::endl;
 
     uint32_t const block_size = Builder::block_size;
     typedef typename Builder::value_type value_type;
-    print_head(out);
+    typedef typename Builder::stage1_type stage1_type;
 
-    std::vector<uint8_t> stage1;
+    std::vector<stage1_type> stage1;
     std::vector<value_type const*> stage2;
     builder.build(stage1, stage2);
     std::cout << "Block Size: " << block_size << std::endl;
     std::cout << "Total Bytes: "
-        << stage1.size()+(stage2.size()*block_size*sizeof(value_type))
+        << stage1.size()*sizeof(stage1_type)
+            + (stage2.size()*block_size*sizeof(value_type))
         << std::endl;
 
     out
         << "\n"
-        << "    static const ::boost::uint8_t " << name << "_stage1[] = {\n"
+        << "    static const " << get_int_type_name(sizeof(stage1_type))
+        << ' ' << name << "_stage1[] = {\n"
         << "\n"
         ;
 
-    print_table(out, stage1, false, 3);
+    print_table(out, stage1, false, sizeof(stage1_type) == 1 ? 3 : 5);
     char const* int_name = get_int_type_name(sizeof(value_type));
 
     out
@@ -540,44 +554,92 @@ void print_file(Out& out, Builder& builder, int field_width, char const* name)
         << "        return " << name << "_stage2[block_offset + ch % " << block_size << "];\n"
         << "    }\n"
         ;
-
-    print_tail(out);
 }
 
-int main()
+// The case mappings are stored as (lowercase, uppercase) deltas. There
+// are only a few distinct pairs, so the properties table stores an index
+// into this table.
+template <typename Out>
+void print_case_deltas(Out& out, std::vector<std::pair<int32_t, int32_t> > const& deltas)
 {
-    // The category tables
-    {
-        std::ofstream out("category_table.hpp");
-        ucd_table_builder<uint16_t, 256> builder;
-        builder.collect("UnicodeData.txt", 2);
-        builder.collect("DerivedCoreProperties.txt", 1);
-        builder.collect("PropList.txt", 1);
-        print_file(out, builder, 4, "category");
-    }
+    std::cout << "Generating case delta table" << std::endl;
+    std::cout << "Total Bytes: " << deltas.size()*2*sizeof(int32_t) << std::endl;
 
-    // The script tables
-    {
-        std::ofstream out("script_table.hpp");
-        ucd_table_builder<uint8_t, 256> builder;
-        builder.collect("Scripts.txt", 1);
-        print_file(out, builder, 3, "script");
-    }
+    out
+        << "\n"
+        << "    static const ::boost::int32_t case_deltas[][2] = {\n"
+        ;
 
-    // The lowercase tables
+    for (std::size_t i = 0; i < deltas.size(); ++i)
     {
-        std::ofstream out("lowercase_table.hpp");
-        ucd_table_builder<uint32_t, 256> builder;
-        builder.collect("UnicodeData.txt", 13, false);
-        print_file(out, builder, 6, "lowercase");
+        out << "\n    {" << std::setw(7) << deltas[i].first
+            << ", " << std::setw(7) << deltas[i].second << " }";
+        if (i+1 != deltas.size())
+            out << ',';
     }
 
-    // The uppercase tables
+    out
+        << "\n"
+        << "    };"
+        << "\n"
+        ;
+}
+
+int main()
+{
+    // The collected per code point data
+    ucd_table_builder<uint16_t> category;
+    category.collect("UnicodeData.txt", 2);
+    category.collect("DerivedCoreProperties.txt", 1);
+    category.collect("PropList.txt", 1);
+
+    ucd_table_builder<uint8_t> script;
+    script.collect("Scripts.txt", 1);
+
+    ucd_table_builder<uint32_t> lowercase;
+    lowercase.collect("UnicodeData.txt", 13, false);
+
+    ucd_table_builder<uint32_t> uppercase;
+    uppercase.collect("UnicodeData.txt", 12, false);
+
+    // The packed properties table. Bit pattern of an entry:
+    //
+    //  bits  0..12:    category and derived properties (see query.hpp)
+    //  bits 13..19:    script
+    //  bits 20..31:    index into the case_deltas table
     {
-        std::ofstream out("uppercase_table.hpp");
-        ucd_table_builder<uint32_t, 256> builder;
-        builder.collect("UnicodeData.txt", 12, false);
-        print_file(out, builder, 6, "uppercase");
+        typedef std::pair<int32_t, int32_t> delta_pair;
+        std::vector<delta_pair> deltas;
+        std::map<delta_pair, uint32_t> delta_index;
+        deltas.push_back(delta_pair(0, 0)); // maps to itself
+        delta_index[deltas.back()] = 0;
+
+        ucd_table_builder<uint32_t, 128, uint16_t> builder;
+        for (uint32_t ch = 0; ch < builder.full_span; ++ch)
+        {
+            // The tables hold 0 to signal that a code maps to itself
+            delta_pair d(
+                lowercase[ch] ? int32_t(lowercase[ch] - ch) : 0
+              , uppercase[ch] ? int32_t(uppercase[ch] - ch) : 0);
+
+            std::map<delta_pair, uint32_t>::iterator i = delta_index.find(d);
+            if (i == delta_index.end())
+            {
+                i = delta_index.insert(std::make_pair(d, uint32_t(deltas.size()))).first;
+                deltas.push_back(d);
+            }
+
+            BOOST_ASSERT(category[ch] < (1 << 13));
+            BOOST_ASSERT(script[ch] < (1 << 7));
+            BOOST_ASSERT(i->second < (1 << 12));
+            builder[ch] = category[ch] | (uint32_t(script[ch]) << 13) | (i->second << 20);
+        }
+
+        std::ofstream out("properties_table.hpp");
+        print_head(out);
+        print_tables(out, builder, 10, "properties");
+        print_case_deltas(out, deltas);
+        print_tail(out);
     }
 
     return 0;
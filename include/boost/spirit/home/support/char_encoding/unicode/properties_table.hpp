@@ -0,0 +1,2642 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+    AUTOGENERATED. DO NOT EDIT!!!
+==============================================================================*/
+#include <boost/cstdint.hpp>
+
+namespace boost { namespace spirit { namespace ucd { namespace detail
+{
+    static const ::boost::uint16_t properties_stage1[] = {
+
+        0,     1,     2,     3,     4,     5,     6,     7,     8,     9,    10,    11,    12,    13,    14,    15, 
+       16,    17,    18,    19,    20,    21,    22,    23,    24,    25,    26,    27,    28,    29,    30,    31, 
+       32,    33,    34,    35,    36,    37,    38,    39,    40,    41,    41,    41,    42,    43,    44,    45, 
+       46,    47,    48,    49,    50,    51,    52,    53,    54,    55,    56,    57,    58,    59,    60,    61, 
+       62,    63,    64,    65,    66,    66,    67,    68,    69,    70,    71,    72,    73,    74,    75,    76, 
+       77,    77,    66,    78,    66,    66,    79,    17,    80,    81,    82,    83,    84,    85,    86,    87, 
+       88,    89,    90,    91,    92,    93,    94,    71,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    96,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    97, 
+       98,    99,    99,    99,    99,    99,    99,    99,    99,   100,   101,   101,   102,   103,   104,   105, 
+      106,   107,   108,   109,   110,   111,    17,   112,   113,   113,   113,   113,   113,   113,   113,   113, 
+      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113, 
+      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113, 
+      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113, 
+      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113, 
+      113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   113,   114, 
+      115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115,   115, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,    95,    95,   117,   118,   119,   120,   121,   121,   122,   123,   124,   125,   126,   127, 
+      128,   129,   130,   131,    17,   132,   133,   134,   135,   136,    17,    17,    17,    17,    17,    17, 
+      137,    17,   138,    17,   139,    17,   140,    17,   141,    17,    17,    17,    17,    17,    17,    17, 
+       17,   142,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+      143,   143,   143,   143,   143,   143,   144,    17,   145,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+      146,   146,   146,   146,   146,   146,   146,   146,   147,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       71,   148,   149,   150,   151,    17,   152,    17,   153,   154,   155,   156,   157,   158,   159,   160, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+      161,   162,   163,   164,   165,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95, 
+       95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,    95,   167,   168,   168, 
+      168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168, 
+      168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   168,   169,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       95,    95,    95,    95,   170,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+      171,   172,   173,   174,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172, 
+      172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172,   172, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17, 
+       17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,    17,   166, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   175, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116, 
+      116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   116,   175
+    };
+
+    static const ::boost::uint32_t properties_stage2[] = {
+
+    // block 0
+        753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     754208,     754208,     754208,     754208,     754208,     753696,     753696, 
+        753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696, 
+        754200,     753708,     753708,     753708,     753713,     753708,     753708,     753708,     753705,     753706,     753708,     753712,     753708,     753704,     753708,     753708, 
+        754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     753708,     753708,     753712,     753712,     753712,     753708, 
+        753708,    1410240,    1410240,    1410240,    1410240,    1410240,    1410240,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216, 
+       1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,     753705,     753708,     753706,     753714,     753707, 
+        753714,    2458945,    2458945,    2458945,    2458945,    2458945,    2458945,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921, 
+       2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,     753705,     753712,     753706,     753712,     753696, 
+
+
+    // block 1
+        753696,     753696,     753696,     753696,     753696,     754208,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696, 
+        753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696,     753696, 
+        754200,     753708,     753713,     753713,     753713,     753713,     753715,     753715,     753714,     753715,     360769,     753709,     753712,     757793,     753715,     753714, 
+        753715,     753712,     753682,     753682,     753714,    3899713,     753715,     753708,     753714,     753682,     360769,     753710,     753682,     753682,     753682,     753708, 
+       1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216, 
+       1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,     753712,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,     360769, 
+       2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921, 
+       2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,     753712,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    4555073, 
+
+
+    // block 2
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       7700672,    8749377,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,     360769,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520, 
+       6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,     360769,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    9797824,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,   10846529, 
+
+
+    // block 3
+      11895105,   12943552,    5603520,    6652225,    5603520,    6652225,   13992128,    5603520,    6652225,   15040704,   15040704,    5603520,    6652225,     360769,   16089280,   17137856, 
+      18186432,    5603520,    6652225,   15040704,   19235008,   20283713,   21332160,   22380736,    5603520,    6652225,   23429441,     360769,   21332160,   24477888,   25526593,   26575040, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,   27623616,    5603520,    6652225,   27623616,     360769,     360769,    5603520,    6652225,   27623616,    5603520, 
+       6652225,   28672192,   28672192,    5603520,    6652225,    5603520,    6652225,   29720768,    5603520,    6652225,     360769,     360516,    5603520,    6652225,     360769,   30769473, 
+        360516,     360516,     360516,     360516,   31817920,   32866370,   33915201,   31817920,   32866370,   33915201,   31817920,   32866370,   33915201,    5603520,    6652225,    5603520, 
+       6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,   34963777,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+        360769,   31817920,   32866370,   33915201,    5603520,    6652225,   36012224,   37060800,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+
+
+    // block 4
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+      38109376,     360769,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,     360769,     360769,     360769,     360769,     360769,     360769,   39157952,    5603520,    6652225,   40206528,   41255104,     360769, 
+        360769,    5603520,    6652225,   42303680,   43352256,   44400832,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+      45449537,   46498113,     360769,   47546689,   48595265,     360769,   49643841,   49643841,     360769,   50692417,     360769,   51740993,     360769,     360769,     360769,     360769, 
+      49643841,     360769,     360769,   52789569,     360769,     360769,     360769,     360769,   53838145,   54886721,     360769,   55935297,     360769,     360769,     360769,   54886721, 
+        360769,   56983873,   58032449,     360769,     360769,   59081025,     360769,     360769,     360769,     360769,     360769,     360769,     360769,   60129601,     360769,     360769, 
+
+
+    // block 5
+      61178177,     360769,     360769,   61178177,     360769,     360769,     360769,     360769,   61178177,   62226753,   63275329,   63275329,   64323905,     360769,     360769,     360769, 
+        360769,     360769,   65372481,     360769,     360516,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769, 
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     753731,     753731,     753731,     753731,     753731,     753731,     753731, 
+        753987,     753987,     753714,     753714,     753714,     753714,     753731,     753731,     753731,     753731,     753731,     753731,     753731,     753731,     753731,     753731, 
+        753731,     753731,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714, 
+        360771,     360771,     360771,     360771,     360771,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753731,     753714,     753731,     753714, 
+        753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714, 
+
+
+    // block 6
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,   66806088,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     749576, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+       5447872,    6496577,    5447872,    6496577,     753731,     204850,    5447872,    6496577,          0,          0,     205123,   25370945,   25370945,   25370945,     753708,          0, 
+
+
+    // block 7
+             0,          0,          0,          0,     204850,     753714,   67313856,     753708,   68362432,   68362432,   68362432,          0,   69411008,          0,   70459584,   70459584, 
+        205121,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568, 
+       1253568,    1253568,          0,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,    1253568,   71508289,   72556865,   72556865,   72556865, 
+        205121,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273, 
+       2302273,    2302273,   73605441,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,    2302273,   74654017,   75702593,   75702593,   76751040, 
+      77799745,   78848321,     204992,     204992,     204992,   79896897,   80945473,   81994049,    5447872,    6496577,    5447872,    6496577,    5447872,    6496577,    5447872,    6496577, 
+       5447872,    6496577,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+      83042625,   84091201,   85139777,     205121,   86188224,   87236929,     204848,    5447872,    6496577,   88285376,    5447872,    6496577,     205121,   37953728,   37953728,   37953728, 
+
+
+    // block 8
+      89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416,   89268416, 
+       1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032, 
+       1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032,    1188032, 
+       2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737, 
+       2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737,    2236737, 
+      84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665,   84025665, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+
+
+    // block 9
+       5382336,    6431041,     139315,     139272,     139272,     745480,     745480,     139272,     139273,     139273,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+      90316992,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,   91365697, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+
+
+    // block 10
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,     139456,     139584,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264, 
+      92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264, 
+      92291264,   92291264,   92291264,   92291264,   92291264,   92291264,   92291264,          0,          0,      16451,      16428,      16428,      16428,      16428,      16428,      16428, 
+             0,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969, 
+      93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969, 
+
+
+    // block 11
+      93339969,   93339969,   93339969,   93339969,   93339969,   93339969,   93339969,      16705,          0,     753708,      16424,          0,          0,          0,          0,          0, 
+             0,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960, 
+        253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960,     253960, 
+        254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     254024,     253992,     254024, 
+        253996,     254024,     254024,     253996,     254024,     254024,     253996,     254024,          0,          0,          0,          0,          0,          0,          0,          0, 
+        254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020, 
+        254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,          0,          0,          0,          0,          0, 
+        254020,     254020,     254020,     253996,     253996,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 12
+        753697,     753697,     753697,     753697,          0,          0,         48,         48,         48,         44,         44,         49,     753708,         44,         51,         51, 
+            72,         72,         72,         72,         72,         72,         72,         72,         72,         72,         72,     753708,          0,          0,         44,     753708, 
+             0,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+        753731,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,     745544,     745544,     745544,     745544,     745544, 
+        745544,     745544,     745544,     745544,     745544,     745544,         72,         72,          8,         72,         72,         72,         72,         72,         72,          0, 
+        753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,         44,         44,         44,         44,         68,         68, 
+        745544,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 13
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         44,         68,         72,         72,         72,         72,         72,         72,         72,     753697,          9,          8, 
+             8,         72,         72,         72,         72,         67,         67,         72,         72,         51,          8,          8,          8,         72,         68,         68, 
+            16,         16,         16,         16,         16,         16,         16,         16,         16,         16,         68,         68,         68,         51,         51,         68, 
+
+
+    // block 14
+        606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,     606252,          0,     606241, 
+        606276,     606280,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276, 
+        606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276,     606276, 
+        606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280,     606280, 
+        606216,     606216,     606216,     606216,     606216,     606216,     606216,     606216,     606216,     606216,     606216,          0,          0,     606276,     606276,     606276, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 15
+        680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004, 
+        680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004,     680004, 
+        680004,     680004,     680004,     680004,     680004,     680004,     680008,     680008,     680008,     680008,     680008,     680008,     680008,     680008,     680008,     680008, 
+        680008,     680004,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        450576,     450576,     450576,     450576,     450576,     450576,     450576,     450576,     450576,     450576,     450628,     450628,     450628,     450628,     450628,     450628, 
+        450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628, 
+        450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450628,     450568,     450568,     450568,     450568,     450568, 
+        450568,     450568,     450568,     450568,     450627,     450627,     450611,     450604,     450604,     450604,     450627,          0,          0,          0,          0,          0, 
+
+
+    // block 16
+        548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928, 
+        548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548864,     548864,     548928,     548928,     548928,     548928,     548928,     548928, 
+        548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548928,     548864,          0,          0, 
+        548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,     548864,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 17
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 18
+        147520,     147528,     147528,     147530,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524, 
+        147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524, 
+        147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524, 
+        147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524,          0,          0,     147464,     147524,     147530,     147530, 
+        147530,     147528,     147528,     147528,     147528,     147528,     147528,     147528,     147528,     147530,     147530,     147530,     147530,     147464,     147520,          0, 
+        147524,     745480,     745480,     147464,     147464,     147520,          0,          0,     147524,     147524,     147524,     147524,     147524,     147524,     147524,     147524, 
+        147524,     147524,     147528,     147528,     753708,     753708,     147472,     147472,     147472,     147472,     147472,     147472,     147472,     147472,     147472,     147472, 
+        753708,     147523,     147524,          0,          0,          0,          0,          0,          0,     147520,     147520,     147524,     147524,     147524,     147524,     147524, 
+
+
+    // block 19
+             0,      49224,      49226,      49226,          0,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,          0,          0,      49220, 
+         49220,          0,          0,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220, 
+         49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,      49220,          0,      49220,      49220,      49220,      49220,      49220,      49220, 
+         49220,          0,      49220,          0,          0,          0,      49220,      49220,      49220,      49220,          0,          0,      49160,      49220,      49226,      49226, 
+         49226,      49224,      49224,      49224,      49224,          0,          0,      49226,      49226,          0,          0,      49226,      49226,      49160,      49220,          0, 
+             0,          0,          0,          0,          0,          0,          0,      49226,          0,          0,          0,          0,      49220,      49220,          0,      49220, 
+         49220,      49220,      49224,      49224,          0,          0,      49168,      49168,      49168,      49168,      49168,      49168,      49168,      49168,      49168,      49168, 
+         49220,      49220,      49201,      49201,      49170,      49170,      49170,      49170,      49170,      49170,      49203,      49152,          0,          0,          0,          0, 
+
+
+    // block 20
+             0,     221256,     221256,     221258,          0,     221252,     221252,     221252,     221252,     221252,     221252,          0,          0,          0,          0,     221252, 
+        221252,          0,          0,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252, 
+        221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,     221252,          0,     221252,     221252,     221252,     221252,     221252,     221252, 
+        221252,          0,     221252,     221252,          0,     221252,     221252,          0,     221252,     221252,          0,          0,     221192,          0,     221258,     221258, 
+        221258,     221256,     221256,          0,          0,          0,          0,     221256,     221256,          0,          0,     221256,     221256,     221192,          0,          0, 
+             0,     221256,          0,          0,          0,          0,          0,          0,          0,     221252,     221252,     221252,     221252,          0,     221252,          0, 
+             0,          0,          0,          0,          0,          0,     221200,     221200,     221200,     221200,     221200,     221200,     221200,     221200,     221200,     221200, 
+        221256,     221256,     221252,     221252,     221252,     221256,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 21
+             0,     213064,     213064,     213066,          0,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,          0,     213060, 
+        213060,     213060,          0,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060, 
+        213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,     213060,          0,     213060,     213060,     213060,     213060,     213060,     213060, 
+        213060,          0,     213060,     213060,          0,     213060,     213060,     213060,     213060,     213060,          0,          0,     213000,     213060,     213066,     213066, 
+        213066,     213064,     213064,     213064,     213064,     213064,          0,     213064,     213064,     213066,          0,     213066,     213066,     213000,          0,          0, 
+        213060,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        213060,     213060,     213064,     213064,          0,          0,     213008,     213008,     213008,     213008,     213008,     213008,     213008,     213008,     213008,     213008, 
+             0,     213041,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 22
+             0,     483400,     483402,     483402,          0,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,          0,          0,     483396, 
+        483396,          0,          0,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396, 
+        483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,     483396,          0,     483396,     483396,     483396,     483396,     483396,     483396, 
+        483396,          0,     483396,     483396,          0,     483396,     483396,     483396,     483396,     483396,          0,          0,     483336,     483396,     483402,     483400, 
+        483402,     483400,     483400,     483400,     483400,          0,          0,     483402,     483402,          0,          0,     483402,     483402,     483336,          0,          0, 
+             0,          0,          0,          0,          0,          0,     483400,     483402,          0,          0,          0,          0,     483396,     483396,          0,     483396, 
+        483396,     483396,     483400,     483400,          0,          0,     483344,     483344,     483344,     483344,     483344,     483344,     483344,     483344,     483344,     483344, 
+        483379,     483396,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 23
+             0,          0,     639048,     639044,          0,     639044,     639044,     639044,     639044,     639044,     639044,          0,          0,          0,     639044,     639044, 
+        639044,          0,     639044,     639044,     639044,     639044,          0,          0,          0,     639044,     639044,          0,     639044,          0,     639044,     639044, 
+             0,          0,          0,     639044,     639044,          0,          0,          0,     639044,     639044,     639044,          0,          0,          0,     639044,     639044, 
+        639044,     639044,     639044,     639044,     639044,     639044,     639044,     639044,     639044,     639044,          0,          0,          0,          0,     639050,     639050, 
+        639048,     639050,     639050,          0,          0,          0,     639050,     639050,     639050,          0,     639050,     639050,     639050,     638984,          0,          0, 
+        639044,          0,          0,          0,          0,          0,          0,     639050,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,     638992,     638992,     638992,     638992,     638992,     638992,     638992,     638992,     638992,     638992, 
+        638994,     638994,     638994,     639027,     639027,     639027,     639027,     639027,     639027,     639025,     639027,          0,          0,          0,          0,          0, 
+
+
+    // block 24
+             0,     655434,     655434,     655434,          0,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,          0,     655428,     655428, 
+        655428,          0,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428, 
+        655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,     655428,          0,     655428,     655428,     655428,     655428,     655428,     655428, 
+        655428,     655428,     655428,     655428,          0,     655428,     655428,     655428,     655428,     655428,          0,          0,          0,     655428,     655432,     655432, 
+        655432,     655434,     655434,     655434,     655434,          0,     655432,     655432,     655432,          0,     655432,     655432,     655432,     655368,          0,          0, 
+             0,          0,          0,          0,          0,     655432,     655432,          0,     655428,     655428,          0,          0,          0,          0,          0,          0, 
+        655428,     655428,     655432,     655432,          0,          0,     655376,     655376,     655376,     655376,     655376,     655376,     655376,     655376,     655376,     655376, 
+             0,          0,          0,          0,          0,          0,          0,          0,     655378,     655378,     655378,     655378,     655378,     655378,     655378,     655411, 
+
+
+    // block 25
+             0,          0,     327754,     327754,          0,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,          0,     327748,     327748, 
+        327748,          0,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748, 
+        327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,     327748,          0,     327748,     327748,     327748,     327748,     327748,     327748, 
+        327748,     327748,     327748,     327748,          0,     327748,     327748,     327748,     327748,     327748,          0,          0,     327688,     327748,     327754,     327752, 
+        327754,     327754,     327754,     327754,     327754,          0,     327752,     327754,     327754,          0,     327754,     327754,     327752,     327688,          0,          0, 
+             0,          0,          0,          0,          0,     327754,     327754,          0,          0,          0,          0,          0,          0,          0,     327748,          0, 
+        327748,     327748,     327752,     327752,          0,          0,     327696,     327696,     327696,     327696,     327696,     327696,     327696,     327696,     327696,     327696, 
+             0,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 26
+             0,          0,     417866,     417866,          0,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,          0,     417860,     417860, 
+        417860,          0,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860, 
+        417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,          0,     417860,     417860,     417860,     417860,     417860,     417860, 
+        417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,     417860,          0,          0,          0,     417860,     417866,     417866, 
+        417866,     417864,     417864,     417864,     417864,          0,     417866,     417866,     417866,          0,     417866,     417866,     417866,     417800,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,     417866,          0,          0,          0,          0,          0,          0,          0,          0, 
+        417860,     417860,     417864,     417864,          0,          0,     417808,     417808,     417808,     417808,     417808,     417808,     417808,     417808,     417808,     417808, 
+        417810,     417810,     417810,     417810,     417810,     417810,          0,          0,          0,     417843,     417860,     417860,     417860,     417860,     417860,     417860, 
+
+
+    // block 27
+             0,          0,     581706,     581706,          0,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700, 
+        581700,     581700,     581700,     581700,     581700,     581700,     581700,          0,          0,          0,     581700,     581700,     581700,     581700,     581700,     581700, 
+        581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700, 
+        581700,     581700,          0,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,     581700,          0,     581700,          0,          0, 
+        581700,     581700,     581700,     581700,     581700,     581700,     581700,          0,          0,          0,     581640,          0,          0,          0,          0,     581706, 
+        581706,     581706,     581704,     581704,     581704,          0,     581704,          0,     581706,     581706,     581706,     581706,     581706,     581706,     581706,     581706, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,     581706,     581706,     581676,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 28
+             0,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196, 
+        688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196, 
+        688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196,     688196, 
+        688196,     688200,     688196,     688196,     688200,     688200,     688200,     688200,     688200,     688200,     688200,          0,          0,          0,          0,     753713, 
+        688196,     688196,     688196,     688196,     688196,     688196,     688195,     688136,     688136,     688136,     688136,     688136,     688136,     688200,     688136,     688172, 
+        688144,     688144,     688144,     688144,     688144,     688144,     688144,     688144,     688144,     688144,     688172,     688172,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 29
+             0,     352324,     352324,          0,     352324,          0,          0,     352324,     352324,          0,     352324,          0,          0,     352324,          0,          0, 
+             0,          0,          0,          0,     352324,     352324,     352324,     352324,          0,     352324,     352324,     352324,     352324,     352324,     352324,     352324, 
+             0,     352324,     352324,     352324,          0,     352324,          0,     352324,          0,          0,     352324,     352324,          0,     352324,     352324,     352324, 
+        352324,     352328,     352324,     352324,     352328,     352328,     352328,     352328,     352328,     352328,          0,     352328,     352328,     352324,          0,          0, 
+        352324,     352324,     352324,     352324,     352324,          0,     352323,          0,     352264,     352264,     352264,     352264,     352264,     352328,          0,          0, 
+        352272,     352272,     352272,     352272,     352272,     352272,     352272,     352272,     352272,     352272,          0,          0,     352324,     352324,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 30
+        696388,     696371,     696371,     696371,     696364,     696364,     696364,     696364,     696364,     696364,     696364,     696364,     696364,     696364,     696364,     696364, 
+        696364,     696364,     696364,     696371,     696371,     696371,     696371,     696371,     696328,     696328,     696371,     696371,     696371,     696371,     696371,     696371, 
+        696336,     696336,     696336,     696336,     696336,     696336,     696336,     696336,     696336,     696336,     696338,     696338,     696338,     696338,     696338,     696338, 
+        696338,     696338,     696338,     696338,     696371,     696328,     696371,     696328,     696371,     696328,     696361,     696362,     696361,     696362,     696330,     696330, 
+        696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,          0,     696388,     696388,     696388,     696388,     696388,     696388,     696388, 
+        696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388, 
+        696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,     696388,          0,          0,          0, 
+             0,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696394, 
+
+
+    // block 31
+        696392,     696392,     696328,     696328,     696328,     696364,     696328,     696328,     696388,     696388,     696388,     696388,          0,          0,          0,          0, 
+        696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,          0,     696392,     696392,     696392,     696392,     696392,     696392,     696392, 
+        696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392, 
+        696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,     696392,          0,     696371,     696371, 
+        696371,     696371,     696371,     696371,     696371,     696371,     696328,     696371,     696371,     696371,     696371,     696371,     696371,          0,     696371,     696371, 
+        696364,     696364,     696364,     696364,     696364,     753664,     753664,     753664,     753664,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 32
+        442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436, 
+        442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436, 
+        442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442442,     442442,     442440,     442440,     442440, 
+        442440,     442442,     442440,     442440,     442440,     442440,     442440,     442376,     442442,     442376,     442376,     442442,     442442,     442440,     442440,     442436, 
+        442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442412,     442412,     442412,     442412,     442412,     442412, 
+        442436,     442436,     442436,     442436,     442436,     442436,     442442,     442442,     442440,     442440,     442436,     442436,     442436,     442436,     442440,     442440, 
+        442440,     442436,     442442,     442378,     442378,     442436,     442436,     442442,     442442,     442378,     442378,     442378,     442378,     442378,     442436,     442436, 
+        442436,     442440,     442440,     442440,     442440,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436,     442436, 
+
+
+    // block 33
+        442436,     442436,     442440,     442442,     442442,     442440,     442440,     442378,     442378,     442378,     442378,     442378,     442378,     442376,     442436,     442378, 
+        442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442384,     442368,     442368,     442432,     442432,     442419,     442419, 
+      94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256, 
+      94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256,   94552256, 
+      94552256,   94552256,   94552256,   94552256,   94552256,   94552256,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292, 
+        180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292, 
+        180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     180292,     753708,     180291,          0,          0,          0, 
+
+
+    // block 34
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229440,     229440,     229440,     229440,     229440,     233540, 
+        233540,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+
+
+    // block 35
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229440,     229440,     229440,     229440,     229440,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229440,     229440,     229440,     229440,     229440,     229440, 
+
+
+    // block 36
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,          0,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,          0,     172100,     172100,     172100,     172100,          0,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+
+
+    // block 37
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,          0,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,          0,     172100,     172100,     172100,     172100,          0,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0, 
+        172100,          0,     172100,     172100,     172100,     172100,          0,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+
+
+    // block 38
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,          0,     172100,     172100,     172100,     172100,          0,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,          0,          0,          0,     172104, 
+        172083,     172076,     172076,     172076,     172076,     172076,     172076,     172076,     172076,     172050,     172050,     172050,     172050,     172050,     172050,     172050, 
+        172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,     172050,          0,          0,          0, 
+
+
+    // block 39
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172083,     172083,     172083,     172083,     172083,     172083,     172083,     172083,     172083,     172083,          0,          0,          0,          0,          0,          0, 
+        114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756, 
+        114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756, 
+        114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756, 
+        114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756, 
+        114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756,     114756, 
+        114756,     114756,     114756,     114756,     114756,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 40
+         90112,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+
+
+    // block 41
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+
+
+    // block 42
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90180,      90156,      90156,      90180, 
+         90180,      90180,      90180,      90180,      90180,      90180,      90180,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176, 
+
+
+    // block 43
+        459288,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820, 
+        458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458820,     458793,     458794,          0,          0,          0, 
+        540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740, 
+        540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740, 
+        540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740, 
+        540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740, 
+        540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     540740,     753708,     753708,     753708,     540753,     540753, 
+        540753,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 44
+        671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,     671812,          0,     671812,     671812, 
+        671812,     671812,     671816,     671816,     671752,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828,     245828, 
+        245828,     245828,     245832,     245832,     245768,     753708,     753708,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+         81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988,      81988, 
+         81988,      81988,      81992,      81992,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,     614468,          0,     614468,     614468, 
+        614468,          0,     614472,     614472,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 45
+        319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556, 
+        319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556, 
+        319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556,     319556, 
+        319556,     319556,     319556,     319556,     323617,     323617,     319562,     319560,     319560,     319560,     319560,     319560,     319560,     319560,     319562,     319562, 
+        319562,     319562,     319562,     319562,     319562,     319562,     319560,     319562,     319562,     319496,     319496,     319496,     319496,     319496,     319496,     319496, 
+        319496,     319496,     319496,     319496,     319532,     319532,     319532,     319555,     319532,     319532,     319532,     319537,     319556,     319496,          0,          0, 
+        319504,     319504,     319504,     319504,     319504,     319504,     319504,     319504,     319504,     319504,          0,          0,          0,          0,          0,          0, 
+        319506,     319506,     319506,     319506,     319506,     319506,     319506,     319506,     319506,     319506,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 46
+        426028,     426028,     753708,     753708,     426028,     753708,     426024,     426028,     426028,     426028,     426028,     430088,     430088,     430088,     426520,          0, 
+        426000,     426000,     426000,     426000,     426000,     426000,     426000,     426000,     426000,     426000,          0,          0,          0,          0,          0,          0, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426051,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 47
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052, 
+        426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426052,     426056,     426052,          0,          0,          0,          0,          0, 
+         90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176, 
+         90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176, 
+         90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176, 
+         90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176,      90176, 
+         90176,      90176,      90176,      90176,      90176,      90176,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 48
+        376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900, 
+        376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,     376900,          0,          0,          0, 
+        376904,     376904,     376904,     376906,     376906,     376906,     376906,     376904,     376904,     376906,     376906,     376906,          0,          0,          0,          0, 
+        376906,     376906,     376904,     376906,     376906,     376906,     376906,     376906,     376906,     376840,     376840,     376840,          0,          0,          0,          0, 
+        376883,          0,          0,          0,     376876,     376876,     376848,     376848,     376848,     376848,     376848,     376848,     376848,     376848,     376848,     376848, 
+        622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660, 
+        622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,     622660,          0,          0, 
+        622660,     622660,     622660,     622660,     622660,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 49
+        630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852, 
+        630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852, 
+        630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630848,     630848,          0,          0,          0,          0, 
+        630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858,     630858, 
+        630858,     630852,     630852,     630852,     630852,     630852,     630852,     630852,     630858,     630858,          0,          0,          0,          0,          0,          0, 
+        630800,     630800,     630800,     630800,     630800,     630800,     630800,     630800,     630800,     630800,     630784,          0,          0,          0,     630828,     630828, 
+        319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539, 
+        319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539,     319539, 
+
+
+    // block 50
+         73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796,      73796, 
+         73796,      73796,      73796,      73796,      73796,      73796,      73796,      73800,      73800,      73802,      73802,      73802,          0,          0,      73772,      73772, 
+        344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128, 
+        344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128, 
+        344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128, 
+        344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,          0, 
+        344064,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128,     344128, 
+        344128,     344128,     344128,     344128,     344128,     344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,          0,          0,     344064, 
+
+
+    // block 51
+        344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,          0,          0,          0,          0,          0,          0, 
+        344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,     344064,          0,          0,          0,          0,          0,          0, 
+        344064,     344064,     344064,     344064,     344064,     344064,     344064,     344128,     344064,     344064,     344064,     344064,     344064,     344064,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 52
+         32840,      32840,      32840,      32840,      32842,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836, 
+         32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836, 
+         32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836,      32836, 
+         32836,      32836,      32836,      32836,      32776,      32842,      32840,      32840,      32840,      32840,      32840,      32842,      32840,      32842,      32842,      32842, 
+         32842,      32842,      32840,      32842,      32778,      32836,      32836,      32836,      32836,      32836,      32836,      32836,          0,          0,          0,          0, 
+         32784,      32784,      32784,      32784,      32784,      32784,      32784,      32784,      32784,      32784,      32812,      32812,      32812,      32812,      32812,      32812, 
+         32812,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32776,      32776,      32776,      32776,      32776, 
+         32776,      32776,      32776,      32776,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32819,      32819,          0,          0,          0, 
+
+
+    // block 53
+        589896,     589896,     589898,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892, 
+        589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892,     589892, 
+        589892,     589898,     589896,     589896,     589896,     589896,     589898,     589898,     589896,     589896,     589834,          0,          0,          0,     589892,     589892, 
+        589840,     589840,     589840,     589840,     589840,     589840,     589840,     589840,     589840,     589840,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 54
+        368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708, 
+        368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708,     368708, 
+        368708,     368708,     368708,     368708,     368714,     368714,     368714,     368714,     368714,     368714,     368714,     368714,     368712,     368712,     368712,     368712, 
+        368712,     368712,     368712,     368712,     368714,     368714,     368648,     368648,          0,          0,          0,     368684,     368684,     368684,     368684,     368684, 
+        368656,     368656,     368656,     368656,     368656,     368656,     368656,     368656,     368656,     368656,          0,          0,          0,     368708,     368708,     368708, 
+        466960,     466960,     466960,     466960,     466960,     466960,     466960,     466960,     466960,     466960,     467012,     467012,     467012,     467012,     467012,     467012, 
+        467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012, 
+        467012,     467012,     467012,     467012,     467012,     467012,     467012,     467012,     467011,     467011,     467011,     467011,     467011,     467011,     466988,     466988, 
+
+
+    // block 55
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        745472,     745472,     745472,     753664,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     745472, 
+        745472,     753664,     745472,     745472,     745472,     745472,     745472,     745472,     745472,     753728,     753728,     753728,     753728,     745472,     753728,     753728, 
+        753728,     753728,     753728,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 56
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769, 
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769, 
+        360769,     360769,     360769,     360769,     360769,     360769,     205121,     205121,     205121,     205121,     205121,     139585,     360771,     360771,     360771,     360771, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     205123,     205123,     205123, 
+        205123,     205123,     360769,     360769,     360769,     360769,     205121,     205121,     205121,     205121,     205121,     360769,     360769,     360769,     360769,     360769, 
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     139587,   95781185,     360769,     360769,     360769,   96829761,     360769,     360769, 
+
+
+    // block 57
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769, 
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360771,     360771,     360771,     360771,     360771, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771, 
+        360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     360771,     205123, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     745472,     745480,     745480, 
+
+
+    // block 58
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+
+
+    // block 59
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,     360769,     360769,     360769,     360769,     360769,   97878337,     360769,     360769,   98926784,     360769, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+
+
+    // block 60
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,          0,          0,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,          0,          0, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,          0,          0,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,          0,          0, 
+        205121,   99819841,     205121,   99819841,     205121,   99819841,     205121,   99819841,          0,  100868288,          0,  100868288,          0,  100868288,          0,  100868288, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288,  100868288, 
+     101916993,  101916993,  102965569,  102965569,  102965569,  102965569,  104014145,  104014145,  105062721,  105062721,  106111297,  106111297,  107159873,  107159873,          0,          0, 
+
+
+    // block 61
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162, 
+      99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,   99819841,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162,  100868162, 
+      99819841,   99819841,     205121,  108208449,     205121,          0,     205121,     205121,  100868288,  100868288,  109256896,  109256896,  110305346,     204850,  111354177,     204850, 
+        204850,     204850,     205121,  108208449,     205121,          0,     205121,     205121,  112402624,  112402624,  112402624,  112402624,  110305346,     204850,     204850,     204850, 
+      99819841,   99819841,     205121,     205121,          0,          0,     205121,     205121,  100868288,  100868288,  113451200,  113451200,          0,     204850,     204850,     204850, 
+      99819841,   99819841,     205121,     205121,     205121,   85139777,     205121,     205121,  100868288,  100868288,  114499776,  114499776,   88285376,     204850,     204850,     204850, 
+             0,          0,     205121,  108208449,     205121,          0,     205121,     205121,  115548352,  115548352,  116596928,  116596928,  110305346,     204850,     204850,          0, 
+
+
+    // block 62
+        754200,     754200,     754200,     754200,     754200,     754200,     754200,     754200,     754200,     754200,     754200,     757793,     749601,     749601,     757793,     757793, 
+        753704,     753704,     753704,     753704,     753704,     753704,     753708,     753708,     753709,     753710,     753705,     753709,     753709,     753710,     753705,     753709, 
+        753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     754201,     754202,     757793,     757793,     757793,     757793,     757793,     754200, 
+        753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753709,     753710,     753708,     753708,     753708,     753708,     753707, 
+        753707,     753708,     753708,     753708,     753712,     753705,     753706,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708, 
+        753708,     753708,     753712,     753708,     753707,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     753708,     754200, 
+        757793,     757793,     757793,     757793,     757793,       4096,       4096,       4096,       4096,       4096,     757793,     757793,     757793,     757793,     757793,     757793, 
+        753682,     360513,          0,          0,     753682,     753682,     753682,     753682,     753682,     753682,     753712,     753712,     753712,     753705,     753706,     360513, 
+
+
+    // block 63
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753712,     753712,     753712,     753705,     753706,          0, 
+        360771,     360771,     360771,     360771,     360771,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713,     753713, 
+        753713,     753713,     753713,     753713,     753713,     753713,     753664,     753664,     753664,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745481,     745481,     745481, 
+        745481,     745480,     745481,     745481,     745481,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     745480, 
+        745480,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 64
+        753715,     753715,     753856,     753715,     753715,     753715,     753715,     753856,     753715,     753715,     753985,     753856,     753856,     753856,     753985,     753985, 
+        753856,     753856,     753856,     753985,     753715,     753856,     753715,     753715,     753715,     753856,     753856,     753856,     753856,     753856,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753856,     753715,  117645504,     753715,     753856,     753715,  118849728,  119898304,     753856,     753856,     753715,     753985, 
+        753856,     753856,  120946880,     753856,     753985,     753732,     753732,     753732,     753732,     753985,     753715,     753715,     753985,     753985,     753856,     753856, 
+        753712,     753712,     753712,     753712,     753712,     753856,     753985,     753985,     753985,     753985,     753715,     753712,     753715,     753715,  121995585,     753715, 
+        753664,     753664,     753664,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+     123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049,  123044049, 
+     124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753,  124092753, 
+
+
+    // block 65
+        360529,     360529,     360529,    5603520,    6652225,     360529,     360529,     360529,     360529,     753664,          0,          0,          0,          0,          0,          0, 
+        753712,     753712,     753712,     753712,     753712,     753715,     753715,     753715,     753715,     753715,     753712,     753712,     753715,     753715,     753715,     753715, 
+        753712,     753715,     753715,     753712,     753715,     753715,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753712, 
+        753715,     753715,     753712,     753715,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+
+
+    // block 66
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+
+
+    // block 67
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753712,     753712,     753712,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753712,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753705,     753706,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753715,     753715,     753715, 
+
+
+    // block 68
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753664,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 69
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+
+
+    // block 70
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451, 
+     125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451,  125534451, 
+     126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155, 
+     126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,  126583155,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+
+
+    // block 71
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+
+
+    // block 72
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753712,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+
+
+    // block 73
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753712, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+
+
+    // block 74
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753664,     753664, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753664,     753664,     753664, 
+        753715,     753715,     753715,     753715,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,          0,     753664, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753664,     753664,          0,     753664,          0,          0,          0,          0,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+
+
+    // block 75
+             0,     753715,     753715,     753715,     753715,          0,     753715,     753715,     753715,     753715,          0,          0,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,     753715,          0,     753715, 
+        753715,     753715,     753715,          0,          0,          0,     753715,     753664,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0, 
+             0,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706, 
+        753705,     753706,     753705,     753706,     753705,     753706,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+
+
+    // block 76
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753715,          0,          0,          0,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+             0,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0, 
+        753712,     753712,     753712,     753712,     753712,     753705,     753706,     753712,     753712,     753712,     753712,          0,     753712,          0,          0,          0, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+
+
+    // block 77
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+         65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587,      65587, 
+
+
+    // block 78
+        753712,     753712,     753712,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705, 
+        753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753705,     753706,     753705,     753706,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753705,     753706,     753712,     753712, 
+
+
+    // block 79
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712,     753712, 
+        753712,     753712,     753712,     753712,     753712,     753715,     753715,     753712,     753712,     753712,     753712,     753712,     753712,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753664,     753664,     753664,     753664,     753664,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 80
+      92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296, 
+      92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296, 
+      92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,   92463296,          0, 
+      93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001, 
+      93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001, 
+      93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,   93512001,          0, 
+       5603520,    6652225,  127238336,  128286912,  129335488,  130384193,  131432769,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,  132481216,  133529792,  134578368, 
+        360640,     360769,    5603520,    6652225,     360769,    5603520,    6652225,     360769,     360769,     360769,     360769,     360769,     360769,     360771,     360640,     360640, 
+
+
+    // block 81
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657,    5365952,    6414657, 
+       5365952,    6414657,    5365952,    6414657,     123201,     122931,     122931,     122931,     122931,     122931,     122931,     123072,     123200,     123072,     123200,     122880, 
+        122880,     122880,          0,          0,          0,          0,          0,          0,          0,     122924,     122924,     122924,     122924,     122898,     122924,     122924, 
+
+
+    // block 82
+     135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849, 
+     135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849,  135446849, 
+     135446849,  135446849,  135446849,  135446849,  135446849,  135446849,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620, 
+        663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620, 
+        663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620,     663620, 
+        663620,     663620,     663620,     663620,     663620,     663620,          0,          0,          0,          0,          0,          0,          0,          0,          0,     663619, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 83
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100,     172100, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0, 
+        172100,     172100,     172100,     172100,     172100,     172100,     172100,          0,     172100,     172100,     172100,     172100,     172100,     172100,     172100,          0, 
+        139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336, 
+        139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336,     139336, 
+
+
+    // block 84
+        753708,     753708,     753709,     753710,     753709,     753710,     753708,     753708,     753708,     753709,     753710,     753708,     753709,     753710,     753708,     753708, 
+        753708,     753708,     753708,     753708,     753708,     753708,     753708,     753704,     753708,     753708,     753704,     753708,     753709,     753710,     753708,     753708, 
+        753709,     753710,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753708,     753708,     753708,     753708,     753708,     753731, 
+        753708,     753664,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 85
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,          0,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 86
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+
+
+    // block 87
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619,     237619, 
+        237619,     237619,     237619,     237619,     237619,     237619,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0, 
+
+
+    // block 88
+        754200,     753708,     753708,     753708,     753715,     237635,     753732,     237649,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706, 
+        753705,     753706,     753715,     753715,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753704,     753705,     753706,     753706, 
+        753715,     237649,     237649,     237649,     237649,     237649,     237649,     237649,     237649,     237649,     745480,     745480,     745480,     745480,     745480,     745480, 
+        753704,     753731,     753731,     753731,     753731,     753731,     753715,     753715,     237649,     237649,     237649,     237635,     753732,     753708,     753715,     753715, 
+             0,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212, 
+        262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212, 
+        262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212, 
+        262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212, 
+
+
+    // block 89
+        262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212,     262212, 
+        262212,     262212,     262212,     262212,     262212,     262212,     262212,          0,          0,     745480,     745480,     753714,     753714,     262211,     262211,     262212, 
+        753704,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     753708,     753731,     303171,     303171,     303172, 
+
+
+    // block 90
+             0,          0,          0,          0,          0,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412, 
+         57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412, 
+         57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,          0,          0, 
+             0,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     233540,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+
+
+    // block 91
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,          0, 
+        753715,     753715,     753682,     753682,     753682,     753682,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+         57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412, 
+         57412,      57412,      57412,      57412,      57412,      57412,      57412,      57412,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+
+
+    // block 92
+        229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427, 
+        229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,          0, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753715,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427, 
+        229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     229427,     753715, 
+
+
+    // block 93
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,          0, 
+
+
+    // block 94
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155, 
+        303155,     303155,     303155,     303155,     303155,     303155,     303155,     303155,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+
+
+    // block 95
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+
+
+    // block 96
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+
+
+    // block 97
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 98
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737347,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+
+
+    // block 99
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348, 
+
+
+    // block 100
+        737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,     737348,          0,          0,          0, 
+        737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331, 
+        737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331, 
+        737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331,     737331, 
+        737331,     737331,     737331,     737331,     737331,     737331,     737331,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280, 
+        393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280, 
+        393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393280,     393216,     393216, 
+
+
+    // block 101
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+
+
+    // block 102
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712771,     712748,     712748,     712748, 
+        712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772,     712772, 
+        712720,     712720,     712720,     712720,     712720,     712720,     712720,     712720,     712720,     712720,     712772,     712772,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+             0,          0,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,     139332,     139272, 
+        139273,     139273,     139273,     139308,          0,          0,          0,          0,          0,          0,          0,          0,     139272,     139272,     139308,     139331, 
+
+
+    // block 103
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041, 
+       5382336,    6431041,    5382336,    6431041,    5382336,    6431041,    5382336,    6431041,          0,          0,          0,          0,          0,          0,          0,          0, 
+         41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024, 
+         41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024, 
+         41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024, 
+         41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024, 
+         41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024,      41024, 
+         40960,      40960,      40960,      40960,      40960,      40960,      40960,      40960,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 104
+        753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714,     753714, 
+        753714,     753714,     753714,     753714,     753714,     753714,     753714,     753731,     753731,     753731,     753731,     753731,     753731,     753731,     753731,     753731, 
+        753714,     753714,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+        360769,     360769,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225, 
+        360771,     360769,     360769,     360769,     360769,     360769,     360769,     360769,     360769,    5603520,    6652225,    5603520,    6652225,  136675520,    5603520,    6652225, 
+
+
+    // block 105
+       5603520,    6652225,    5603520,    6652225,    5603520,    6652225,    5603520,    6652225,     753731,     753714,     753714,    5603520,    6652225,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     360516,     360516,     360516,     360516,     360516, 
+
+
+    // block 106
+        598084,     598084,     598024,     598084,     598084,     598084,     598024,     598084,     598084,     598084,     598084,     598024,     598084,     598084,     598084,     598084, 
+        598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084,     598084, 
+        598084,     598084,     598084,     598090,     598090,     598088,     598088,     598090,     598067,     598067,     598067,     598067,          0,          0,          0,          0, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,          0,          0,          0,          0,          0,          0, 
+        499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780, 
+        499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780, 
+        499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780,     499780, 
+        499780,     499780,     499780,     499780,     499756,     499756,     499756,     499756,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 107
+        565322,     565322,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316, 
+        565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316, 
+        565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316,     565316, 
+        565316,     565316,     565316,     565316,     565322,     565322,     565322,     565322,     565322,     565322,     565322,     565322,     565322,     565322,     565322,     565322, 
+        565322,     565322,     565322,     565322,     565256,          0,          0,          0,          0,          0,          0,          0,          0,          0,     565292,     565292, 
+        565264,     565264,     565264,     565264,     565264,     565264,     565264,     565264,     565264,     565264,          0,          0,          0,          0,          0,          0, 
+        147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456,     147456, 
+        147456,     147456,     147520,     147520,     147520,     147520,     147520,     147520,     147456,     147456,     147456,     147520,          0,          0,          0,          0, 
+
+
+    // block 108
+        294928,     294928,     294928,     294928,     294928,     294928,     294928,     294928,     294928,     294928,     294980,     294980,     294980,     294980,     294980,     294980, 
+        294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980,     294980, 
+        294980,     294980,     294980,     294980,     294980,     294980,     294984,     294984,     294984,     294984,     294984,     294920,     294920,     294920,     294956,     294956, 
+        532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548,     532548, 
+        532548,     532548,     532548,     532548,     532548,     532548,     532548,     532552,     532552,     532552,     532552,     532552,     532552,     532552,     532552,     532552, 
+        532552,     532552,     532554,     532490,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     532524, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,          0,          0,          0, 
+
+
+    // block 109
+        286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784, 
+        286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784, 
+        286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784, 
+        286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784,     286784, 
+        286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,          0,     286784, 
+        286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,     286720,          0,          0,          0,          0,     286720,     286720, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 110
+        106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564, 
+        106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564, 
+        106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106568,     106568,     106568,     106568,     106568,     106568,     106570, 
+        106570,     106568,     106568,     106570,     106570,     106568,     106568,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        106564,     106564,     106564,     106568,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106564,     106568,     106570,          0,          0, 
+        106512,     106512,     106512,     106512,     106512,     106512,     106512,     106512,     106512,     106512,          0,          0,     106540,     106540,     106540,     106540, 
+        442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432,     442432, 
+        442432,     442432,     442432,     442432,     442432,     442432,     442432,     442368,     442368,     442368,     442432,     442368,          0,          0,          0,          0, 
+
+
+    // block 111
+        647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232, 
+        647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232, 
+        647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232, 
+        647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647232,     647168, 
+        647232,     647168,     647232,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     647232,     647232,     647232,     647168,     647168, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 112
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240, 
+        434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240, 
+        434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434240,     434176,     434176,     434176,          0,          0, 
+        434176,     434176,     434176,     434176,     434176,     434176,     434176,     434176,     434176,     434176,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 113
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+
+
+    // block 114
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,          0,          0,          0,          0,     229440,     229440,     229440,     229440,     229440, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440, 
+        229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,     229440,          0,          0,          0,          0, 
+
+
+    // block 115
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+            35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35,         35, 
+
+
+    // block 116
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+
+
+    // block 117
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,          0,          0, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237632,     237632,     237632,          0,          0, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+
+
+    // block 118
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 119
+        360769,     360769,     360769,     360769,     360769,     360769,     360769,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,      16705,      16705,      16705,      16705,      16705,          0,          0,          0,          0,          0,     254020,     254024,     254020, 
+        254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254000,     254020,     254020,     254020,     254020,     254020,     254020, 
+        254020,     254020,     254020,     254020,     254020,     254020,     254020,          0,     254020,     254020,     254020,     254020,     254020,          0,     254020,          0, 
+        254020,     254020,          0,     254020,     254020,          0,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020,     254020, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 120
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 121
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 122
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,     753705,     753706, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 123
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+             0,          0,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,          0,          0,          0,          0,          0,          0,          0,          0, 
+          2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048, 
+          2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048,       2048, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         49,     753715,          0,          0, 
+
+
+    // block 124
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        753708,     753708,     753708,     753708,     753708,     753708,     753708,     753705,     753706,     753708,          0,          0,          0,          0,          0,          0, 
+        745480,     745480,     745480,     745480,     745480,     745480,     745480,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753708,     753704,     753704,     753707,     753707,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705,     753706,     753705, 
+        753706,     753705,     753706,     753705,     753706,     753708,     753708,     753705,     753706,     753708,     753708,     753708,     753708,     753707,     753707,     753707, 
+        753708,     753708,     753708,          0,     753708,     753708,     753708,     753708,     753704,     753705,     753706,     753705,     753706,     753705,     753706,     753708, 
+        753708,     753708,     753712,     753704,     753712,     753712,     753712,          0,     753708,     753713,     753708,     753708,          0,          0,          0,          0, 
+            68,         68,         68,         68,         68,          0,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+
+
+    // block 125
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68, 
+            68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,         68,          0,          0,     757793, 
+
+
+    // block 126
+             0,     753708,     753708,     753708,     753713,     753708,     753708,     753708,     753705,     753706,     753708,     753712,     753708,     753704,     753708,     753708, 
+        754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     754704,     753708,     753708,     753712,     753712,     753712,     753708, 
+        753708,    1410240,    1410240,    1410240,    1410240,    1410240,    1410240,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216, 
+       1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,    1409216,     753705,     753708,     753706,     753714,     753707, 
+        753714,    2458945,    2458945,    2458945,    2458945,    2458945,    2458945,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921, 
+       2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,    2457921,     753705,     753712,     753706,     753712,     753705, 
+        753706,     753708,     753705,     753706,     753708,     753708,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        753731,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+
+
+    // block 127
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172, 
+        303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     303172,     753731,     753731, 
+        233540,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444, 
+        229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,     229444,          0, 
+             0,          0,     229444,     229444,     229444,     229444,     229444,     229444,          0,          0,     229444,     229444,     229444,     229444,     229444,     229444, 
+             0,          0,     229444,     229444,     229444,     229444,     229444,     229444,          0,          0,     229444,     229444,     229444,          0,          0,          0, 
+        753713,     753713,     753712,     753714,     753715,     753713,     753713,          0,     753715,     753712,     753712,     753712,     753712,     753715,     753715,          0, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,     753697,     753697,     753697,     753715,     753715,       2048,       2048, 
+
+
+    // block 128
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,     385092,     385092,          0,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,          0, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 129
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092, 
+        385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,     385092,          0,          0,          0,          0,          0, 
+
+
+    // block 130
+        753708,     753708,     753715,          0,          0,          0,          0,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,     753682,     753682,          0,          0,          0,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881, 
+        204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881, 
+        204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881,     204881, 
+        204881,     204881,     204881,     204881,     204881,     204818,     204818,     204818,     204818,     204851,     204851,     204851,     204851,     204851,     204851,     204851, 
+
+
+    // block 131
+        204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204818,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     745480,          0,          0, 
+
+
+    // block 132
+        401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476, 
+        401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,     401476,          0,          0,          0, 
+         98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372, 
+         98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372, 
+         98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372,      98372, 
+         98372,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 133
+        278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596, 
+        278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,     278596,          0, 
+        278546,     278546,     278546,     278546,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676, 
+        196676,     196689,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196676,     196689,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 134
+        704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580, 
+        704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,     704580,          0,     704556, 
+        720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964, 
+        720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964, 
+        720964,     720964,     720964,     720964,          0,          0,          0,          0,     720964,     720964,     720964,     720964,     720964,     720964,     720964,     720964, 
+        720940,     720977,     720977,     720977,     720977,     720977,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 135
+     137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296, 
+     137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296, 
+     137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  137519296,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001, 
+     138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001, 
+     138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001,  138568001, 
+        573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508, 
+        573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508, 
+        573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508,     573508, 
+
+
+    // block 136
+        491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588, 
+        491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,     491588,          0,          0, 
+        491536,     491536,     491536,     491536,     491536,     491536,     491536,     491536,     491536,     491536,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 137
+        131140,     131140,     131140,     131140,     131140,     131140,          0,          0,     131140,          0,     131140,     131140,     131140,     131140,     131140,     131140, 
+        131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140, 
+        131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140,     131140, 
+        131140,     131140,     131140,     131140,     131140,     131140,          0,     131140,     131140,          0,          0,          0,     131140,          0,          0,     131140, 
+          8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256,       8256, 
+          8256,       8256,       8256,       8256,       8256,       8256,          0,       8192,       8192,       8192,       8192,       8192,       8192,       8192,       8192,       8192, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 138
+        516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164,     516164, 
+        516164,     516164,     516164,     516164,     516164,     516164,     516114,     516114,     516114,     516114,     516096,     516096,          0,          0,          0,     516140, 
+        409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668, 
+        409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,     409668,          0,          0,          0,          0,          0,     409644, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 139
+        311364,     311368,     311368,     311368,          0,     311368,     311368,          0,          0,          0,          0,          0,     311368,     311368,     311368,     311368, 
+        311364,     311364,     311364,     311364,          0,     311364,     311364,     311364,          0,     311364,     311364,     311364,     311364,     311364,     311364,     311364, 
+        311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364,     311364, 
+        311364,     311364,     311364,     311364,          0,          0,          0,          0,     311304,     311304,     311304,          0,          0,          0,          0,     311304, 
+        311314,     311314,     311314,     311314,     311314,     311314,     311314,     311314,          0,          0,          0,          0,          0,          0,          0,          0, 
+        311340,     311340,     311340,     311340,     311340,     311340,     311340,     311340,     311340,          0,          0,          0,          0,          0,          0,          0, 
+        557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120, 
+        557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557120,     557056,     557056,     557056, 
+
+
+    // block 140
+         24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640, 
+         24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640, 
+         24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640,      24640, 
+         24640,      24640,      24640,      24640,      24640,      24640,          0,          0,          0,      24576,      24576,      24576,      24576,      24576,      24576,      24576, 
+        524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352,     524352, 
+        524352,     524352,     524352,     524352,     524352,     524352,          0,          0,     524288,     524288,     524288,     524288,     524288,     524288,     524288,     524288, 
+        507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968,     507968, 
+        507968,     507968,     507968,          0,          0,          0,          0,          0,     507904,     507904,     507904,     507904,     507904,     507904,     507904,     507904, 
+
+
+    // block 141
+        475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200, 
+        475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200, 
+        475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200, 
+        475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200, 
+        475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,     475200,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 142
+        335872,     335872,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936, 
+        335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936, 
+        335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936, 
+        335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335936,     335872,     335872,     335872,     335872,     335872,     335872,     335872, 
+        335872,     335872,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 143
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+
+
+    // block 144
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156, 
+        729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,     729156,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 145
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169,     729169, 
+        729169,     729169,     729169,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        729132,     729132,     729132,     729132,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 146
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+
+
+    // block 147
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904, 
+        163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,     163904,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 148
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 149
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753674,     753674,     745480,     745480,     745480,     753715,     753715,     753715,     753674,     753674,     753674, 
+        753674,     753674,     753674,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     745480,     745480,     745480,     745480,     745480, 
+
+
+    // block 150
+        745480,     745480,     745480,     753715,     753715,     745480,     745480,     745480,     745480,     745480,     745480,     745480,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     745480,     745480,     745480,     745480,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 151
+        204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851, 
+        204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851, 
+        204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851, 
+        204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851,     204851, 
+        204851,     204851,     204808,     204808,     204808,     204851,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 152
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682,     753682, 
+        753682,     753682,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 153
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,          0,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+
+
+    // block 154
+        753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,          0,     753856,     753856, 
+             0,          0,     753856,          0,          0,     753856,     753856,          0,          0,     753856,     753856,     753856,     753856,          0,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,          0,     753985,          0,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,          0,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+
+
+    // block 155
+        753985,     753985,     753985,     753985,     753856,     753856,          0,     753856,     753856,     753856,     753856,          0,          0,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,          0,     753856,     753856,     753856,     753856,     753856,     753856,     753856,          0,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,          0,     753856,     753856,     753856,     753856,          0, 
+        753856,     753856,     753856,     753856,     753856,          0,     753856,          0,          0,          0,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,          0,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+
+
+    // block 156
+        753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+
+
+    // block 157
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+
+
+    // block 158
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,          0,          0,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753712,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753712,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753712,     753985,     753985,     753985,     753985, 
+
+
+    // block 159
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753712,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753712,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753712, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753712, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+
+
+    // block 160
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753712,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856, 
+        753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753856,     753712,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985,     753985, 
+        753985,     753985,     753985,     753712,     753985,     753985,     753985,     753985,     753985,     753985,     753856,     753985,          0,          0,     753680,     753680, 
+        753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680, 
+        753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680, 
+        753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680,     753680, 
+
+
+    // block 161
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,          0,          0,          0,          0, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+
+
+    // block 162
+        753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715,     753715, 
+        753715,     753715,     753715,     753715,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 163
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,          0,          0,          0,          0,          0, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,          0, 
+             0,     753664,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     753664,          0,     753664, 
+             0,          0,     753664,          0,          0,          0,     753664,          0,          0,          0,     753664,     753664,     753664,     753664,     753664,          0, 
+             0,          0,          0,          0,          0,          0,          0,     753664,          0,          0,          0,          0,          0,          0,          0,     753664, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,     753664,          0,     753664,     753664,          0,          0,     753664, 
+
+
+    // block 164
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,     753664,     753664,     753664,     753664,          0,          0, 
+        753664,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 165
+        262144,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664, 
+        753664,     753664,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+        753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,     753664,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 166
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,       2048,       2048, 
+
+
+    // block 167
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 168
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+
+
+    // block 169
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632,     237632, 
+        237632,     237632,     237632,     237632,     237632,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 170
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636, 
+        237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,     237636,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+             0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0,          0, 
+
+
+    // block 171
+          4096,     757793,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+        757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793,     757793, 
+
+
+    // block 172
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+
+
+    // block 173
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+
+
+    // block 174
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+        749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576,     749576, 
+          4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096,       4096, 
+
+
+    // block 175
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34, 
+            34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,         34,       2048,       2048
+    };
+
+    inline ::boost::uint32_t properties_lookup(::boost::uint32_t ch)
+    {
+        ::boost::uint32_t block_offset = properties_stage1[ch / 128] * 128;
+        return properties_stage2[block_offset + ch % 128];
+    }
+
+    static const ::boost::int32_t case_deltas[][2] = {
+
+    {      0,       0 },
+    {     32,       0 },
+    {      0,     -32 },
+    {      0,     743 },
+    {      0,     121 },
+    {      1,       0 },
+    {      0,      -1 },
+    {   -199,       0 },
+    {      0,    -232 },
+    {   -121,       0 },
+    {      0,    -300 },
+    {      0,     195 },
+    {    210,       0 },
+    {    206,       0 },
+    {    205,       0 },
+    {     79,       0 },
+    {    202,       0 },
+    {    203,       0 },
+    {    207,       0 },
+    {      0,      97 },
+    {    211,       0 },
+    {    209,       0 },
+    {      0,     163 },
+    {    213,       0 },
+    {      0,     130 },
+    {    214,       0 },
+    {    218,       0 },
+    {    217,       0 },
+    {    219,       0 },
+    {      0,      56 },
+    {      2,       0 },
+    {      1,      -1 },
+    {      0,      -2 },
+    {      0,     -79 },
+    {    -97,       0 },
+    {    -56,       0 },
+    {   -130,       0 },
+    {  10795,       0 },
+    {   -163,       0 },
+    {  10792,       0 },
+    {   -195,       0 },
+    {     69,       0 },
+    {     71,       0 },
+    {      0,   10783 },
+    {      0,   10780 },
+    {      0,    -210 },
+    {      0,    -206 },
+    {      0,    -205 },
+    {      0,    -202 },
+    {      0,    -203 },
+    {      0,    -207 },
+    {      0,    -209 },
+    {      0,    -211 },
+    {      0,   10743 },
+    {      0,   10749 },
+    {      0,    -213 },
+    {      0,    -214 },
+    {      0,   10727 },
+    {      0,    -218 },
+    {      0,     -69 },
+    {      0,    -217 },
+    {      0,     -71 },
+    {      0,    -219 },
+    {      0,      84 },
+    {     38,       0 },
+    {     37,       0 },
+    {     64,       0 },
+    {     63,       0 },
+    {      0,     -38 },
+    {      0,     -37 },
+    {      0,     -31 },
+    {      0,     -64 },
+    {      0,     -63 },
+    {      8,       0 },
+    {      0,     -62 },
+    {      0,     -57 },
+    {      0,     -47 },
+    {      0,     -54 },
+    {      0,      -8 },
+    {      0,     -86 },
+    {      0,     -80 },
+    {      0,       7 },
+    {    -60,       0 },
+    {      0,     -96 },
+    {     -7,       0 },
+    {     80,       0 },
+    {     15,       0 },
+    {      0,     -15 },
+    {     48,       0 },
+    {      0,     -48 },
+    {   7264,       0 },
+    {      0,   35332 },
+    {      0,    3814 },
+    {      0,     -59 },
+    {  -7615,       0 },
+    {      0,       8 },
+    {     -8,       0 },
+    {      0,      74 },
+    {      0,      86 },
+    {      0,     100 },
+    {      0,     128 },
+    {      0,     112 },
+    {      0,     126 },
+    {      0,       9 },
+    {    -74,       0 },
+    {     -9,       0 },
+    {      0,   -7205 },
+    {    -86,       0 },
+    {   -100,       0 },
+    {   -112,       0 },
+    {   -128,       0 },
+    {   -126,       0 },
+    {  -7517,       0 },
+    {  -8383,       0 },
+    {  -8262,       0 },
+    {     28,       0 },
+    {      0,     -28 },
+    {     16,       0 },
+    {      0,     -16 },
+    {     26,       0 },
+    {      0,     -26 },
+    { -10743,       0 },
+    {  -3814,       0 },
+    { -10727,       0 },
+    {      0,  -10795 },
+    {      0,  -10792 },
+    { -10780,       0 },
+    { -10749,       0 },
+    { -10783,       0 },
+    {      0,   -7264 },
+    { -35332,       0 },
+    {     40,       0 },
+    {      0,     -40 }
+    };
+
+}}}} // namespace boost::spirit::unicode::detail
@@ -12,16 +12,38 @@
 
 #include <boost/cstdint.hpp>
 
-# include "category_table.hpp"
-# include "script_table.hpp"
-# include "lowercase_table.hpp"
-# include "uppercase_table.hpp"
+# include "properties_table.hpp"
 
 namespace boost { namespace spirit { namespace ucd
 {
     // This header provides Basic (Level 1) Unicode Support
     // See http://unicode.org/reports/tr18/ for details
 
+    namespace detail
+    {
+        // All properties of a code point are packed into a single entry
+        // of the properties table (see create_tables.cpp):
+        //
+        //  bits  0..12:    category and derived_properties
+        //  bits 13..19:    script
+        //  bits 20..31:    index into the case_deltas table
+
+        inline ::boost::uint32_t category_lookup(::boost::uint32_t ch)
+        {
+            return properties_lookup(ch) & 0x1FFF;
+        }
+
+        inline ::boost::uint32_t script_lookup(::boost::uint32_t ch)
+        {
+            return (properties_lookup(ch) >> 13) & 0x7F;
+        }
+
+        inline ::boost::int32_t const* case_lookup(::boost::uint32_t ch)
+        {
+            return case_deltas[properties_lookup(ch) >> 20];
+        }
+    }
+
     struct properties
     {
         // bit pattern: xxMMMCCC
@@ -289,16 +311,14 @@ namespace boost { namespace spirit { namespace ucd
 
     inline ::boost::uint32_t to_lowercase(::boost::uint32_t ch)
     {
-        // The table returns 0 to signal that this code maps to itself
-        ::boost::uint32_t r = detail::lowercase_lookup(ch);
-        return (r == 0)? ch : r;
+        // The table stores the distance to the mapped code point
+        return ch + detail::case_lookup(ch)[0];
     }
 
     inline ::boost::uint32_t to_uppercase(::boost::uint32_t ch)
     {
-        // The table returns 0 to signal that this code maps to itself
-        ::boost::uint32_t r = detail::uppercase_lookup(ch);
-        return (r == 0)? ch : r;
+        // The table stores the distance to the mapped code point
+        return ch + detail::case_lookup(ch)[1];
     }
 }}}
 
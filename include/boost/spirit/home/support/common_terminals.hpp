@@ -80,6 +80,7 @@ namespace boost { namespace spirit
         ( false_, false_type )
         ( matches, matches_type )
         ( hold, hold_type )
+        ( hold_append, hold_append_type )
         ( strict, strict_type )
         ( relaxed, relaxed_type )
         ( duplicate, duplicate_type )
@@ -0,0 +1,133 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_BINARY_COPY_OCTOBER_19_2026_1103AM)
+#define BOOST_SPIRIT_BINARY_COPY_OCTOBER_19_2026_1103AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/endian.hpp>
+#include <boost/predef/other/endian.h>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+
+namespace boost { namespace spirit { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Bulk conversion of arrays of binary values (used by the binary array
+    //  fast paths of the Qi and X3 binary parsers).
+    //
+    //  copy_binary_array<endian, bits>(src, n, dst) copies n values of
+    //  bits/8 bytes from src to dst, converting each value from the given
+    //  byte order to the native one. The copy is a single memcpy followed,
+    //  where required, by an in place byte swap loop which is written so
+    //  that compilers can vectorize it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <int bits>
+    struct byte_swap;
+
+    template <>
+    struct byte_swap<8>
+    {
+        typedef uint8_t type;
+        static type call(type v) { return v; }
+    };
+
+    template <>
+    struct byte_swap<16>
+    {
+        typedef uint16_t type;
+        static type call(type v)
+        {
+            return static_cast<type>((v >> 8) | (v << 8));
+        }
+    };
+
+    template <>
+    struct byte_swap<32>
+    {
+        typedef uint32_t type;
+        static type call(type v)
+        {
+            return (v >> 24) | ((v >> 8) & 0x0000ff00u)
+                | ((v << 8) & 0x00ff0000u) | (v << 24);
+        }
+    };
+
+#ifdef BOOST_HAS_LONG_LONG
+    template <>
+    struct byte_swap<64>
+    {
+        typedef uint64_t type;
+        static type call(type v)
+        {
+            return (type(byte_swap<32>::call(uint32_t(v))) << 32)
+                | byte_swap<32>::call(uint32_t(v >> 32));
+        }
+    };
+#endif
+
+    template <BOOST_SCOPED_ENUM(boost::endian::endianness) endian>
+    struct is_native_byte_order
+    {
+        static bool const value = true;
+    };
+
+    template <>
+    struct is_native_byte_order<boost::endian::endianness::big>
+    {
+#if BOOST_ENDIAN_BIG_BYTE
+        static bool const value = true;
+#else
+        static bool const value = false;
+#endif
+    };
+
+    template <>
+    struct is_native_byte_order<boost::endian::endianness::little>
+    {
+#if BOOST_ENDIAN_LITTLE_BYTE
+        static bool const value = true;
+#else
+        static bool const value = false;
+#endif
+    };
+
+    template <int bits>
+    inline void swap_binary_array(unsigned char* p, std::size_t n)
+    {
+        typedef typename byte_swap<bits>::type type;
+        std::size_t const size = bits / 8;
+
+        // memcpy keeps this free of alignment and aliasing issues, the
+        // compiler turns it into plain loads and stores
+        for (std::size_t i = 0; i != n; ++i, p += size)
+        {
+            type v;
+            std::memcpy(&v, p, size);
+            v = byte_swap<bits>::call(v);
+            std::memcpy(p, &v, size);
+        }
+    }
+
+    template <BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits>
+    inline void copy_binary_array(
+        unsigned char const* src, std::size_t n, void* dst)
+    {
+        if (n == 0)
+            return;
+
+        std::memcpy(dst, src, n * (bits / 8));
+        if (!is_native_byte_order<endian>::value)
+            swap_binary_array<bits>(static_cast<unsigned char*>(dst), n);
+    }
+}}}
+
+#endif
@@ -33,17 +33,50 @@ public:
     static void build (const rules &rules_,
         basic_state_machine<CharT> &state_machine_)
     {
-        std::size_t index_ = 0;
-        std::size_t size_ = rules_.statemap ().size ();
-        node_ptr_vector node_ptr_vector_;
-        detail::internals &internals_ = const_cast<detail::internals &>
-            (state_machine_.data ());
+        const std::size_t size_ = rules_.statemap ().size ();
         bool seen_BOL_assertion_ = false;
         bool seen_EOL_assertion_ = false;
 
+        init (rules_, state_machine_);
+
+        for (std::size_t index_ = 0; index_ < size_; ++index_)
+        {
+            bool BOL_ = false;
+            bool EOL_ = false;
+
+            build_state (rules_, state_machine_, index_, BOL_, EOL_);
+            seen_BOL_assertion_ = seen_BOL_assertion_ || BOL_;
+            seen_EOL_assertion_ = seen_EOL_assertion_ || EOL_;
+        }
+
+        set_assertions (state_machine_, seen_BOL_assertion_,
+            seen_EOL_assertion_);
+    }
+
+    static void minimise (basic_state_machine<CharT> &state_machine_)
+    {
+        const std::size_t machines_ = state_machine_.data ()._dfa->size ();
+
+        for (std::size_t i_ = 0; i_ < machines_; ++i_)
+        {
+            minimise_state (state_machine_, i_);
+        }
+    }
+
+    // The steps of build () and minimise (). Once init () has been called
+    // build_state () and minimise_state () touch only the tables of the
+    // given lexer state, so that the states may be processed in any order
+    // (or concurrently) with the same result.
+    static void init (const rules &rules_,
+        basic_state_machine<CharT> &state_machine_)
+    {
+        const std::size_t size_ = rules_.statemap ().size ();
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (state_machine_.data ());
+
         state_machine_.clear ();
 
-        for (; index_ < size_; ++index_)
+        for (std::size_t index_ = 0; index_ < size_; ++index_)
         {
             internals_._lookup->push_back (static_cast<size_t_vector *>(0));
             internals_._lookup->back () = new size_t_vector;
@@ -51,65 +84,61 @@ public:
             internals_._dfa->push_back (static_cast<size_t_vector *>(0));
             internals_._dfa->back () = new size_t_vector;
         }
+    }
 
-        for (index_ = 0, size_ = internals_._lookup->size ();
-            index_ < size_; ++index_)
-        {
-            internals_._lookup[index_]->resize (sizeof (CharT) == 1 ?
-                num_chars : num_wchar_ts, dead_state_index);
-
-            if (!rules_.regexes ()[index_].empty ())
-            {
-                // vector mapping token indexes to partitioned token index sets
-                index_set_vector set_mapping_;
-                // syntax tree
-                detail::node *root_ = build_tree (rules_, index_,
-                    node_ptr_vector_, internals_, set_mapping_);
+    static void build_state (const rules &rules_,
+        basic_state_machine<CharT> &state_machine_, const std::size_t state_,
+        bool &seen_BOL_assertion_, bool &seen_EOL_assertion_)
+    {
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (state_machine_.data ());
 
-                build_dfa (root_, set_mapping_,
-                    internals_._dfa_alphabet[index_],
-                    *internals_._dfa[index_]);
+        internals_._lookup[state_]->resize (sizeof (CharT) == 1 ?
+            num_chars : num_wchar_ts, dead_state_index);
 
-                if (internals_._seen_BOL_assertion)
-                {
-                    seen_BOL_assertion_ = true;
-                }
-
-                if (internals_._seen_EOL_assertion)
-                {
-                    seen_EOL_assertion_ = true;
-                }
+        if (!rules_.regexes ()[state_].empty ())
+        {
+            node_ptr_vector node_ptr_vector_;
+            // vector mapping token indexes to partitioned token index sets
+            index_set_vector set_mapping_;
+            // syntax tree
+            detail::node *root_ = build_tree (rules_, state_,
+                node_ptr_vector_, internals_, set_mapping_,
+                seen_BOL_assertion_, seen_EOL_assertion_);
 
-                internals_._seen_BOL_assertion = false;
-                internals_._seen_EOL_assertion = false;
-            }
+            build_dfa (root_, set_mapping_,
+                internals_._dfa_alphabet[state_],
+                *internals_._dfa[state_]);
         }
+    }
+
+    static void set_assertions (basic_state_machine<CharT> &state_machine_,
+        const bool seen_BOL_assertion_, const bool seen_EOL_assertion_)
+    {
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (state_machine_.data ());
 
         internals_._seen_BOL_assertion = seen_BOL_assertion_;
         internals_._seen_EOL_assertion = seen_EOL_assertion_;
     }
 
-    static void minimise (basic_state_machine<CharT> &state_machine_)
+    static void minimise_state (basic_state_machine<CharT> &state_machine_,
+        const std::size_t state_)
     {
         detail::internals &internals_ = const_cast<detail::internals &>
             (state_machine_.data ());
-        const std::size_t machines_ = internals_._dfa->size ();
+        const std::size_t dfa_alphabet_ = internals_._dfa_alphabet[state_];
+        size_t_vector *dfa_ = internals_._dfa[state_];
 
-        for (std::size_t i_ = 0; i_ < machines_; ++i_)
+        if (dfa_alphabet_ != 0)
         {
-            const std::size_t dfa_alphabet_ = internals_._dfa_alphabet[i_];
-            size_t_vector *dfa_ = internals_._dfa[i_];
+            std::size_t size_ = 0;
 
-            if (dfa_alphabet_ != 0)
+            do
             {
-                std::size_t size_ = 0;
-
-                do
-                {
-                    size_ = dfa_->size ();
-                    minimise_dfa (dfa_alphabet_, *dfa_, size_);
-                } while (dfa_->size () != size_);
-            }
+                size_ = dfa_->size ();
+                minimise_dfa (dfa_alphabet_, *dfa_, size_);
+            } while (dfa_->size () != size_);
         }
     }
 
@@ -139,7 +168,8 @@ protected:
 
     static detail::node *build_tree (const rules &rules_,
         const std::size_t state_, node_ptr_vector &node_ptr_vector_,
-        detail::internals &internals_, index_set_vector &set_mapping_)
+        detail::internals &internals_, index_set_vector &set_mapping_,
+        bool &seen_BOL_assertion_, bool &seen_EOL_assertion_)
     {
         size_t_vector *lookup_ = internals_._lookup[state_];
         const typename rules::string_deque_deque &regexes_ =
@@ -168,13 +198,13 @@ protected:
 
         build_macros (token_map_, macrodeque_, macromap_,
             rules_.flags (), rules_.locale (), node_ptr_vector_,
-            internals_._seen_BOL_assertion, internals_._seen_EOL_assertion);
+            seen_BOL_assertion_, seen_EOL_assertion_);
 
         detail::node *root_ = parser::parse (regex_.c_str (),
             regex_.c_str () + regex_.size (), *ids_iter_, *unique_ids_iter_,
             *states_iter_, rules_.flags (), rules_.locale (), node_ptr_vector_,
-            macromap_, token_map_, internals_._seen_BOL_assertion,
-            internals_._seen_EOL_assertion);
+            macromap_, token_map_, seen_BOL_assertion_,
+            seen_EOL_assertion_);
 
         ++regex_iter_;
         ++ids_iter_;
@@ -192,8 +222,8 @@ protected:
                 regex_.c_str () + regex_.size (), *ids_iter_,
                 *unique_ids_iter_, *states_iter_, rules_.flags (),
                 rules_.locale (), node_ptr_vector_, macromap_, token_map_,
-                internals_._seen_BOL_assertion,
-                internals_._seen_EOL_assertion);
+                seen_BOL_assertion_,
+                seen_EOL_assertion_);
             tree_vector_.push_back (root_);
             ++regex_iter_;
             ++ids_iter_;
@@ -201,7 +231,7 @@ protected:
             ++states_iter_;
         }
 
-        if (internals_._seen_BOL_assertion)
+        if (seen_BOL_assertion_)
         {
             // Fixup BOLs
             typename detail::node::node_vector::iterator iter_ =
@@ -11,6 +11,7 @@
 #include "consts.hpp" // num_chars, num_wchar_ts
 #include <string>
 #include <limits>
+#include <sstream>
 
 namespace boost
 {
@@ -0,0 +1,134 @@
+//  Copyright (c) 2001 Daniel C. Nuffer
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_ISTREAM_BLOCK_POLICY_OCT_19_2026_0215PM)
+#define BOOST_SPIRIT_ISTREAM_BLOCK_POLICY_OCT_19_2026_0215PM
+
+#include <boost/spirit/home/support/iterators/multi_pass_fwd.hpp>
+#include <boost/spirit/home/support/iterators/detail/multi_pass.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace spirit { namespace iterator_policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  class istream_block
+    //  Implementation of the InputPolicy used by multi_pass
+    //
+    //  The istream_block encapsulates an std::basic_istream. Unlike the
+    //  istream policy it does not extract the characters one by one, but
+    //  reads blocks of BlockSize characters at once from the stream buffer
+    //  (using sgetn) and hands out the characters from the current block.
+    //  The characters are read unformatted (as by an istreambuf_iterator),
+    //  i.e. the skipws flag of the stream is ignored. Whole blocks are read
+    //  ahead of the parser, so the stream is left positioned after the last
+    //  block read, not after the last character consumed.
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t BlockSize>
+    struct istream_block
+    {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        class unique // : public detail::default_input_policy
+        {
+        private:
+            typedef typename T::char_type result_type;
+
+        public:
+            typedef typename T::off_type difference_type;
+            typedef typename T::off_type distance_type;
+            typedef result_type const* pointer;
+            typedef result_type const& reference;
+            typedef result_type value_type;
+
+        protected:
+            unique() {}
+            explicit unique(T&) {}
+
+            void swap(unique&) {}
+
+        public:
+            template <typename MultiPass>
+            static void destroy(MultiPass&) {}
+
+            template <typename MultiPass>
+            static typename MultiPass::reference get_input(MultiPass& mp)
+            {
+                if (mp.shared()->current_ == mp.shared()->end_)
+                    mp.shared()->read_block();
+                BOOST_ASSERT(mp.shared()->current_ != mp.shared()->end_);
+                return *mp.shared()->current_;
+            }
+
+            template <typename MultiPass>
+            static void advance_input(MultiPass& mp)
+            {
+                if (mp.shared()->current_ == mp.shared()->end_)
+                    mp.shared()->read_block();
+                BOOST_ASSERT(mp.shared()->current_ != mp.shared()->end_);
+                ++mp.shared()->current_;
+            }
+
+            // test, whether we reached the end of the underlying stream
+            template <typename MultiPass>
+            static bool input_at_eof(MultiPass const& mp)
+            {
+                return mp.shared()->current_ == mp.shared()->end_
+                    && !mp.shared()->read_block();
+            }
+
+            template <typename MultiPass>
+            static bool input_is_valid(MultiPass const& mp, value_type const&)
+            {
+                return mp.shared()->current_ != mp.shared()->end_;
+            }
+
+            // no unique data elements
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct shared
+        {
+        private:
+            typedef typename T::char_type result_type;
+
+        public:
+            explicit shared(T& input)
+              : input_(input), block_(BlockSize ? BlockSize : 1)
+              , current_(0), end_(0)
+            {}
+
+            // read the next block, returns false at the end of the input
+            bool read_block()
+            {
+                std::streamsize count = 0;
+                if (input_.good())
+                {
+                    count = input_.rdbuf()->sgetn(&block_[0]
+                      , static_cast<std::streamsize>(block_.size()));
+                    if (count <= 0)
+                    {
+                        count = 0;
+                        input_.setstate(T::eofbit);
+                    }
+                }
+                current_ = &block_[0];
+                end_ = current_ + count;
+                return count != 0;
+            }
+
+            T& input_;
+            std::vector<result_type> block_;
+            result_type const* current_;
+            result_type const* end_;
+        };
+    };
+
+}}}
+
+#endif
@@ -0,0 +1,278 @@
+//  Copyright (c) 2001 Daniel C. Nuffer
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_ITERATOR_RING_BUFFER_POLICY_OCT_19_2026_1140AM)
+#define BOOST_SPIRIT_ITERATOR_RING_BUFFER_POLICY_OCT_19_2026_1140AM
+
+#include <boost/spirit/home/support/iterators/multi_pass_fwd.hpp>
+#include <boost/spirit/home/support/iterators/detail/multi_pass.hpp>
+#include <boost/spirit/home/support/iterators/detail/buf_id_check_policy.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/swap.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+namespace boost { namespace spirit { namespace iterator_policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  class buffer_overflow
+    //  thrown by the ring_buffer StoragePolicy if the buffered input would
+    //  exceed the configured maximum size
+    ///////////////////////////////////////////////////////////////////////////
+    class buffer_overflow : public std::exception
+    {
+    public:
+        buffer_overflow() throw() {}
+        ~buffer_overflow() throw() {}
+
+        char const* what() const throw()
+        {
+            return "boost::spirit::multi_pass::buffer_overflow";
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  buffer_statistics
+    //  reported by get_buffer_statistics() for a multi_pass using the
+    //  ring_buffer StoragePolicy
+    ///////////////////////////////////////////////////////////////////////////
+    struct buffer_statistics
+    {
+        std::size_t size;               // number of buffered elements
+        std::size_t capacity;           // number of allocated elements
+        std::size_t high_water_mark;    // maximum size so far
+        std::size_t reallocations;      // number of times the buffer grew
+        boost::uint64_t position;       // input position of the oldest
+                                        // buffered element
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  class ring_buffer
+    //
+    //  Implementation of the StoragePolicy used by multi_pass
+    //  This stores the buffered data in a circular buffer, growing it by
+    //  doubling its size whenever it is full. Every iterator stores the
+    //  absolute input position it refers to, so the buffer can drop the
+    //  data in front of it without invalidating the iterators referring
+    //  to the remaining data:
+    //
+    //  - As long as there is only one iterator, nothing is buffered at all.
+    //  - multi_pass::clear_queue() (and the flush_multi_pass parser) commit
+    //    the position of the iterator it is called on: everything in front
+    //    of it is dropped, the buffered data behind it is kept. The other
+    //    iterators stay valid with the no_check CheckingPolicy only, the
+    //    buf_id_check policy invalidates them all on every commit.
+    //
+    //  Dereferencing an iterator referring to dropped data throws
+    //  illegal_backtracking. If N is not zero, buffering more than N
+    //  elements throws buffer_overflow, so the memory used by the buffer
+    //  stays bounded as long as the parser commits often enough.
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    struct ring_buffer
+    {
+        enum { initial_capacity = (N != 0 && N < 16) ? N : 16 };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        struct shared;
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        class unique : public detail::default_storage_policy
+        {
+        private:
+            typedef typename ring_buffer::BOOST_NESTED_TEMPLATE shared<Value>
+                shared_type;
+
+        protected:
+            unique() : queued_position(0) {}
+
+            unique(unique const& x)
+              : queued_position(x.queued_position) {}
+
+            void swap(unique& x)
+            {
+                boost::swap(queued_position, x.queued_position);
+            }
+
+            // This is called when the iterator is dereferenced. It's a
+            // template method so we can recover the type of the multi_pass
+            // iterator and call get_input.
+            template <typename MultiPass>
+            static typename MultiPass::reference
+            dereference(MultiPass const& mp)
+            {
+                shared_type& data = *mp.shared();
+
+                BOOST_ASSERT(mp.queued_position <= data.last_position);
+
+                if (mp.queued_position == data.last_position)
+                    return MultiPass::get_input(mp);
+
+                if (mp.queued_position < data.first_position)
+                    boost::throw_exception(illegal_backtracking());
+
+                return data.queued_elements[
+                    mp.queued_position & (data.queued_elements.size() - 1)];
+            }
+
+            // This is called when the iterator is incremented. It's a template
+            // method so we can recover the type of the multi_pass iterator
+            // and call is_unique and advance_input.
+            template <typename MultiPass>
+            static void increment(MultiPass& mp)
+            {
+                shared_type& data = *mp.shared();
+
+                BOOST_ASSERT(mp.queued_position <= data.last_position);
+
+                if (mp.queued_position == data.last_position)
+                {
+                    if (MultiPass::is_unique(mp))
+                    {
+                        // no other iterator may come back here, there is no
+                        // need to store the current element
+                        data.first_position = mp.queued_position + 1;
+                    }
+                    else
+                    {
+                        push_back(data, MultiPass::get_input(mp));
+                    }
+                    data.last_position = ++mp.queued_position;
+                    MultiPass::advance_input(mp);
+                }
+                else
+                {
+                    ++mp.queued_position;
+                }
+            }
+
+            // called to forcibly clear the queue, this commits the current
+            // position: everything in front of it is dropped
+            template <typename MultiPass>
+            static void clear_queue(MultiPass& mp)
+            {
+                shared_type& data = *mp.shared();
+                if (mp.queued_position > data.first_position)
+                    data.first_position = mp.queued_position;
+            }
+
+            // called to determine whether the iterator is an eof iterator
+            template <typename MultiPass>
+            static bool is_eof(MultiPass const& mp)
+            {
+                return mp.queued_position == mp.shared()->last_position
+                    && MultiPass::input_at_eof(mp);
+            }
+
+            // called by operator==
+            template <typename MultiPass>
+            static bool equal_to(MultiPass const& mp, MultiPass const& x)
+            {
+                return mp.queued_position == x.queued_position;
+            }
+
+            // called by operator<
+            template <typename MultiPass>
+            static bool less_than(MultiPass const& mp, MultiPass const& x)
+            {
+                return mp.queued_position < x.queued_position;
+            }
+
+            template <typename MultiPass>
+            static void destroy(MultiPass&) {}
+
+        private:
+            static void push_back(shared_type& data, Value const& value)
+            {
+                std::size_t const size = static_cast<std::size_t>(
+                    data.last_position - data.first_position);
+
+                if (N != 0 && size >= N)
+                    boost::throw_exception(buffer_overflow());
+                if (size == data.queued_elements.size())
+                    data.grow();
+
+                data.queued_elements[data.last_position &
+                    (data.queued_elements.size() - 1)] = value;
+                if (size + 1 > data.high_water_mark)
+                    data.high_water_mark = size + 1;
+            }
+
+        protected:
+            mutable boost::uint64_t queued_position;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        struct shared
+        {
+            typedef std::vector<Value> queue_type;
+
+            shared()
+              : queued_elements(initial_capacity_pow2())
+              , first_position(0), last_position(0)
+              , high_water_mark(0), reallocations(0)
+            {}
+
+            // the capacity is kept at a power of two, so positions can be
+            // mapped to buffer slots by masking
+            static std::size_t initial_capacity_pow2()
+            {
+                std::size_t capacity = 1;
+                while (capacity < std::size_t(initial_capacity))
+                    capacity <<= 1;
+                return capacity;
+            }
+
+            void grow()
+            {
+                std::size_t const capacity = queued_elements.size();
+                std::size_t const mask = capacity - 1;
+                queue_type elements(capacity * 2);
+                for (boost::uint64_t i = first_position; i != last_position; ++i)
+                    elements[i & (capacity * 2 - 1)] = queued_elements[i & mask];
+                queued_elements.swap(elements);
+                ++reallocations;
+            }
+
+            queue_type queued_elements;
+            boost::uint64_t first_position;     // oldest buffered element
+            boost::uint64_t last_position;      // one past the newest one
+            std::size_t high_water_mark;
+            std::size_t reallocations;
+        };
+
+    }; // ring_buffer
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  get_buffer_statistics
+    //  reports the state of the buffer of a multi_pass using the ring_buffer
+    //  StoragePolicy
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename MultiPass>
+    inline buffer_statistics get_buffer_statistics(MultiPass const& mp)
+    {
+        buffer_statistics stats = { 0, 0, 0, 0, 0 };
+        if (0 != mp.shared())
+        {
+            stats.size = static_cast<std::size_t>(
+                mp.shared()->last_position - mp.shared()->first_position);
+            stats.capacity = mp.shared()->queued_elements.size();
+            stats.high_water_mark = mp.shared()->high_water_mark;
+            stats.reallocations = mp.shared()->reallocations;
+            stats.position = mp.shared()->first_position;
+        }
+        return stats;
+    }
+
+}}}
+
+#endif
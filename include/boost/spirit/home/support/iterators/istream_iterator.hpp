@@ -13,6 +13,7 @@
 #include <boost/spirit/home/support/iterators/detail/no_check_policy.hpp>
 #endif
 #include <boost/spirit/home/support/iterators/detail/istream_policy.hpp>
+#include <boost/spirit/home/support/iterators/detail/istream_block_policy.hpp>
 #include <boost/spirit/home/support/iterators/detail/split_std_deque_policy.hpp>
 #include <boost/spirit/home/support/iterators/detail/combine_policies.hpp>
 #include <boost/spirit/home/support/iterators/multi_pass.hpp>
@@ -75,6 +76,64 @@ namespace boost { namespace spirit
 
     typedef basic_istream_iterator<char> istream_iterator;
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  The basic_istream_block_iterator reads the characters of the stream
+    //  in blocks of BlockSize characters (see istream_block_policy.hpp).
+    //  Unlike the basic_istream_iterator it reads unformatted: the skipws
+    //  flag of the stream is ignored.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Elem, typename Traits = std::char_traits<Elem>
+      , std::size_t BlockSize = 4096>
+    class basic_istream_block_iterator :
+        public multi_pass<
+            std::basic_istream<Elem, Traits>
+          , iterator_policies::default_policy<
+                iterator_policies::ref_counted
+#if defined(BOOST_SPIRIT_DEBUG)
+              , iterator_policies::buf_id_check
+#else
+              , iterator_policies::no_check
+#endif
+              , iterator_policies::istream_block<BlockSize>
+              , iterator_policies::split_std_deque> 
+        >
+    {
+    private:
+        typedef multi_pass<
+            std::basic_istream<Elem, Traits>
+          , iterator_policies::default_policy<
+                iterator_policies::ref_counted
+#if defined(BOOST_SPIRIT_DEBUG)
+              , iterator_policies::buf_id_check
+#else
+              , iterator_policies::no_check
+#endif
+              , iterator_policies::istream_block<BlockSize>
+              , iterator_policies::split_std_deque> 
+        > base_type;
+
+    public:
+        basic_istream_block_iterator()
+          : base_type() {}
+
+        explicit basic_istream_block_iterator(
+                std::basic_istream<Elem, Traits>& x)
+          : base_type(x) {}
+
+        basic_istream_block_iterator(basic_istream_block_iterator const& x)
+          : base_type(x) {}
+
+        basic_istream_block_iterator operator= (base_type const& rhs)
+        {
+            this->base_type::operator=(rhs);
+            return *this;
+        }
+
+    // default generated operators, destructor and assignment operator are ok.
+    };
+
+    typedef basic_istream_block_iterator<char> istream_block_iterator;
+
 }}
 
 #endif
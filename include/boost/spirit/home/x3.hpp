@@ -15,13 +15,14 @@
 //~ #include <boost/spirit/home/x3/auto.hpp>
 #include <boost/spirit/home/x3/auxiliary.hpp>
 #include <boost/spirit/home/x3/char.hpp>
-//~ #include <boost/spirit/home/x3/binary.hpp>
+#include <boost/spirit/home/x3/binary.hpp>
 #include <boost/spirit/home/x3/directive.hpp>
 #include <boost/spirit/home/x3/nonterminal.hpp>
 #include <boost/spirit/home/x3/numeric.hpp>
 #include <boost/spirit/home/x3/operator.hpp>
 #include <boost/spirit/home/x3/core.hpp>
 #include <boost/spirit/home/x3/string.hpp>
+#include <boost/spirit/home/x3/token.hpp>
 //~ #include <boost/spirit/home/x3/stream.hpp>
 
 #endif
@@ -0,0 +1,346 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_BINARY_OCTOBER_19_2026_1131AM)
+#define BOOST_SPIRIT_X3_BINARY_OCTOBER_19_2026_1131AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/core/skip_over.hpp>
+#include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/support/detail/binary_copy.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        // Read one binary value of bits/8 bytes in the given byte order
+        template <BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+          , int bits, typename Iterator, typename T>
+        inline bool
+        read_binary(Iterator& first, Iterator const& last, T& value)
+        {
+            static_assert(sizeof(T) == bits / 8, "Invalid binary value type");
+
+            unsigned char bytes[bits / 8];
+            Iterator it = first;
+            for (std::size_t i = 0; i != sizeof(bytes); ++i)
+            {
+                if (it == last)
+                    return false;
+                bytes[i] = static_cast<unsigned char>(*it++);
+            }
+
+            spirit::detail::copy_binary_array<endian, bits>(bytes, 1, &value);
+            first = it;
+            return true;
+        }
+
+        template <BOOST_SCOPED_ENUM(boost::endian::endianness) endian>
+        struct binary_what;
+
+        template <>
+        struct binary_what<boost::endian::endianness::native>
+        {
+            static char const* is() { return "native-endian binary"; }
+        };
+
+        template <>
+        struct binary_what<boost::endian::endianness::little>
+        {
+            static char const* is() { return "little-endian binary"; }
+        };
+
+        template <>
+        struct binary_what<boost::endian::endianness::big>
+        {
+            static char const* is() { return "big-endian binary"; }
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename T
+      , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits>
+    struct binary_lit_parser
+      : parser<binary_lit_parser<V, T, endian, bits>>
+    {
+        static bool const has_attribute = false;
+        typedef unused_type attribute_type;
+
+        binary_lit_parser(V n)
+          : n(n) {}
+
+        template <typename Iterator, typename Context, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute&) const
+        {
+            x3::skip_over(first, last, context);
+
+            // compare the bytes, not the values (think NaNs)
+            T const value = static_cast<T>(n);
+            unsigned char expected[bits / 8];
+            spirit::detail::copy_binary_array<endian, bits>(
+                reinterpret_cast<unsigned char const*>(&value), 1, expected);
+
+            Iterator it = first;
+            for (std::size_t i = 0; i != sizeof(expected); ++i)
+            {
+                if (it == last || expected[i] != static_cast<unsigned char>(*it++))
+                    return false;
+            }
+
+            first = it;
+            return true;
+        }
+
+        V n;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+      , int bits>
+    struct any_binary_parser : parser<any_binary_parser<T, endian, bits>>
+    {
+        typedef T attribute_type;
+        static bool const has_attribute = true;
+
+        template <typename Iterator, typename Context, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute& attr) const
+        {
+            x3::skip_over(first, last, context);
+
+            T value;
+            if (!detail::read_binary<endian, bits>(first, last, value))
+                return false;
+
+            traits::move_to(value, attr);
+            return true;
+        }
+
+        template <typename V>
+        binary_lit_parser<V, T, endian, bits> operator()(V n) const
+        {
+            return binary_lit_parser<V, T, endian, bits>(n);
+        }
+    };
+
+#define BOOST_SPIRIT_X3_BINARY_PARSER(name, endiantype, attrtype, bits)         \
+    typedef any_binary_parser<                                                  \
+        attrtype, boost::endian::endianness::endiantype, bits> name##type;      \
+    name##type const name = name##type();                                       \
+    /***/
+
+    BOOST_SPIRIT_X3_BINARY_PARSER(byte_, native, uint8_t, 8)
+    BOOST_SPIRIT_X3_BINARY_PARSER(word, native, uint16_t, 16)
+    BOOST_SPIRIT_X3_BINARY_PARSER(dword, native, uint32_t, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(qword, native, uint64_t, 64)
+    BOOST_SPIRIT_X3_BINARY_PARSER(big_word, big, uint16_t, 16)
+    BOOST_SPIRIT_X3_BINARY_PARSER(big_dword, big, uint32_t, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(big_qword, big, uint64_t, 64)
+    BOOST_SPIRIT_X3_BINARY_PARSER(little_word, little, uint16_t, 16)
+    BOOST_SPIRIT_X3_BINARY_PARSER(little_dword, little, uint32_t, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(little_qword, little, uint64_t, 64)
+    BOOST_SPIRIT_X3_BINARY_PARSER(bin_float, native, float, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(big_bin_float, big, float, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(little_bin_float, little, float, 32)
+    BOOST_SPIRIT_X3_BINARY_PARSER(bin_double, native, double, 64)
+    BOOST_SPIRIT_X3_BINARY_PARSER(big_bin_double, big, double, 64)
+    BOOST_SPIRIT_X3_BINARY_PARSER(little_bin_double, little, double, 64)
+
+#undef BOOST_SPIRIT_X3_BINARY_PARSER
+
+    ///////////////////////////////////////////////////////////////////////////
+    // binary_array(n)[p], where p is one of the binary parsers above, parses
+    // exactly n values into a container attribute. n is either a number or
+    // a function object called with the context (e.g. to return a length
+    // prefix parsed earlier, see with<ID>(val)).
+    //
+    // If the input iterator is a pointer to a byte sized type, there is no
+    // skipper and the attribute is unused or a std::vector of a (non bool)
+    // arithmetic type matching the size and kind of the parsed values, all
+    // values are copied in one go (a memcpy into the resized vector followed,
+    // if needed, by an in place byte swap). Otherwise the values are parsed
+    // one by one.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Count, typename Context>
+        inline std::size_t
+        binary_array_count(Count const& n, Context const&, mpl::true_)
+        {
+            return n > Count(0) ? static_cast<std::size_t>(n) : 0;
+        }
+
+        template <typename Count, typename Context>
+        inline std::size_t
+        binary_array_count(Count const& n, Context const& context, mpl::false_)
+        {
+            return n(context);
+        }
+
+        template <typename Attribute, typename T>
+        struct is_binary_array_attribute : mpl::false_ {};
+
+        template <typename T>
+        struct is_binary_array_attribute<unused_type, T> : mpl::true_ {};
+
+        template <typename V, typename Allocator, typename T>
+        struct is_binary_array_attribute<std::vector<V, Allocator>, T>
+          : mpl::bool_<
+                is_arithmetic<V>::value && !is_same<V, bool>::value
+             && sizeof(V) == sizeof(T)
+             && is_floating_point<V>::value == is_floating_point<T>::value>
+        {};
+    }
+
+    template <typename T, BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+      , int bits, typename Count>
+    struct binary_array_parser
+      : parser<binary_array_parser<T, endian, bits, Count>>
+    {
+        typedef std::vector<T> attribute_type;
+        static bool const has_attribute = true;
+        static bool const handles_container = true;
+
+        binary_array_parser(Count const& count)
+          : count(count) {}
+
+        template <typename Iterator, typename Context, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute& attr) const
+        {
+            std::size_t const n = detail::binary_array_count(
+                count, context, is_integral<Count>());
+
+            typedef mpl::bool_<
+                is_pointer<Iterator>::value && sizeof(*first) == 1
+             && !has_skipper<Context>::value
+             && detail::is_binary_array_attribute<
+                    typename remove_const<Attribute>::type, T>::value>
+            is_bulk;
+
+            return parse_array(first, last, context, attr, n, is_bulk());
+        }
+
+        Count count;
+
+    private:
+
+        template <typename Iterator, typename Context, typename Attribute>
+        static bool parse_array(Iterator& first, Iterator const& last
+          , Context const&, Attribute& attr, std::size_t n, mpl::true_)
+        {
+            std::size_t const size = bits / 8;
+            if (std::size_t(last - first) / size < n)
+                return false;
+
+            store(attr, first, n);
+            first += n * size;
+            return true;
+        }
+
+        template <typename Iterator, typename Context, typename Attribute>
+        static bool parse_array(Iterator& first, Iterator const& last
+          , Context const& context, Attribute& attr, std::size_t n, mpl::false_)
+        {
+            Iterator it = first;
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                x3::skip_over(it, last, context);
+
+                T value;
+                if (!detail::read_binary<endian, bits>(it, last, value)
+                  || !traits::push_back(attr, value))
+                {
+                    return false;
+                }
+            }
+
+            first = it;
+            return true;
+        }
+
+        template <typename Iterator>
+        static void store(unused_type, Iterator, std::size_t) {}
+
+        template <typename V, typename Allocator, typename Iterator>
+        static void store(std::vector<V, Allocator>& attr
+          , Iterator first, std::size_t n)
+        {
+            if (n == 0)
+                return;
+
+            std::size_t const old_size = attr.size();
+            attr.resize(old_size + n);
+            spirit::detail::copy_binary_array<endian, bits>(
+                reinterpret_cast<unsigned char const*>(first), n
+              , &attr[old_size]);
+        }
+    };
+
+    template <typename Count>
+    struct binary_array_gen
+    {
+        Count count;
+
+        template <typename T
+          , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits>
+        binary_array_parser<T, endian, bits, Count>
+        operator[](any_binary_parser<T, endian, bits> const&) const
+        {
+            return binary_array_parser<T, endian, bits, Count>(count);
+        }
+    };
+
+    template <typename Count>
+    inline binary_array_gen<Count> binary_array(Count const& count)
+    {
+        return binary_array_gen<Count>{count};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, BOOST_SCOPED_ENUM(boost::endian::endianness) endian
+      , int bits>
+    struct get_info<any_binary_parser<T, endian, bits>>
+    {
+        typedef std::string result_type;
+        std::string operator()(any_binary_parser<T, endian, bits> const&) const
+        {
+            return detail::binary_what<endian>::is();
+        }
+    };
+
+    template <typename V, typename T
+      , BOOST_SCOPED_ENUM(boost::endian::endianness) endian, int bits>
+    struct get_info<binary_lit_parser<V, T, endian, bits>>
+    {
+        typedef std::string result_type;
+        std::string operator()(binary_lit_parser<V, T, endian, bits> const&) const
+        {
+            return detail::binary_what<endian>::is();
+        }
+    };
+}}}
+
+#endif
@@ -0,0 +1,78 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_UNICODE_ASCII_OCTOBER_19_2026_1105AM)
+#define BOOST_SPIRIT_X3_UNICODE_ASCII_OCTOBER_19_2026_1105AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/cstdint.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Unicode character classes of the ASCII code points. The unicode char
+    // classes test code points below 0x80 against this table instead of
+    // going through the multi-stage ucd tables. The entries were generated
+    // from the ucd::is_xxx functions (support/char_encoding/unicode/query.hpp)
+    // and therefore follow the Unicode definitions, e.g. '$' is a symbol,
+    // not punctuation.
+    ///////////////////////////////////////////////////////////////////////////
+    struct unicode_ascii
+    {
+        enum mask
+        {
+            alnum = 0x001,
+            alpha = 0x002,
+            digit = 0x004,
+            xdigit = 0x008,
+            cntrl = 0x010,
+            graph = 0x020,
+            lower = 0x040,
+            print = 0x080,
+            punct = 0x100,
+            space = 0x200,
+            blank = 0x400,
+            upper = 0x800
+        };
+
+        static bool is(mask m, ::boost::uint32_t ch)
+        {
+            return (table<>::value[ch] & m) != 0;
+        }
+
+        template <typename Dummy = void>
+        struct table
+        {
+            static ::boost::uint16_t const value[128];
+        };
+    };
+
+    template <typename Dummy>
+    ::boost::uint16_t const unicode_ascii::table<Dummy>::value[128] =
+    {
+          0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010,
+          0x010, 0x610, 0x210, 0x210, 0x210, 0x210, 0x010, 0x010,
+          0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010,
+          0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010,
+          0x680, 0x1a0, 0x1a0, 0x1a0, 0x0a0, 0x1a0, 0x1a0, 0x1a0,
+          0x1a0, 0x1a0, 0x1a0, 0x0a0, 0x1a0, 0x1a0, 0x1a0, 0x1a0,
+          0x0ad, 0x0ad, 0x0ad, 0x0ad, 0x0ad, 0x0ad, 0x0ad, 0x0ad,
+          0x0ad, 0x0ad, 0x1a0, 0x1a0, 0x0a0, 0x0a0, 0x0a0, 0x1a0,
+          0x1a0, 0x8ab, 0x8ab, 0x8ab, 0x8ab, 0x8ab, 0x8ab, 0x8a3,
+          0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3,
+          0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3, 0x8a3,
+          0x8a3, 0x8a3, 0x8a3, 0x1a0, 0x1a0, 0x1a0, 0x0a0, 0x1a0,
+          0x0a0, 0x0eb, 0x0eb, 0x0eb, 0x0eb, 0x0eb, 0x0eb, 0x0e3,
+          0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3,
+          0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3, 0x0e3,
+          0x0e3, 0x0e3, 0x0e3, 0x1a0, 0x0a0, 0x1a0, 0x0a0, 0x010
+    };
+}}}}
+
+#endif
@@ -14,6 +14,7 @@
 #include <boost/spirit/home/x3/char/char_parser.hpp>
 #include <boost/spirit/home/x3/char/char.hpp>
 #include <boost/spirit/home/x3/char/detail/cast_char.hpp>
+#include <boost/spirit/home/x3/char/detail/unicode_ascii.hpp>
 #include <boost/spirit/home/support/char_encoding/unicode.hpp>
 
 namespace boost { namespace spirit { namespace x3
@@ -223,23 +224,36 @@ namespace boost { namespace spirit { namespace x3
         }                                                                       \
         /***/
 
+    // Code points below 0x80 are looked up in the flat ASCII table
+    // (detail/unicode_ascii.hpp) instead of the multi-stage ucd tables.
+#define BOOST_SPIRIT_X3_ASCII_CLASSIFY(name, mask, function)                      \
+        template <typename Char>                                                \
+        static bool                                                             \
+        is(name##_tag, Char ch)                                                 \
+        {                                                                       \
+            char_type const c = detail::cast_char<char_type>(ch);              \
+            return (c < 0x80) ?                                                 \
+                detail::unicode_ascii::is(detail::unicode_ascii::mask, c) :     \
+                encoding::function BOOST_PREVENT_MACRO_SUBSTITUTION (c);        \
+        }                                                                       \
+        /***/
 
     ///////////////////////////////////////////////////////////////////////////
     //  Unicode Major Categories
     ///////////////////////////////////////////////////////////////////////////
         BOOST_SPIRIT_X3_BASIC_CLASSIFY(char)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(alnum)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(alpha)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(digit)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(xdigit)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(cntrl)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(graph)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(lower)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(print)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(punct)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(space)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(blank)
-        BOOST_SPIRIT_X3_BASIC_CLASSIFY(upper)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(alnum, alnum, isalnum)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(alpha, alpha, isalpha)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(digit, digit, isdigit)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(xdigit, xdigit, isxdigit)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(cntrl, cntrl, iscntrl)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(graph, graph, isgraph)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(lower, lower, islower)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(print, print, isprint)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(punct, punct, ispunct)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(space, space, isspace)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(blank, blank, isblank)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(upper, upper, isupper)
 
     ///////////////////////////////////////////////////////////////////////////
     //  Unicode Major Categories
@@ -265,7 +279,7 @@ namespace boost { namespace spirit { namespace x3
         BOOST_SPIRIT_X3_CLASSIFY(enclosing_mark)
         BOOST_SPIRIT_X3_CLASSIFY(spacing_mark)
 
-        BOOST_SPIRIT_X3_CLASSIFY(decimal_number)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(decimal_number, digit, is_decimal_number)
         BOOST_SPIRIT_X3_CLASSIFY(letter_number)
         BOOST_SPIRIT_X3_CLASSIFY(other_number)
 
@@ -295,11 +309,11 @@ namespace boost { namespace spirit { namespace x3
     ///////////////////////////////////////////////////////////////////////////
     //  Unicode Derived Categories
     ///////////////////////////////////////////////////////////////////////////
-        BOOST_SPIRIT_X3_CLASSIFY(alphabetic)
-        BOOST_SPIRIT_X3_CLASSIFY(uppercase)
-        BOOST_SPIRIT_X3_CLASSIFY(lowercase)
-        BOOST_SPIRIT_X3_CLASSIFY(white_space)
-        BOOST_SPIRIT_X3_CLASSIFY(hex_digit)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(alphabetic, alpha, is_alphabetic)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(uppercase, upper, is_uppercase)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(lowercase, lower, is_lowercase)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(white_space, space, is_white_space)
+        BOOST_SPIRIT_X3_ASCII_CLASSIFY(hex_digit, xdigit, is_hex_digit)
         BOOST_SPIRIT_X3_CLASSIFY(noncharacter_code_point)
         BOOST_SPIRIT_X3_CLASSIFY(default_ignorable_code_point)
 
@@ -403,6 +417,7 @@ namespace boost { namespace spirit { namespace x3
 
 #undef BOOST_SPIRIT_X3_BASIC_CLASSIFY
 #undef BOOST_SPIRIT_X3_CLASSIFY
+#undef BOOST_SPIRIT_X3_ASCII_CLASSIFY
     };
 
     template <typename Tag>
@@ -4,8 +4,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
-#if !defined(SPIRIT_CALL_CONTEXT_MAY_26_2014_0234PM)
-#define SPIRIT_CALL_CONTEXT_MAY_26_2014_0234PM
+#if !defined(BOOST_SPIRIT_X3_CALL_CONTEXT_MAY_26_2014_0234PM)
+#define BOOST_SPIRIT_X3_CALL_CONTEXT_MAY_26_2014_0234PM
 
 #include <type_traits>
 
@@ -4,8 +4,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
-#if !defined(SPIRIT_PARSE_INTO_CONTAINER_JAN_15_2013_0957PM)
-#define SPIRIT_PARSE_INTO_CONTAINER_JAN_15_2013_0957PM
+#if !defined(BOOST_SPIRIT_X3_PARSE_INTO_CONTAINER_JAN_15_2013_0957PM)
+#define BOOST_SPIRIT_X3_PARSE_INTO_CONTAINER_JAN_15_2013_0957PM
 
 #if defined(_MSC_VER)
 #pragma once
@@ -92,11 +92,17 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             value_type;
             value_type val = traits::value_initialize<value_type>::call();
 
+            Iterator save = first;
             if (!parser.parse(first, last, context, rcontext, val))
                 return false;
 
-            // push the parsed value into our attribute
-            traits::push_back(attr, val);
+            // push the parsed value into our attribute (this fails if the
+            // container is full, see traits::is_fixed_capacity)
+            if (!traits::push_back(attr, val))
+            {
+                first = save;
+                return false;
+            }
             return true;
         }
 
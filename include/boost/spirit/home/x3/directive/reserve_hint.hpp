@@ -0,0 +1,107 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_RESERVE_HINT_OCTOBER_19_2026_1310PM)
+#define BOOST_SPIRIT_X3_RESERVE_HINT_OCTOBER_19_2026_1310PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <cstddef>
+
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        template <typename Hint, typename Context>
+        inline std::size_t
+        reserve_hint_size(Hint const& hint, Context const&, mpl::true_)
+        {
+            return hint;
+        }
+
+        template <typename Hint, typename Context>
+        inline std::size_t
+        reserve_hint_size(Hint const& hint, Context const& context, mpl::false_)
+        {
+            return hint(context);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // reserve_hint(n)[subject] makes room for n more elements in the
+    // (container) attribute before parsing the subject, avoiding repeated
+    // reallocations while the container grows. n is either a number or
+    // a function object called with the context, e.g. to return a length
+    // prefix parsed earlier (see with<ID>(val)). The hint does not limit
+    // the number of elements parsed.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Hint>
+    struct reserve_hint_directive
+      : unary_parser<Subject, reserve_hint_directive<Subject, Hint>>
+    {
+        typedef unary_parser<Subject, reserve_hint_directive<Subject, Hint> >
+            base_type;
+        static bool const is_pass_through_unary = true;
+        static bool const handles_container = Subject::handles_container;
+
+        reserve_hint_directive(Subject const& subject, Hint const& hint)
+          : base_type(subject), hint(hint) {}
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr) const
+        {
+            reserve(attr, context, traits::is_container<Attribute>());
+            return this->subject.parse(first, last, context, rcontext, attr);
+        }
+
+        Hint hint;
+
+    private:
+
+        template <typename Attribute, typename Context>
+        void reserve(Attribute& attr, Context const& context, mpl::true_) const
+        {
+            traits::reserve(attr, attr.size()
+              + detail::reserve_hint_size(hint, context, is_integral<Hint>()));
+        }
+
+        template <typename Attribute, typename Context>
+        void reserve(Attribute&, Context const&, mpl::false_) const
+        {
+        }
+    };
+
+    template <typename Hint>
+    struct reserve_hint_gen
+    {
+        Hint hint;
+
+        template <typename Subject>
+        reserve_hint_directive<
+            typename extension::as_parser<Subject>::value_type, Hint>
+        operator[](Subject const& subject) const
+        {
+            return {as_parser(subject), hint};
+        }
+    };
+
+    template <typename Hint>
+    inline reserve_hint_gen<Hint> reserve_hint(Hint const& hint)
+    {
+        return reserve_hint_gen<Hint>{hint};
+    }
+}}}
+
+#endif
@@ -4,8 +4,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
-#if !defined(SPIRIT_X3_WITH_MAY_02_2014_0749AM)
-#define SPIRIT_X3_WITH_MAY_02_2014_0749AM
+#if !defined(BOOST_SPIRIT_X3_WITH_MAY_02_2014_0749AM)
+#define BOOST_SPIRIT_X3_WITH_MAY_02_2014_0749AM
 
 #include <boost/spirit/home/x3/support/unused.hpp>
 #include <boost/spirit/home/x3/core/parser.hpp>
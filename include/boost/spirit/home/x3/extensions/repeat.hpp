@@ -6,8 +6,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
-#if !defined(SPIRIT_X3_REPEAT_APRIL_16_2014_0848AM)
-#define SPIRIT_X3_REPEAT_APRIL_16_2014_0848AM
+#if !defined(BOOST_SPIRIT_X3_REPEAT_APRIL_16_2014_0848AM)
+#define BOOST_SPIRIT_X3_REPEAT_APRIL_16_2014_0848AM
 
 #if defined(_MSC_VER)
 #pragma once
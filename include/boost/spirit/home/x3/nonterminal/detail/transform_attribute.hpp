@@ -5,8 +5,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
-#if !defined(SPIRIT_X3_DETAIL_ATTRIBUTES_APR_18_2010_0458PM)
-#define SPIRIT_X3_DETAIL_ATTRIBUTES_APR_18_2010_0458PM
+#if !defined(BOOST_SPIRIT_X3_DETAIL_ATTRIBUTES_APR_18_2010_0458PM)
+#define BOOST_SPIRIT_X3_DETAIL_ATTRIBUTES_APR_18_2010_0458PM
 
 #include <boost/spirit/home/x3/support/traits/transform_attribute.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
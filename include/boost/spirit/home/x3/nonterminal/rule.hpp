@@ -17,6 +17,8 @@
 #include <boost/preprocessor/variadic/to_seq.hpp>
 #include <boost/preprocessor/variadic/elem.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/seq/for_each_i.hpp>
+#include <boost/preprocessor/cat.hpp>
 
 #if !defined(BOOST_SPIRIT_X3_NO_RTTI)
 #include <typeinfo>
@@ -156,10 +158,19 @@ namespace boost { namespace spirit { namespace x3
     BOOST_SPIRIT_DECLARE_, _, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))            \
     /***/
     
-#define BOOST_SPIRIT_DEFINE_(r, data, def)                                      \
+    // The rule type is named through a typedef: some compilers (e.g. g++)
+    // treat decltype(def) spelled inside the function template signature
+    // as dependent, which makes the generic parse_rule above win overload
+    // resolution.
+#define BOOST_SPIRIT_DEFINE_LHS_(line, i)                                      \
+    BOOST_PP_CAT(BOOST_PP_CAT(boost_spirit_define_lhs_, line), BOOST_PP_CAT(_, i)) \
+    /***/
+
+#define BOOST_SPIRIT_DEFINE_(r, line, i, def)                                   \
+    typedef decltype(def)::lhs_type BOOST_SPIRIT_DEFINE_LHS_(line, i);          \
     template <typename Iterator, typename Context, typename Attribute>          \
     inline bool parse_rule(                                                     \
-        decltype(def)::lhs_type rule_                                           \
+        BOOST_SPIRIT_DEFINE_LHS_(line, i) rule_                                 \
       , Iterator& first, Iterator const& last                                   \
       , Context const& context, Attribute& attr)                                \
     {                                                                           \
@@ -169,8 +180,8 @@ namespace boost { namespace spirit { namespace x3
     }                                                                           \
     /***/
 
-#define BOOST_SPIRIT_DEFINE(...) BOOST_PP_SEQ_FOR_EACH(                         \
-    BOOST_SPIRIT_DEFINE_, _, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))             \
+#define BOOST_SPIRIT_DEFINE(...) BOOST_PP_SEQ_FOR_EACH_I(                       \
+    BOOST_SPIRIT_DEFINE_, __LINE__, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))      \
     /***/
 
 #define BOOST_SPIRIT_INSTANTIATE(rule_type, Iterator, Context)                  \
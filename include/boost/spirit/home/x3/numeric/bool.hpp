@@ -5,8 +5,8 @@
     Distributed under the Boost Software License, Version 1.0. (See accompanying
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 ==============================================================================*/
-#if !defined(SPIRIT_X3_BOOL_SEP_29_2009_0709AM)
-#define SPIRIT_X3_BOOL_SEP_29_2009_0709AM
+#if !defined(BOOST_SPIRIT_X3_BOOL_SEP_29_2009_0709AM)
+#define BOOST_SPIRIT_X3_BOOL_SEP_29_2009_0709AM
 
 #include <boost/spirit/home/x3/core/parser.hpp>
 #include <boost/spirit/home/x3/core/skip_over.hpp>
@@ -236,8 +236,9 @@ namespace boost { namespace spirit { namespace x3
         {
             x3::skip_over(first, last, context);
 
+            lookup_read_guard<Lookup> guard(*lookup);
             if (value_type* val_ptr
-                = lookup->find(first, last, Filter()))
+                = guard.find(first, last, Filter()))
             {
                 x3::traits::move_to(*val_ptr, attr);
                 return true;
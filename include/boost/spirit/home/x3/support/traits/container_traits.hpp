@@ -15,11 +15,14 @@
 
 #include <boost/fusion/support/category_of.hpp>
 #include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/utility/sfinae.hpp>
 #include <boost/detail/iterator.hpp>
 #include <boost/fusion/include/deque.hpp>
 #include <boost/mpl/has_xxx.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/identity.hpp>
+#include <boost/utility/declval.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <vector>
 #include <string>
 
@@ -105,6 +108,20 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     struct container_iterator<unused_type const>
         : mpl::identity<unused_type const*> {};
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Containers with a fixed, inline capacity (boost::container::static_vector
+    // or any other type exposing a static_capacity member). Adding elements
+    // beyond the capacity fails (making the parse fail) instead of throwing.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Container, typename Enable = void>
+    struct is_fixed_capacity : mpl::false_ {};
+
+    template <typename Container>
+    struct is_fixed_capacity<Container
+      , typename disable_if_substitution_failure<
+            decltype(Container::static_capacity)>::type>
+      : mpl::true_ {};
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Container, typename T>
     bool push_back(Container& c, T&& val);
@@ -120,6 +137,20 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
         }
     };
 
+    template <typename Container>
+    struct push_back_container<Container
+      , typename enable_if<is_fixed_capacity<Container>>::type>
+    {
+        template <typename T>
+        static bool call(Container& c, T&& val)
+        {
+            if (c.size() >= c.capacity())
+                return false;
+            c.insert(c.end(), std::move(val));
+            return true;
+        }
+    };
+
     template <typename Container, typename T>
     inline bool push_back(Container& c, T&& val)
     {
@@ -169,6 +200,20 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
         }
     };
 
+    template <typename Container>
+    struct append_container<Container
+      , typename enable_if<is_fixed_capacity<Container>>::type>
+    {
+        template <typename Iterator>
+        static bool call(Container& c, Iterator first, Iterator last)
+        {
+            if (c.capacity() - c.size() < std::size_t(std::distance(first, last)))
+                return false;
+            c.insert(c.end(), first, last);
+            return true;
+        }
+    };
+
     template <typename Container, typename Iterator>
     inline bool append(Container& c, Iterator first, Iterator last)
     {
@@ -181,6 +226,37 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Make room for at least size elements (a hint only; containers
+    // without a reserve member are left alone)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Container, typename Enable = void>
+    struct reserve_container
+    {
+        static void call(Container&, std::size_t) {}
+    };
+
+    template <typename Container>
+    struct reserve_container<Container
+      , typename disable_if_substitution_failure<
+            decltype(boost::declval<Container&>().reserve(0))>::type>
+    {
+        static void call(Container& c, std::size_t size)
+        {
+            c.reserve(size);
+        }
+    };
+
+    template <typename Container>
+    inline void reserve(Container& c, std::size_t size)
+    {
+        reserve_container<Container>::call(c, size);
+    }
+
+    inline void reserve(unused_type, std::size_t)
+    {
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Container, typename Enable = void>
     struct is_empty_container
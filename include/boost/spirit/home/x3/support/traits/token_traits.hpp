@@ -0,0 +1,81 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+    Copyright (c) 2001-2012 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TOKEN_TRAITS_OCTOBER_19_2026_0907AM)
+#define BOOST_SPIRIT_X3_TOKEN_TRAITS_OCTOBER_19_2026_0907AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/utility/declval.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization points used by the token parsers (x3/token) to inspect
+    // the elements of a token sequence. The defaults require the token
+    // type to provide id() and value() member functions, which is what
+    // the Spirit.Lex token types do. Specialize these for other token
+    // representations.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Token, typename Enable = void>
+    struct token_id_of
+    {
+        typedef decltype(boost::declval<Token const&>().id()) type;
+
+        static type call(Token const& t)
+        {
+            return t.id();
+        }
+    };
+
+    template <typename Token>
+    inline typename token_id_of<Token>::type
+    token_id(Token const& t)
+    {
+        return token_id_of<Token>::call(t);
+    }
+
+    template <typename Token, typename Attribute, typename Enable = void>
+    struct assign_token_value
+    {
+        static void call(Token const& t, Attribute& attr)
+        {
+            traits::move_to(t.value(), attr);
+        }
+    };
+
+    namespace detail
+    {
+        template <typename Token, typename Attribute>
+        inline void
+        token_value(Token const& t, Attribute& attr, mpl::false_)
+        {
+            assign_token_value<Token, Attribute>::call(t, attr);
+        }
+
+        template <typename Token, typename Attribute>
+        inline void
+        token_value(Token const&, Attribute&, mpl::true_) {}
+    }
+
+    template <typename Token, typename Attribute>
+    inline void
+    token_value(Token const& t, Attribute& attr)
+    {
+        detail::token_value(t, attr
+          , is_same<typename remove_const<Attribute>::type, unused_type>());
+    }
+}}}}
+
+#endif
@@ -0,0 +1,214 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_UTF8_ITERATOR_OCTOBER_19_2026_1120AM)
+#define BOOST_SPIRIT_X3_UTF8_ITERATOR_OCTOBER_19_2026_1120AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/support/utility/utf8.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        // Length of the UTF-8 sequence introduced by a lead byte. Zero marks
+        // bytes that can never start a well formed sequence: continuation
+        // bytes, the overlong leads 0xC0 and 0xC1 and everything above 0xF4.
+        template <typename Dummy = void>
+        struct utf8_sequence_length
+        {
+            static unsigned char const value[256];
+        };
+
+        template <typename Dummy>
+        unsigned char const utf8_sequence_length<Dummy>::value[256] =
+        {
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        };
+
+        // Skip a run of ASCII bytes. The input is scanned eight bytes at a
+        // time: a block is all ASCII if none of its bytes has the high bit
+        // set. Only the tail (and the block containing the first non-ASCII
+        // byte) is scanned bytewise.
+        inline utf8_char const*
+        utf8_skip_ascii(utf8_char const* first, utf8_char const* last)
+        {
+            ::boost::uint64_t const high_bits = 0x8080808080808080ULL;
+            while (last - first >= 8)
+            {
+                ::boost::uint64_t block;
+                std::memcpy(&block, first, sizeof(block));
+                if (block & high_bits)
+                    break;
+                first += 8;
+            }
+            while (first != last && !(static_cast<unsigned char>(*first) & 0x80))
+                ++first;
+            return first;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Returns a pointer to the start of the first ill-formed UTF-8 sequence
+    // in [first, last), or last if the whole input is well formed. Overlong
+    // forms, surrogates and code points above U+10FFFF are rejected.
+    ///////////////////////////////////////////////////////////////////////////
+    inline utf8_char const*
+    utf8_find_invalid(utf8_char const* first, utf8_char const* last)
+    {
+        for (;;)
+        {
+            first = detail::utf8_skip_ascii(first, last);
+            if (first == last)
+                return last;
+
+            unsigned char const lead = static_cast<unsigned char>(*first);
+            int const n = detail::utf8_sequence_length<>::value[lead];
+            if (n == 0 || last - first < n)
+                return first;
+
+            // the second byte has a narrower range for some lead bytes
+            unsigned char lo = 0x80, hi = 0xBF;
+            switch (lead)
+            {
+                case 0xE0: lo = 0xA0; break;    // overlong
+                case 0xED: hi = 0x9F; break;    // surrogates
+                case 0xF0: lo = 0x90; break;    // overlong
+                case 0xF4: hi = 0x8F; break;    // above U+10FFFF
+            }
+
+            unsigned char const second = static_cast<unsigned char>(first[1]);
+            if (second < lo || second > hi)
+                return first;
+            for (int i = 2; i < n; ++i)
+            {
+                if ((static_cast<unsigned char>(first[i]) & 0xC0) != 0x80)
+                    return first;
+            }
+            first += n;
+        }
+    }
+
+    inline bool
+    utf8_is_valid(utf8_char const* first, utf8_char const* last)
+    {
+        return utf8_find_invalid(first, last) == last;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A lightweight forward iterator presenting a contiguous UTF-8 buffer
+    // as a sequence of ucs4_char, for use with the x3 unicode parsers. It
+    // holds a single pointer and decodes on dereference; ASCII bytes cost
+    // one comparison. Unlike u8_to_u32_iterator it does not check the input,
+    // so validate it first (utf8_find_invalid). base() gives the position
+    // in the underlying buffer, e.g. for error reporting.
+    ///////////////////////////////////////////////////////////////////////////
+    class utf8_iterator
+      : public iterator_facade<
+            utf8_iterator, ucs4_char, std::forward_iterator_tag, ucs4_char>
+    {
+    public:
+
+        utf8_iterator()
+          : pos(0) {}
+
+        explicit utf8_iterator(utf8_char const* pos)
+          : pos(pos) {}
+
+        utf8_char const* base() const
+        {
+            return pos;
+        }
+
+    private:
+
+        friend class boost::iterator_core_access;
+
+        ucs4_char dereference() const
+        {
+            unsigned char const* p =
+                reinterpret_cast<unsigned char const*>(pos);
+            ucs4_char const c = p[0];
+            if (c < 0x80)
+                return c;
+
+            switch (detail::utf8_sequence_length<>::value[c])
+            {
+                case 2:
+                    return ((c & 0x1F) << 6) | (p[1] & 0x3F);
+                case 3:
+                    return ((c & 0x0F) << 12) | ((p[1] & 0x3F) << 6)
+                        | (p[2] & 0x3F);
+                case 4:
+                    return ((c & 0x07) << 18) | ((p[1] & 0x3F) << 12)
+                        | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+                default:
+                    return c;   // ill-formed, yield the byte as is
+            }
+        }
+
+        void increment()
+        {
+            unsigned char const c = static_cast<unsigned char>(*pos);
+            if (c < 0x80)
+            {
+                ++pos;
+            }
+            else
+            {
+                int const n = detail::utf8_sequence_length<>::value[c];
+                pos += n ? n : 1;
+            }
+        }
+
+        bool equal(utf8_iterator const& other) const
+        {
+            return pos == other.pos;
+        }
+
+        utf8_char const* pos;
+    };
+
+    typedef iterator_range<utf8_iterator> utf8_range;
+
+    inline utf8_range
+    make_utf8_range(utf8_char const* first, utf8_char const* last)
+    {
+        return utf8_range(utf8_iterator(first), utf8_iterator(last));
+    }
+
+    inline utf8_range
+    make_utf8_range(utf8_string const& str)
+    {
+        return make_utf8_range(str.data(), str.data() + str.size());
+    }
+}}}
+
+#endif
@@ -0,0 +1,16 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TOKEN_OCTOBER_19_2026_0940AM)
+#define BOOST_SPIRIT_X3_TOKEN_OCTOBER_19_2026_0940AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/token/token.hpp>
+
+#endif
@@ -0,0 +1,91 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+    Copyright (c) 2001-2012 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TOKEN_LEXERTL_OCTOBER_19_2026_0931AM)
+#define BOOST_SPIRIT_X3_TOKEN_LEXERTL_OCTOBER_19_2026_0931AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/support/traits/token_traits.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/token.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/position_token.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Glue between the Spirit.Lex lexertl lexers and the X3 token parsers.
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace x3
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Tokenize [first, last) in one go, appending all tokens to the given
+    // container (usually a std::vector). The X3 token parsers can then be
+    // used directly on the container's iterators. Returns true if all of
+    // the input was matched. On exit 'first' points right after the last
+    // successfully matched token.
+    //
+    // As with Spirit.Lex, the token values are converted using the Qi
+    // conversion machinery, so include the corresponding Qi headers
+    // (e.g. qi_numeric.hpp) for numeric token values.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Lexer, typename Container>
+    inline bool
+    tokenize_into(Iterator& first, Iterator last, Lexer const& lex
+      , Container& tokens
+      , typename Lexer::char_type const* initial_state = 0)
+    {
+        typedef typename Lexer::iterator_type iterator_type;
+
+        iterator_type iter = lex.begin(first, last, initial_state);
+        iterator_type end = lex.end();
+        for (/**/; iter != end && token_is_valid(*iter); ++iter)
+            tokens.push_back(*iter);
+
+        return iter == end;
+    }
+}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // lexertl tokens convert their matched input on first access and cache
+    // the converted value inside the token. Re-visiting a token while
+    // backtracking therefore does not convert again.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename AttributeTypes, typename HasState
+      , typename Idtype, typename Attribute>
+    struct assign_token_value<
+        lex::lexertl::token<Iterator, AttributeTypes, HasState, Idtype>
+      , Attribute>
+    {
+        typedef lex::lexertl::token<Iterator, AttributeTypes, HasState, Idtype>
+            token_type;
+
+        static void call(token_type const& t, Attribute& attr)
+        {
+            spirit::traits::assign_to(t, attr);
+        }
+    };
+
+    template <typename Iterator, typename AttributeTypes, typename HasState
+      , typename Idtype, typename Attribute>
+    struct assign_token_value<
+        lex::lexertl::position_token<Iterator, AttributeTypes, HasState, Idtype>
+      , Attribute>
+    {
+        typedef lex::lexertl::position_token<
+            Iterator, AttributeTypes, HasState, Idtype>
+        token_type;
+
+        static void call(token_type const& t, Attribute& attr)
+        {
+            spirit::traits::assign_to(t, attr);
+        }
+    };
+}}}}
+
+#endif
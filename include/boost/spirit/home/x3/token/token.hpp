@@ -0,0 +1,144 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+    Copyright (c) 2001-2012 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TOKEN_OCTOBER_19_2026_0912AM)
+#define BOOST_SPIRIT_X3_TOKEN_OCTOBER_19_2026_0912AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/core/skip_over.hpp>
+#include <boost/spirit/home/x3/support/traits/token_traits.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <iterator>
+#include <string>
+
+namespace boost { namespace spirit { namespace x3
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // token parsers work on a sequence of tokens instead of characters,
+    // typically the contiguous token vector produced by a lexer (see
+    // x3/token/lexertl.hpp). Since the input is already tokenized,
+    // backtracking only revisits tokens, not characters.
+    //
+    //  token(id)       matches a token with the given id, no attribute
+    //  token<T>(id)    matches a token with the given id, the token value
+    //                  converted to T is the attribute
+    //  token(min, max) matches a token with an id in [min, max]
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ID, typename Attribute = unused_type>
+    struct token_parser : parser<token_parser<ID, Attribute>>
+    {
+        typedef Attribute attribute_type;
+        static bool const has_attribute =
+            !is_same<Attribute, unused_type>::value;
+
+        token_parser(ID const& id)
+          : id(id) {}
+
+        template <typename Iterator, typename Context, typename Attribute_>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute_& attr) const
+        {
+            x3::skip_over(first, last, context);
+
+            if (first != last)
+            {
+                typedef typename traits::token_id_of<
+                    typename std::iterator_traits<Iterator>::value_type>::type
+                id_type;
+
+                if (traits::token_id(*first) == static_cast<id_type>(id))
+                {
+                    traits::token_value(*first, attr);
+                    ++first;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        ID id;
+    };
+
+    template <typename ID, typename Attribute = unused_type>
+    struct token_range_parser : parser<token_range_parser<ID, Attribute>>
+    {
+        typedef Attribute attribute_type;
+        static bool const has_attribute =
+            !is_same<Attribute, unused_type>::value;
+
+        token_range_parser(ID const& min, ID const& max)
+          : min(min), max(max) {}
+
+        template <typename Iterator, typename Context, typename Attribute_>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute_& attr) const
+        {
+            x3::skip_over(first, last, context);
+
+            if (first != last)
+            {
+                typedef typename traits::token_id_of<
+                    typename std::iterator_traits<Iterator>::value_type>::type
+                id_type;
+
+                id_type const id = traits::token_id(*first);
+                if (static_cast<id_type>(min) <= id
+                    && id <= static_cast<id_type>(max))
+                {
+                    traits::token_value(*first, attr);
+                    ++first;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        ID min, max;
+    };
+
+    template <typename Attribute = unused_type, typename ID>
+    inline token_parser<ID, Attribute>
+    token(ID const& id)
+    {
+        return token_parser<ID, Attribute>(id);
+    }
+
+    template <typename Attribute = unused_type, typename ID>
+    inline token_range_parser<ID, Attribute>
+    token(ID const& min, ID const& max)
+    {
+        return token_range_parser<ID, Attribute>(min, max);
+    }
+
+    template <typename ID, typename Attribute>
+    struct get_info<token_parser<ID, Attribute>>
+    {
+        typedef std::string result_type;
+        std::string operator()(token_parser<ID, Attribute> const& p) const
+        {
+            return "token(" + std::to_string(static_cast<long long>(p.id)) + ")";
+        }
+    };
+
+    template <typename ID, typename Attribute>
+    struct get_info<token_range_parser<ID, Attribute>>
+    {
+        typedef std::string result_type;
+        std::string operator()(token_range_parser<ID, Attribute> const& p) const
+        {
+            return "token("
+                + std::to_string(static_cast<long long>(p.min)) + ", "
+                + std::to_string(static_cast<long long>(p.max)) + ")";
+        }
+    };
+}}}
+
+#endif
@@ -59,16 +59,16 @@ namespace boost { namespace spirit { namespace repository { namespace qi { names
                         , Context& context, Skipper const& skipper
                         , Index& idx ) const
                 {
-                    Iterator save = first;
+                    // the flags are packed in a bitset, the kwd directive
+                    // updates a plain bool which is stored back afterwards
+                    bool flag = flags[Index::value];
                     skipper_keyword_marker<Skipper,NoCasePass>
-                        marked_skipper(skipper,flags[Index::value],counters[Index::value]);
+                        marked_skipper(skipper,flag,counters[Index::value]);
 
-                    if(subject.parse(first,last,context,marked_skipper,unused))
-                    {
-                        return true;
-                    }
-                    save = save;
-                    return false;
+                    bool const result =
+                        subject.parse(first,last,context,marked_skipper,unused);
+                    flags.set(Index::value, flag);
+                    return result;
                 }
 
 
@@ -79,15 +79,13 @@ namespace boost { namespace spirit { namespace repository { namespace qi { names
                         , Index& idx ) const
                 {
 
-                    Iterator save = first;
+                    bool flag = flags[Index::value];
                     skipper_keyword_marker<Skipper,NoCasePass> 
-                        marked_skipper(skipper,flags[Index::value],counters[Index::value]);
-                    if(subject.parse(first,last,context,marked_skipper,fusion::at_c<Index::value>(attr)))
-                    {
-                        return true;
-                    }
-                    save = save;
-                    return false;
+                        marked_skipper(skipper,flag,counters[Index::value]);
+                    bool const result =
+                        subject.parse(first,last,context,marked_skipper,fusion::at_c<Index::value>(attr));
+                    flags.set(Index::value, flag);
+                    return result;
                 }
 
             // Handle unused attributes
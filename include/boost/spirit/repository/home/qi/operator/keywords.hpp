@@ -44,6 +44,7 @@
 #include <boost/type_traits/is_same.hpp>
 #include <boost/spirit/repository/home/qi/operator/detail/keywords.hpp>
 #include <boost/fusion/include/any.hpp>
+#include <bitset>
 
 
 namespace boost { namespace spirit
@@ -184,10 +185,11 @@ namespace boost { namespace spirit { namespace repository { namespace qi
                 detail::complex_keywords< complex_keywords_indexes >
                 >::type complex_keywords_type;
 
-        // build a bool array and an integer array which will be used to
+        // build a bitset and an integer array which will be used to
         // check that the repetition constraints of the kwd parsers are
-        // met and bail out a soon as possible
-        typedef boost::array<bool, fusion::result_of::size<Elements>::value> flags_type;
+        // met and bail out a soon as possible. The bitset is cheap to
+        // initialise for every parse and checked in one go at the end.
+        typedef std::bitset<fusion::result_of::size<Elements>::value> flags_type;
         typedef boost::array<int, fusion::result_of::size<Elements>::value> counters_type;
 
         typedef typename mpl::if_<
@@ -252,10 +254,10 @@ namespace boost { namespace spirit { namespace repository { namespace qi
             complex_kwd_function_type
                      complex_function(first,last,context,skipper,parse_visitor);
 
-            // We have a bool array 'flags' with one flag for each parser as well as a 'counter'
+            // We have a bitset 'flags' with one flag for each parser as well as a 'counter'
             // array.
             // The kwd directive sets and increments the counter when a successeful parse occured
-            // as well as the slot of the corresponding parser to true in the flags array as soon
+            // as well as the bit of the corresponding parser to true in the flags bitset as soon
             // the minimum repetition requirement is met and keeps that value to true as long as
             // the maximum repetition requirement is met.
             // The parsing takes place here in two steps:
@@ -278,14 +280,7 @@ namespace boost { namespace spirit { namespace repository { namespace qi
                   {
                     first = save;
                     // Check that we are leaving the keywords parser in a successfull state
-                    BOOST_FOREACH(bool &valid,flags)
-                    {
-                      if(!valid)
-                      {
-                        return false;
-                      }
-                    }
-                    return true;
+                    return flags.count() == flags.size();
                   }
                   else
                     save = first;
@@ -333,10 +328,10 @@ namespace boost { namespace spirit { namespace repository { namespace qi
                      complex_function(first,last,context,skipper,parse_visitor);
 
 
-            // We have a bool array 'flags' with one flag for each parser as well as a 'counter'
+            // We have a bitset 'flags' with one flag for each parser as well as a 'counter'
             // array.
             // The kwd directive sets and increments the counter when a successeful parse occured
-            // as well as the slot of the corresponding parser to true in the flags array as soon
+            // as well as the bit of the corresponding parser to true in the flags bitset as soon
             // the minimum repetition requirement is met and keeps that value to true as long as
             // the maximum repetition requirement is met.
             // The parsing takes place here in two steps:
@@ -359,14 +354,7 @@ namespace boost { namespace spirit { namespace repository { namespace qi
                   {
                     first = save;
                     // Check that we are leaving the keywords parser in a successfull state
-                    BOOST_FOREACH(bool &valid,flags)
-                    {
-                      if(!valid)
-                      {
-                        return false;
-                      }
-                    }
-                    return true;
+                    return flags.count() == flags.size();
                   }
                   else
                   {
@@ -246,6 +246,17 @@ main()
         BOOST_TEST( boost::fusion::at_c<2>(data) == 2);
     }
 
+    { // keywords which are prefixes of other keywords (longest match)
+        boost::fusion::vector<int,int,int> data;
+        BOOST_TEST( test_attr("abc=3 a=1 ab=2", kwd("a")['=' > int_] / kwd("ab")['=' > int_] / kwd("abc")['=' > int_], data, space));
+        BOOST_TEST( boost::fusion::at_c<0>(data) == 1);
+        BOOST_TEST( boost::fusion::at_c<1>(data) == 2);
+        BOOST_TEST( boost::fusion::at_c<2>(data) == 3);
+
+        BOOST_TEST( test("AB=2 abc=3 A=1", ikwd("a")['=' > int_] / ikwd("ab")['=' > int_] / kwd("abc")['=' > int_], space));
+        BOOST_TEST( !test("ab=2 abx=3", kwd("a")['=' > int_] / kwd("ab")['=' > int_] / kwd("abc")['=' > int_], space));
+    }
+
     // dkwd and idkwd
     {
       BOOST_TEST( test("a =a", dkwd("a")[ '=' > char_] , space));
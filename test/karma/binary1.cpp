@@ -26,7 +26,7 @@ main()
     using namespace boost::phoenix;
 
     {   // test native endian binaries
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
         BOOST_TEST(binary_test("\x01", 1, byte_, 0x01));
         BOOST_TEST(binary_test("\x80", 1, byte_, 0x80));
         BOOST_TEST(binary_test("\x01\x82", 2, word, 0x8201));
@@ -55,7 +55,7 @@ main()
         BOOST_TEST(binary_test_delimited("\x00\x00\x00\x00\x00\x00\xf0\x3f", 8,
             bin_double, 1.0, pad(8)));
 
-#else // BOOST_LITTLE_ENDIAN
+#else // BOOST_ENDIAN_LITTLE_BYTE
 
         BOOST_TEST(binary_test("\x01", 1, byte_, 0x01));
         BOOST_TEST(binary_test("\x80", 1, byte_, 0x80));
@@ -88,7 +88,7 @@ main()
     }
 
     {   // test native endian binaries
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
         BOOST_TEST(binary_test("\x01", 1, byte_(0x01)));
         BOOST_TEST(binary_test("\x01\x02", 2, word(0x0201)));
         BOOST_TEST(binary_test("\x01\x02\x03\x04", 4, dword(0x04030201)));
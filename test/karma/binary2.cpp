@@ -104,7 +104,7 @@ main()
         boost::optional<float> vf;
         boost::optional<double> vd;
 
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
 
         BOOST_TEST(!binary_test("", 1, byte_, v8));
         BOOST_TEST(!binary_test("", 2, word, v16));
@@ -116,7 +116,7 @@ main()
         BOOST_TEST(!binary_test("", 4, bin_float, vf));
         BOOST_TEST(!binary_test("", 8, bin_double, vd));
 
-#else // BOOST_LITTLE_ENDIAN
+#else // BOOST_ENDIAN_LITTLE_BYTE
 
         BOOST_TEST(!binary_test("", 1, byte_, v8));
         BOOST_TEST(!binary_test("", 2, word, v16));
@@ -0,0 +1,214 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/hash_rules.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+//  the saved tables, in memory aligned to 8 bytes
+struct buffer
+{
+    explicit buffer(std::string const& data)
+      : size(data.size()), words((data.size() + 7) / 8 + 1, 0)
+    {
+        std::memcpy(&words.front(), data.data(), data.size());
+    }
+
+    void const* data() const { return &words.front(); }
+
+    std::size_t size;
+    std::vector<boost::uint64_t> words;
+};
+
+std::string save(lexertl::packed_state_machine<char> const& sm
+  , boost::uint64_t hash)
+{
+    std::ostringstream os(std::ios::out | std::ios::binary);
+    BOOST_TEST(sm.save(os, hash));
+    return os.str();
+}
+
+// both state machines must find the very same tokens
+bool compare(lexertl::packed_state_machine<char> const& sm1
+  , lexertl::packed_state_machine<char> const& sm2, std::string const& input)
+{
+    typedef std::string::const_iterator iterator_type;
+    typedef lexertl::basic_iterator_tokeniser<iterator_type> tokenizer;
+
+    std::size_t state1 = 0, state2 = 0;
+    bool bol1 = true, bol2 = true;
+    iterator_type first1 = input.begin(), first2 = input.begin();
+
+    for (;;)
+    {
+        std::size_t uid1 = 0, uid2 = 0;
+        std::size_t const id1 =
+            tokenizer::next(sm1, state1, bol1, first1, input.end(), uid1);
+        std::size_t const id2 =
+            tokenizer::next(sm2, state2, bol2, first2, input.end(), uid2);
+
+        if (id1 != id2 || uid1 != uid2 || state1 != state2 || first1 != first2)
+            return false;
+        if (id1 == 0 || id1 == boost::lexer::npos)
+            break;
+    }
+    return first1 == input.end();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    explicit tokens(char const* number = "[0-9]+")
+    {
+        this->self.add
+            ("[a-z]+", 1)
+            (number, 2)
+            ("[ \\t\\n]+", 3)
+        ;
+    }
+};
+
+template <typename Lexer>
+std::size_t count(Lexer& lexer, std::string const& input)
+{
+    std::string::const_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+
+    std::size_t n = 0;
+    for (/**/; it != end && token_is_valid(*it); ++it)
+        ++n;
+    return (it == end) ? n : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    boost::lexer::rules rules;
+    rules.add_state("COMMENT");
+    rules.add("INITIAL", "[a-z]+", 1, ".");
+    rules.add("INITIAL", "[0-9]+", 2, ".");
+    rules.add("INITIAL", "^#[a-z]+", 3, ".");
+    rules.add("INITIAL", ";$", 4, ".");
+    rules.add("INITIAL", "[ \\t\\n]+", 5, ".");
+    rules.add("INITIAL", "[/][*]", 8, "COMMENT");
+    rules.add("COMMENT", "[^*]+|\\*", 6, ".");
+    rules.add("COMMENT", "[*][/]", 7, "INITIAL");
+
+    std::string const input =
+        "#define abc 123;\n#not bol;\nabc /* comment * */ 42;\n";
+
+    boost::lexer::state_machine sm;
+    boost::lexer::generator::build(rules, sm);
+    lexertl::packed_state_machine<char> packed(sm);
+
+    boost::uint64_t const hash = lexertl::hash_rules(rules);
+
+    {   // save and load again
+        buffer const saved(save(packed, hash));
+
+        lexertl::packed_state_machine<char> loaded;
+        BOOST_TEST(loaded.load(saved.data(), saved.size, hash));
+        BOOST_TEST(loaded.size() == 2);
+        BOOST_TEST(loaded.seen_bol_assertion());
+        BOOST_TEST(loaded[0].has_assertions());
+        BOOST_TEST(compare(packed, loaded, input));
+
+        // copies refer to the very same memory
+        lexertl::packed_state_machine<char> copy(loaded);
+        BOOST_TEST(compare(packed, copy, input));
+
+        // saving the loaded tables results in the same data
+        BOOST_TEST(save(loaded, hash) == save(packed, hash));
+    }
+
+    {   // copies of packed tables own their tables
+        lexertl::packed_state_machine<char>* original =
+            new lexertl::packed_state_machine<char>(sm);
+        lexertl::packed_state_machine<char> copy(*original);
+        delete original;
+        BOOST_TEST(compare(packed, copy, input));
+    }
+
+    {   // data which can't be used
+        std::string const data = save(packed, hash);
+        lexertl::packed_state_machine<char> loaded;
+
+        buffer const saved(data);
+        BOOST_TEST(!loaded.load(saved.data(), saved.size, hash + 1));
+        BOOST_TEST(loaded.empty());
+        BOOST_TEST(!loaded.load(saved.data(), saved.size - 8, hash));
+        BOOST_TEST(!loaded.load(saved.data(), 40, hash));
+
+        // misaligned
+        std::vector<boost::uint64_t> words(saved.words.size() + 1, 0);
+        char* misaligned = reinterpret_cast<char*>(&words.front()) + 4;
+        std::memcpy(misaligned, data.data(), data.size());
+        BOOST_TEST(!loaded.load(misaligned, data.size(), hash));
+
+        // out of range states in the last transitions (the last word holds
+        // at least one of those besides the padding)
+        buffer corrupt(data);
+        std::memset(reinterpret_cast<char*>(&corrupt.words.front())
+          + data.size() - 8, 0xff, 8);
+        BOOST_TEST(!loaded.load(corrupt.data(), corrupt.size, hash));
+
+        // another version of the binary format
+        buffer version(data);
+        reinterpret_cast<char*>(&version.words.front())[8] += 1;
+        BOOST_TEST(!loaded.load(version.data(), version.size, hash));
+        BOOST_TEST(loaded.empty());
+    }
+
+    {   // the hash depends on all of the rules
+        boost::lexer::rules other;
+        other.add_state("COMMENT");
+        other.add("INITIAL", "[a-z]+", 1, ".");
+        BOOST_TEST(lexertl::hash_rules(other) != hash);
+
+        boost::lexer::rules same;
+        same.add_state("COMMENT");
+        same.add("INITIAL", "[a-z]+", 1, ".");
+        BOOST_TEST(lexertl::hash_rules(other) == lexertl::hash_rules(same));
+
+        same.add("INITIAL", "[a-z]+", 2, ".");
+        other.add("INITIAL", "[a-z]+", 3, ".");
+        BOOST_TEST(lexertl::hash_rules(other) != lexertl::hash_rules(same));
+    }
+
+    {   // the lexer falls back to building the DFA
+        typedef lexertl::lexer<
+            lexertl::token<std::string::const_iterator> > lexer_type;
+        std::string const text = "abc 42\nxyz 7 ";
+
+        tokens<lexer_type> lexer1;
+        std::ostringstream os(std::ios::out | std::ios::binary);
+        BOOST_TEST(lexer1.save_dfa(os));
+        buffer const saved(os.str());
+
+        tokens<lexer_type> lexer2;
+        BOOST_TEST(lexer2.load_dfa(saved.data(), saved.size));
+        BOOST_TEST(count(lexer2, text) == 8);
+
+        tokens<lexer_type> lexer3("[0-9]+|0x[0-9a-f]+");
+        BOOST_TEST(!lexer3.load_dfa(saved.data(), saved.size));
+        BOOST_TEST(count(lexer3, text + "0x1f") == 9);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,196 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+//  numbers and the comments look ahead of the tokens they match, the
+//  preprocessor lines need the BOL flag
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        this->self.add
+            ("[a-z]+")
+            ("[0-9]+([.][0-9]+([eE][-+]?[0-9]+)?)?")
+            ("\\\"[^\"\\n]*\\\"")
+            ("^#[a-z]+")
+            ("[ \\t\\n]+")
+            ("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]")
+            ("[-+*/.#]")
+        ;
+        this->self("INITIAL", "BLOCK").add("[{]");
+        this->self("BLOCK").add("[a-z]+")("[ \\n]+")("[;]");
+        this->self("BLOCK", "INITIAL").add("[}]");
+    }
+};
+
+typedef std::string::const_iterator base_iterator_type;
+typedef lexertl::token<base_iterator_type> token_type;
+typedef lexertl::lexer<token_type> lexer_type;
+
+bool equal(lexertl::compact_token const& lhs, lexertl::compact_token const& rhs)
+{
+    return lhs.id == rhs.id && lhs.state == rhs.state &&
+        lhs.offset == rhs.offset && lhs.length == rhs.length;
+}
+
+bool equal(std::vector<lexertl::compact_token> const& lhs
+  , std::vector<lexertl::compact_token> const& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+    for (std::size_t i = 0; i != lhs.size(); ++i)
+    {
+        if (!equal(lhs[i], rhs[i]))
+            return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  edit the text, update the tokens and compare them to the tokens of the
+//  whole edited text
+bool edit(tokens<lexer_type> const& lexer, std::string& text
+  , lexertl::incremental_tokens& tokens, std::size_t offset
+  , std::size_t erased, std::string const& inserted)
+{
+    std::vector<lexertl::compact_token> const before = tokens.tokens();
+    text.replace(offset, erased, inserted);
+
+    lexertl::changed_tokens const changed = lexer.retokenize(text.begin()
+      , text.end(), tokens, offset, erased, inserted.size());
+
+    std::vector<lexertl::compact_token> expected;
+    bool const complete = lexer.tokenize(text.begin(), text.end(), expected);
+    if (!equal(tokens.tokens(), expected) || changed.complete != complete)
+        return false;
+
+    //  all tokens but the changed ones are the same as before
+    std::vector<lexertl::compact_token> const& after = tokens.tokens();
+    if (changed.first + changed.erased > before.size() ||
+        changed.first + changed.inserted > after.size() ||
+        before.size() - changed.erased != after.size() - changed.inserted)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i != changed.first; ++i)
+    {
+        if (!equal(before[i], after[i]))
+            return false;
+    }
+    for (std::size_t i = changed.first + changed.erased, j =
+            changed.first + changed.inserted; i != before.size(); ++i, ++j)
+    {
+        lexertl::compact_token moved = before[i];
+        moved.offset = moved.offset + inserted.size() - erased;
+        if (!equal(moved, after[j]))
+            return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    tokens<lexer_type> lexer;
+
+    {   // a single character inserted into an identifier
+        std::string text = "abc 12 de\n#if x";
+        lexertl::incremental_tokens tokens;
+        BOOST_TEST(lexer.tokenize(text.begin(), text.end(), tokens));
+        BOOST_TEST(tokens.size() == 9);
+
+        text.insert(8, 1, 'x');
+        lexertl::changed_tokens changed = lexer.retokenize(text.begin()
+          , text.end(), tokens, 8, 0, 1);
+        BOOST_TEST(changed.complete);
+        BOOST_TEST(changed.first == 4);
+        BOOST_TEST(changed.erased == 1 && changed.inserted == 1);
+        BOOST_TEST(tokens.tokens()[4].length == 3);
+        BOOST_TEST(tokens.tokens()[8].offset == 15);
+    }
+
+    {   // tokens looking ahead are matched again: "1.2" becomes "1." "x"
+        std::string text = "a 1.2 b";
+        lexertl::incremental_tokens tokens;
+        BOOST_TEST(lexer.tokenize(text.begin(), text.end(), tokens));
+        BOOST_TEST(edit(lexer, text, tokens, 4, 1, "x"));
+        BOOST_TEST(tokens.size() == 7);
+        BOOST_TEST(edit(lexer, text, tokens, 4, 1, "5e"));
+        BOOST_TEST(tokens.size() == 6);
+        BOOST_TEST(edit(lexer, text, tokens, 6, 0, "7"));
+        BOOST_TEST(tokens.size() == 5);
+    }
+
+    {   // opening and closing a comment
+        std::string text = "a / b + c * d / e";
+        lexertl::incremental_tokens tokens;
+        BOOST_TEST(lexer.tokenize(text.begin(), text.end(), tokens));
+        BOOST_TEST(edit(lexer, text, tokens, 3, 0, "*"));
+        BOOST_TEST(edit(lexer, text, tokens, 15, 0, "*"));
+        BOOST_TEST(tokens.size() == 5);
+        BOOST_TEST(edit(lexer, text, tokens, 11, 1, ""));
+        BOOST_TEST(edit(lexer, text, tokens, 3, 1, ""));
+    }
+
+    {   // lexer states, BOL assertions and errors
+        std::string text = "a { b; c }\n#if d";
+        lexertl::incremental_tokens tokens;
+        BOOST_TEST(lexer.tokenize(text.begin(), text.end(), tokens));
+        BOOST_TEST(edit(lexer, text, tokens, 9, 1, ""));
+        BOOST_TEST(edit(lexer, text, tokens, 3, 0, "\n"));
+        BOOST_TEST(edit(lexer, text, tokens, 10, 0, "\n"));
+        BOOST_TEST(edit(lexer, text, tokens, 2, 1, "("));
+        BOOST_TEST(edit(lexer, text, tokens, 2, 1, "{"));
+        BOOST_TEST(edit(lexer, text, tokens, 0, text.size(), ""));
+        BOOST_TEST(tokens.size() == 0);
+        BOOST_TEST(edit(lexer, text, tokens, 0, 0, "\"x\" {y}"));
+    }
+
+    {   // random edits
+        char const* const pieces[] = {
+            "a", "bc", " ", "\n", "1", ".", "5", "e", "-", "/", "*", "{", "}"
+          , ";", "#", "\"", "x y", "/* z */", "1.5e+3"
+        };
+        std::size_t const count = sizeof(pieces)/sizeof(pieces[0]);
+
+        std::string text;
+        for (std::size_t i = 0; i != 200; ++i)
+            text += pieces[(i * 7) % 5 == 0 ? count - 1 : i % 4 == 0 ? 2 : 0];
+
+        lexertl::incremental_tokens tokens;
+        lexer.tokenize(text.begin(), text.end(), tokens);
+
+        unsigned int seed = 42;
+        for (std::size_t i = 0; i != 2000; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            std::size_t const offset = (seed >> 8) % (text.size() + 1);
+            seed = seed * 1103515245u + 12345u;
+            std::size_t const erased = (std::min)(std::size_t((seed >> 8) % 3)
+              , text.size() - offset);
+            seed = seed * 1103515245u + 12345u;
+            std::string const inserted = ((seed >> 8) % 4 == 0) ?
+                std::string() : pieces[(seed >> 12) % count];
+
+            if (!edit(lexer, text, tokens, offset, erased, inserted))
+            {
+                BOOST_TEST(false);
+                break;
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,167 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_stl.hpp>
+
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+namespace phoenix = boost::phoenix;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        identifier = "[a-z]+";
+        number = "[0-9]+";
+        white_space = "[ \\t\\n]+";
+
+        this->self = identifier | number | white_space | ',';
+    }
+
+    lex::token_def<std::string> identifier;
+    lex::token_def<unsigned int> number;
+    lex::token_def<lex::omit> white_space;
+};
+
+typedef std::string::const_iterator base_iterator_type;
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using qi::_1;
+
+    typedef lexertl::token<base_iterator_type
+      , boost::mpl::vector<std::string, unsigned int> > token_type;
+    typedef lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type>::lazy_token_iterator_type iterator_type;
+    typedef tokens<lexer_type>::token_value_cache_type cache_type;
+
+    tokens<lexer_type> lexer;
+
+    {   // the side table of converted values
+        std::vector<lexertl::compact_token> tokens(10);
+        cache_type values(tokens);
+
+        values.insert(5, 5u);
+        values.insert(2, std::string("two"));
+        values.insert(9, 9u);
+        values.insert(0, 0u);
+        BOOST_TEST(values.size() == 4);
+
+        BOOST_TEST(values.find(2) && boost::get<std::string>(*values.find(2)) == "two");
+        BOOST_TEST(values.find(9) && boost::get<unsigned int>(*values.find(9)) == 9);
+        BOOST_TEST(values.find(0) && boost::get<unsigned int>(*values.find(0)) == 0);
+        BOOST_TEST(!values.find(1) && !values.find(3) && !values.find(10));
+
+        // a full cache drops the older half of its values
+        cache_type bounded(tokens, 4);
+        for (std::size_t i = 0; i != 6; ++i)
+            bounded.insert(i, i);
+        BOOST_TEST(bounded.size() == 4);
+        BOOST_TEST(!bounded.find(0) && !bounded.find(1));
+        BOOST_TEST(bounded.find(2) && bounded.find(5));
+    }
+
+    {   // parse the lazy tokens, converting the values that are used
+        std::string const input = "abc 12, de 30 ,fgh 100";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), tokens));
+
+        cache_type values(tokens, 0);
+        iterator_type first(input.begin(), tokens.begin(), values);
+        iterator_type last(input.begin(), tokens.end(), values);
+        BOOST_TEST(last - first == 13);
+        BOOST_TEST((*(first + 2)).id() == lexer.number.id());
+        BOOST_TEST((*(first + 2)).index() == 2);
+
+        std::vector<std::string> identifiers;
+        unsigned int sum = 0;
+        BOOST_TEST(qi::phrase_parse(first, last
+          , *(lexer.identifier[phoenix::push_back(phoenix::ref(identifiers), _1)]
+             >> lexer.number[phoenix::ref(sum) += _1] >> -qi::token(','))
+          , lexer.white_space) && first == last);
+
+        BOOST_TEST(identifiers.size() == 3 && identifiers[2] == "fgh");
+        BOOST_TEST(sum == 142);
+
+        // only the identifiers and numbers have been converted
+        BOOST_TEST(values.size() == 6);
+        BOOST_TEST(values.find(0) && !values.find(1) && values.find(2));
+        BOOST_TEST(!values.find(3));
+    }
+
+    {   // the values are converted once, even when backtracking
+        std::string const input = "abc 12";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), tokens));
+
+        cache_type values(tokens);
+        iterator_type first(input.begin(), tokens.begin(), values);
+        iterator_type last(input.begin(), tokens.end(), values);
+
+        std::string s;
+        BOOST_TEST(qi::phrase_parse(first, last
+          , (lexer.identifier >> lexer.identifier) | lexer.identifier
+          , lexer.white_space, s));
+        BOOST_TEST(s == "abc" && values.size() == 1);
+        BOOST_TEST(first.compact_position() == tokens.begin() + 2);
+
+        // the next access uses the cached value
+        *values.find(0) = std::string("xyz");
+
+        s.clear();
+        first = iterator_type(input.begin(), tokens.begin(), values);
+        BOOST_TEST(qi::phrase_parse(first, last, lexer.identifier
+          , lexer.white_space, s));
+        BOOST_TEST(s == "xyz" && values.size() == 1);
+
+        // the matched characters are still available, but not cached
+        boost::iterator_range<base_iterator_type> r;
+        first = iterator_type(input.begin(), tokens.begin(), values);
+        BOOST_TEST(qi::parse(first, last, qi::token(lexer.identifier.id()), r));
+        BOOST_TEST(std::string(r.begin(), r.end()) == "abc");
+        BOOST_TEST(values.size() == 1);
+    }
+
+    {   // tokens without token value types never use the cache
+        typedef lexertl::token<base_iterator_type> plain_token_type;
+        typedef lexertl::lexer<plain_token_type> plain_lexer_type;
+        typedef tokens<plain_lexer_type> plain_tokens_type;
+
+        plain_tokens_type plain_lexer;
+        std::string const input = "abc 12";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(plain_lexer.tokenize(input.begin(), input.end(), tokens));
+
+        plain_tokens_type::token_value_cache_type values(tokens);
+        plain_tokens_type::lazy_token_iterator_type
+            first(input.begin(), tokens.begin(), values)
+          , last(input.begin(), tokens.end(), values);
+
+        std::string s;
+        unsigned int n = 0;
+        BOOST_TEST(qi::phrase_parse(first, last
+          , plain_lexer.identifier[phoenix::ref(s) = _1]
+            >> plain_lexer.number[phoenix::ref(n) = _1]
+          , plain_lexer.white_space));
+        BOOST_TEST(s == "abc" && n == 12 && values.size() == 0);
+    }
+
+    return boost::report_errors();
+}
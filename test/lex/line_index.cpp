@@ -0,0 +1,101 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_lexertl_position_token.hpp>
+#include <boost/spirit/include/support_line_pos_iterator.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        this->self.add
+            ("[a-z]+")
+            ("[0-9]+")
+            ("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]")
+            ("[ \\t]+")
+            ("\\n")
+        ;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::string input;
+    for (int i = 0; i != 200; ++i)
+    {
+        input += "abc 12 /* a\nlong comment */ de\n\n";
+        input += (i % 3) ? "\tx" : "y 1234567890 abcdefghijklmnopqrstuvwxyz\n";
+    }
+
+    {   // lines and columns of single positions
+        lexertl::line_index lines(input.begin(), input.end());
+        BOOST_TEST(lines.size() == 1 + 4 * 200 - 200 * 2 / 3);
+
+        BOOST_TEST(lines.line(0) == 1 && lines.column(0) == 1);
+        BOOST_TEST(lines.line(4) == 1 && lines.column(4) == 5);
+        BOOST_TEST(lines.line(11) == 1 && lines.column(11) == 12);  // '\n'
+        BOOST_TEST(lines.line(12) == 2 && lines.column(12) == 1);
+        BOOST_TEST(lines.line_start(3) == 31);
+        BOOST_TEST(lines.line(input.size()) == lines.size());
+
+        //  the same without searching contiguous characters
+        std::list<char> list(input.begin(), input.end());
+        lexertl::line_index list_lines(list.begin(), list.end());
+        BOOST_TEST(list_lines.newlines() == lines.newlines());
+
+        lexertl::line_index empty(input.begin(), input.begin());
+        BOOST_TEST(empty.size() == 1 && empty.line(0) == 1);
+    }
+
+    {   // the lines of the tokens are the ones of the line_pos_iterator
+        typedef boost::spirit::line_pos_iterator<std::string::const_iterator>
+            pos_iterator_type;
+        typedef lexertl::position_token<pos_iterator_type> position_token_type;
+
+        tokens<lexertl::lexer<position_token_type> > pos_lexer;
+        pos_iterator_type first(input.begin());
+        pos_iterator_type const last(input.end());
+
+        std::vector<std::size_t> expected;
+        typedef tokens<lexertl::lexer<position_token_type> >::iterator_type
+            iterator_type;
+        iterator_type end = pos_lexer.end();
+        for (iterator_type it = pos_lexer.begin(first, last);
+             it != end && token_is_valid(*it); ++it)
+        {
+            expected.push_back(boost::spirit::get_line(it->matched().begin()));
+        }
+
+        typedef lexertl::token<std::string::const_iterator> token_type;
+        tokens<lexertl::lexer<token_type> > lexer;
+        std::vector<lexertl::compact_token> compact;
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), compact));
+
+        lexertl::line_index lines(input.begin(), input.end());
+        std::vector<boost::uint32_t> token_lines;
+        lines.lines(compact, token_lines);
+
+        BOOST_TEST(token_lines.size() == expected.size());
+        BOOST_TEST(std::equal(expected.begin(), expected.end()
+          , token_lines.begin()));
+
+        for (std::size_t i = 0; i < compact.size(); i += 7)
+            BOOST_TEST(lines.line(compact[i].offset) == token_lines[i]);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+//  tokenize the input with the tables of lexertl and with the packed tables,
+//  both must find the very same tokens
+template <typename Char>
+bool compare(boost::lexer::basic_rules<Char> const& rules
+  , std::basic_string<Char> const& input, std::size_t& tokens)
+{
+    typedef typename std::basic_string<Char>::const_iterator iterator_type;
+    typedef lexertl::basic_iterator_tokeniser<iterator_type> tokenizer;
+
+    boost::lexer::basic_state_machine<Char> sm;
+    boost::lexer::basic_generator<Char>::build(rules, sm);
+    lexertl::packed_state_machine<Char> packed(sm);
+
+    bool const bol = sm.data()._seen_BOL_assertion;
+    BOOST_TEST(packed.seen_bol_assertion() == bol);
+
+    std::size_t state1 = 0, state2 = 0;
+    bool bol1 = bol, bol2 = bol;
+    iterator_type first1 = input.begin(), first2 = input.begin();
+    iterator_type const last = input.end();
+
+    tokens = 0;
+    for (;;)
+    {
+        std::size_t uid1 = 0, uid2 = 0;
+        std::size_t const id1 =
+            tokenizer::next(sm, state1, bol1, first1, last, uid1);
+        std::size_t const id2 =
+            tokenizer::next(packed, state2, bol2, first2, last, uid2);
+
+        if (id1 != id2 || uid1 != uid2 || state1 != state2 || bol1 != bol2
+            || first1 != first2)
+        {
+            return false;
+        }
+        if (id1 == 0 || id1 == boost::lexer::npos)
+            break;
+
+        ++tokens;
+    }
+
+    // the same without lexer states
+    bol1 = bol2 = bol;
+    first1 = first2 = input.begin();
+    for (;;)
+    {
+        std::size_t uid1 = 0, uid2 = 0;
+        std::size_t const id1 = tokenizer::next(sm, bol1, first1, last, uid1);
+        std::size_t const id2 =
+            tokenizer::next(packed, bol2, first2, last, uid2);
+
+        if (id1 != id2 || uid1 != uid2 || bol1 != bol2 || first1 != first2)
+            return false;
+
+        if (id1 == 0 || id1 == boost::lexer::npos)
+            break;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    {   // lexer states, BOL and EOL assertions
+        boost::lexer::rules rules;
+        rules.add_state("COMMENT");
+        rules.add("INITIAL", "[a-z]+", 1, ".");
+        rules.add("INITIAL", "[0-9]+", 2, ".");
+        rules.add("INITIAL", "^#[a-z]+", 3, ".");
+        rules.add("INITIAL", ";$", 4, ".");
+        rules.add("INITIAL", "[ \\t\\n]+", 5, ".");
+        rules.add("INITIAL", "[/][*]", 8, "COMMENT");
+        rules.add("COMMENT", "[^*]+|\\*", 6, ".");
+        rules.add("COMMENT", "[*][/]", 7, "INITIAL");
+
+        std::string const input =
+            "#define abc 123;\n#not bol;\nabc /* comment * */ 42;\n  #x";
+
+        std::size_t tokens = 0;
+        BOOST_TEST(compare(rules, input, tokens));
+        BOOST_TEST(tokens == 23);
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        lexertl::packed_state_machine<char> packed(sm);
+
+        BOOST_TEST(packed.size() == 2);
+        BOOST_TEST(packed[0].width() == 1);
+        BOOST_TEST(packed[0].has_assertions());
+        BOOST_TEST(!packed[1].has_assertions());
+        BOOST_TEST(packed.table_size() != 0);
+
+        // no match at all
+        std::size_t tokens_no_match = 0;
+        BOOST_TEST(compare(rules, std::string("abc ?"), tokens_no_match));
+        BOOST_TEST(tokens_no_match == 2);
+    }
+
+    {   // a DFA with more than 256 states needs 16 bit state indices
+        boost::lexer::rules rules;
+        for (int i = 0; i != 300; ++i)
+        {
+            char keyword[32];
+            std::sprintf(keyword, "kw%dx%c", i, 'a' + i % 26);
+            rules.add(keyword, std::size_t(i + 1));
+        }
+        rules.add("[a-z][a-z0-9]*", 1000);
+        rules.add("\\s+", 1001);
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        lexertl::packed_state_machine<char> packed(sm);
+
+        BOOST_TEST(packed[0].states() > 256);
+        BOOST_TEST(packed[0].width() == 2);
+
+        std::string input;
+        for (int i = 0; i != 320; ++i)
+        {
+            char keyword[32];
+            std::sprintf(keyword, "kw%dx%c kw%d ", i, 'a' + i % 26, i);
+            input += keyword;
+        }
+
+        std::size_t tokens = 0;
+        BOOST_TEST(compare(rules, input, tokens));
+        BOOST_TEST(tokens == 4 * 320);
+    }
+
+    {   // skipping runs of comments and string literals
+        boost::lexer::rules rules;
+        rules.add("[a-z]+", 1);
+        rules.add("[ \\t\\n]+", 2);
+        rules.add("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]", 3);
+        rules.add("[/][/][^\\n]*", 4);
+        rules.add("\\\"(\\\\.|[^\\\\\"\\n])*\\\"", 5);
+        rules.add("'[^'\\n]*'", 6);
+        rules.add("<<[^@]*", 7);
+        rules.add("^@[a-z]+", 8);
+        rules.add("@[a-z]+", 9);
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        lexertl::packed_state_machine<char> packed(sm);
+        BOOST_TEST(packed[0].has_scans());
+
+        std::size_t exits[4] = { 0 };
+        for (std::size_t s = 1; s != packed[0].states(); ++s)
+        {
+            if (packed[0].scan(s).scan)
+                ++exits[packed[0].scan(s).exits];
+        }
+        BOOST_TEST(exits[0] == 0 && exits[1] != 0);
+        BOOST_TEST(exits[2] != 0 && exits[3] != 0);
+
+        std::string const runs(40, 'x');
+        std::string input = "abc /* " + runs + " ** " + runs + "\n*/ def\n"
+            "\"" + runs + "\\\"" + runs + "\" '" + runs + "' '' \"\" /**/"
+            "<<" + runs + "\n@abc <<" + runs + " @abc @abc\n"
+            "// " + runs + "\n// " + runs;
+
+        std::size_t tokens = 0;
+        BOOST_TEST(compare(rules, input, tokens));
+        BOOST_TEST(tokens == 26);
+
+        // runs up to the end of the input, unterminated literals
+        for (std::size_t i = 0; i != input.size(); ++i)
+        {
+            std::size_t ignored = 0;
+            BOOST_TEST(compare(rules, input.substr(0, i), ignored));
+        }
+    }
+
+    {   // wide characters
+        boost::lexer::wrules rules;
+        rules.add(L"[a-z]+", 1);
+        rules.add(L"[\\x100-\\x1ff]+", 2);
+        rules.add(L"\\s+", 3);
+
+        std::wstring const input = L"abc \x101\x1fe def\n\x150 x";
+
+        std::size_t tokens = 0;
+        BOOST_TEST(compare(rules, input, tokens));
+        BOOST_TEST(tokens == 9);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,167 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_SPIRIT_THREADSAFE
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/parallel_build.hpp>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+//  the rules of a lexer with many states of different sizes, one of them
+//  using BOL assertions
+void add_rules(boost::lexer::rules& rules, std::size_t states)
+{
+    rules.add_macro("D", "[0-9]");
+    rules.add_macro("L", "[a-zA-Z_]");
+
+    char name[32];
+    for (std::size_t s = 1; s != states; ++s)
+    {
+        std::sprintf(name, "S%u", unsigned(s));
+        rules.add_state(name);
+    }
+
+    for (std::size_t s = 0; s != states; ++s)
+    {
+        std::string state("INITIAL");
+        if (s != 0)
+        {
+            std::sprintf(name, "S%u", unsigned(s));
+            state = name;
+        }
+
+        std::string next("INITIAL");
+        std::sprintf(name, "S%u", unsigned((s + 1) % states));
+        if ((s + 1) % states != 0)
+            next = name;
+
+        std::size_t id = 1;
+        rules.add(state.c_str(), "{L}({L}|{D})*", id++, next.c_str());
+        rules.add(state.c_str(), "{D}+", id++, state.c_str());
+        for (std::size_t i = 0; i != s * 3; ++i)
+        {
+            std::sprintf(name, "k%uw%u[.]", unsigned(s), unsigned(i));
+            rules.add(state.c_str(), name, id++, state.c_str());
+        }
+        if (s == states / 2)
+            rules.add(state.c_str(), "^#[a-z]+", id++, state.c_str());
+        rules.add(state.c_str(), "[ \\t\\n]+", id++, state.c_str());
+    }
+}
+
+bool equal(boost::lexer::state_machine const& lhs
+  , boost::lexer::state_machine const& rhs)
+{
+    boost::lexer::detail::internals const& l = lhs.data();
+    boost::lexer::detail::internals const& r = rhs.data();
+
+    if (l._dfa_alphabet != r._dfa_alphabet ||
+        l._seen_BOL_assertion != r._seen_BOL_assertion ||
+        l._seen_EOL_assertion != r._seen_EOL_assertion ||
+        l._lookup->size() != r._lookup->size() ||
+        l._dfa->size() != r._dfa->size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i != l._dfa->size(); ++i)
+    {
+        if (*l._lookup[i] != *r._lookup[i] || *l._dfa[i] != *r._dfa[i])
+            return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        this->self.add("[a-z]+")("[ ]+");
+        this->self("INITIAL", "NUMBERS").add("[#]");
+        this->self("NUMBERS").add("[0-9]+")("[ ]+");
+        this->self("NUMBERS", "INITIAL").add("[#]");
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    {   // the same DFAs as when built one state after the other
+        boost::lexer::rules rules;
+        add_rules(rules, 24);
+
+        boost::lexer::state_machine sequential;
+        boost::lexer::generator::build(rules, sequential);
+        BOOST_TEST(sequential.data()._seen_BOL_assertion);
+
+        boost::lexer::state_machine minimised;
+        boost::lexer::generator::build(rules, minimised);
+        boost::lexer::generator::minimise(minimised);
+
+        std::size_t const threads[] = { 1, 2, 3, 8, 0 };
+        for (std::size_t i = 0; i != sizeof(threads)/sizeof(threads[0]); ++i)
+        {
+            boost::lexer::state_machine sm;
+            lexertl::build_parallel(rules, sm, false, threads[i]);
+            BOOST_TEST(equal(sm, sequential));
+
+            lexertl::build_parallel(rules, sm, true, threads[i]);
+            BOOST_TEST(equal(sm, minimised));
+        }
+    }
+
+    {   // the error of the first state in error
+        boost::lexer::rules rules;
+        add_rules(rules, 8);
+        rules.add("S6", "[a-z", 100, "S6");
+        rules.add("S3", "(ab", 100, "S3");
+
+        std::string expected;
+        try {
+            boost::lexer::state_machine sm;
+            boost::lexer::generator::build(rules, sm);
+        }
+        catch (std::runtime_error const& e) {
+            expected = e.what();
+        }
+        BOOST_TEST(!expected.empty());
+
+        std::string error;
+        try {
+            boost::lexer::state_machine sm;
+            lexertl::build_parallel(rules, sm, false, 4);
+        }
+        catch (std::runtime_error const& e) {
+            error = e.what();
+        }
+        BOOST_TEST(error == expected);
+    }
+
+    {   // a lexer building its DFA concurrently
+        typedef lexertl::token<char const*> token_type;
+        typedef lexertl::lexer<token_type> lexer_type;
+
+        tokens<lexer_type> lexer;
+        lexer.build_threads(2);
+
+        std::string const input = "abc #12 3# de";
+        char const* first = input.c_str();
+        BOOST_TEST(lex::tokenize(first, input.c_str() + input.size(), lexer));
+        BOOST_TEST(first == input.c_str() + input.size());
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,116 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_SPIRIT_LEXERTL_PROFILE
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+typedef lexertl::token<std::string::iterator> token_type;
+typedef lexertl::actor_lexer<token_type> lexer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void identifier_action(std::string::iterator&, std::string::iterator&)
+{
+}
+
+//  zeros are ignored
+void number_action(std::string::iterator& start, std::string::iterator&
+  , BOOST_SCOPED_ENUM(lex::pass_flags)& pass)
+{
+    if (*start == '0')
+        pass = lex::pass_flags::pass_ignore;
+}
+
+void white_space_action(std::string::iterator&, std::string::iterator&
+  , BOOST_SCOPED_ENUM(lex::pass_flags)& pass)
+{
+    pass = lex::pass_flags::pass_ignore;
+}
+
+enum { ID_HASH = lex::min_token_id + 100 };
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        identifier = "[a-z]+";
+        number = "[0-9]+";
+        white_space = "[ ]+";
+        comment = "[^#]+";
+
+        this->self = identifier[&identifier_action] | number[&number_action]
+            | white_space[&white_space_action];
+        this->self("INITIAL", "COMMENT").add("[#]", ID_HASH);
+        this->self("COMMENT") = comment;
+        this->self("COMMENT", "INITIAL").add("[#]", ID_HASH);
+    }
+
+    lex::token_def<> identifier, number, white_space, comment;
+};
+
+lexertl::lexer_profile::entry find(tokens<lexer_type> const& lexer
+  , std::size_t state, std::size_t id)
+{
+    std::vector<lexertl::lexer_profile::entry> const entries =
+        lexer.profile().entries();
+    for (std::size_t i = 0; i != entries.size(); ++i)
+    {
+        if (entries[i].state == state && entries[i].id == id)
+            return entries[i];
+    }
+    return lexertl::lexer_profile::entry();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    tokens<lexer_type> lexer;
+
+    std::string input = "abc 12 0 de 7#a comment#x";
+    std::string::iterator first = input.begin();
+    BOOST_TEST(lex::tokenize(first, input.end(), lexer));
+
+    std::size_t const comment_state = lexer.map_state("COMMENT");
+
+    lexertl::lexer_profile::entry e = find(lexer, 0, lexer.identifier.id());
+    BOOST_TEST(e.matches == 3 && e.characters == 6);
+    BOOST_TEST(e.actions == 3 && e.failed == 0 && e.ignored == 0);
+
+    e = find(lexer, 0, lexer.number.id());
+    BOOST_TEST(e.matches == 3 && e.characters == 4);
+    BOOST_TEST(e.actions == 3 && e.ignored == 1);
+
+    e = find(lexer, 0, lexer.white_space.id());
+    BOOST_TEST(e.matches == 4 && e.actions == 4 && e.ignored == 4);
+
+    e = find(lexer, comment_state, lexer.comment.id());
+    BOOST_TEST(e.matches == 1 && e.characters == 9 && e.actions == 0);
+
+    e = find(lexer, comment_state, ID_HASH);
+    BOOST_TEST(e.matches == 1 && e.characters == 1);
+
+    //  the table of all token definitions and the totals
+    std::ostringstream report;
+    lexer.profile().report(report);
+
+    std::string const text = report.str();
+    BOOST_TEST(std::count(text.begin(), text.end(), '\n') == 1 + 6 + 1);
+    BOOST_TEST(text.find("total") != std::string::npos);
+
+    lexer.clear_profile();
+    BOOST_TEST(lexer.profile().entries().empty());
+
+    return boost::report_errors();
+}
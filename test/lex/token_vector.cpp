@@ -0,0 +1,146 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_stl.hpp>
+
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+///////////////////////////////////////////////////////////////////////////////
+enum token_ids
+{
+    ID_COMMENT = lex::min_token_id + 10,
+    ID_COMMENT_END
+};
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+    {
+        identifier = "[a-z]+";
+        number = "[0-9]+";
+        white_space = "[ \\t\\n]+";
+
+        this->self = identifier | number | white_space | ',';
+        this->self("INITIAL", "COMMENT").add("[/][*]", ID_COMMENT);
+        this->self("COMMENT").add("[^*]+|[*]", ID_COMMENT);
+        this->self("COMMENT", "INITIAL").add("[*][/]", ID_COMMENT_END);
+    }
+
+    lex::token_def<std::string> identifier;
+    lex::token_def<unsigned int> number;
+    lex::token_def<lex::omit> white_space;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    typedef std::string::const_iterator base_iterator_type;
+    typedef lexertl::token<base_iterator_type
+      , boost::mpl::vector<std::string, unsigned int> > token_type;
+    typedef lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type>::token_vector_iterator_type iterator_type;
+
+    BOOST_TEST(sizeof(lexertl::compact_token) == 16);
+
+    tokens<lexer_type> lexer;
+
+    {   // the compact tokens
+        std::string const input = "abc 12,/* x */de";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), tokens));
+        BOOST_TEST(tokens.size() == 8);
+
+        if (tokens.size() == 8)
+        {
+            BOOST_TEST(tokens[0].id == lexer.identifier.id());
+            BOOST_TEST(tokens[0].offset == 0 && tokens[0].length == 3);
+            BOOST_TEST(tokens[2].id == lexer.number.id());
+            BOOST_TEST(tokens[2].offset == 4 && tokens[2].length == 2);
+            BOOST_TEST(tokens[3].id == ',');
+
+            // the state the tokens have been matched in
+            BOOST_TEST(tokens[4].id == ID_COMMENT && tokens[4].state == 0);
+            BOOST_TEST(tokens[5].id == ID_COMMENT && tokens[5].state == 1);
+            BOOST_TEST(tokens[6].id == ID_COMMENT_END && tokens[6].state == 1);
+            BOOST_TEST(tokens[7].id == lexer.identifier.id());
+            BOOST_TEST(tokens[7].state == 0);
+            BOOST_TEST(tokens[7].offset == 14 && tokens[7].length == 2);
+        }
+
+        // tokens are appended
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), tokens));
+        BOOST_TEST(tokens.size() == 16);
+
+        // start in another state
+        std::vector<lexertl::compact_token> comment;
+        BOOST_TEST(lexer.tokenize(input.begin() + 9, input.end(), comment
+          , "COMMENT"));
+        BOOST_TEST(comment.size() == 3 && comment[0].state == 1);
+        BOOST_TEST(comment.back().state == 0);
+        BOOST_TEST(!lexer.tokenize(input.begin(), input.end(), comment
+          , "UNKNOWN"));
+    }
+
+    {   // tokens up to the first unmatched character
+        std::string const input = "abc 12 $ de";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(!lexer.tokenize(input.begin(), input.end(), tokens));
+        BOOST_TEST(tokens.size() == 4);
+        BOOST_TEST(tokens.back().offset + tokens.back().length == 7);
+
+        // no tables at all
+        std::vector<lexertl::compact_token> all;
+        BOOST_TEST(lexertl::tokenize_all(lexertl::packed_state_machine<char>()
+          , input.begin(), input.end(), all) == input.begin());
+        BOOST_TEST(all.empty());
+    }
+
+    {   // parse the compact tokens
+        namespace phoenix = boost::phoenix;
+        using qi::_1;
+
+        std::string const input = "abc 12, de 30 ,fgh 100";
+        std::vector<lexertl::compact_token> tokens;
+        BOOST_TEST(lexer.tokenize(input.begin(), input.end(), tokens));
+
+        iterator_type first(input.begin(), tokens.begin());
+        iterator_type last(input.begin(), tokens.end());
+        BOOST_TEST(last - first == 13);
+        BOOST_TEST((*(first + 2)).id() == lexer.number.id());
+
+        std::vector<std::string> identifiers;
+        unsigned int sum = 0;
+        BOOST_TEST(qi::phrase_parse(first, last
+          , *(lexer.identifier[phoenix::push_back(phoenix::ref(identifiers), _1)]
+             >> lexer.number[phoenix::ref(sum) += _1] >> -qi::token(','))
+          , lexer.white_space) && first == last);
+
+        BOOST_TEST(identifiers.size() == 3 && identifiers[2] == "fgh");
+        BOOST_TEST(sum == 142);
+
+        // backtracking (and skipping the white space after the match)
+        first = iterator_type(input.begin(), tokens.begin());
+        BOOST_TEST(qi::phrase_parse(first, last
+          , (lexer.identifier >> lexer.identifier) | lexer.identifier
+          , lexer.white_space));
+        BOOST_TEST(first.compact_position() == tokens.begin() + 2);
+    }
+
+    return boost::report_errors();
+}
@@ -8,7 +8,12 @@
 
 #include <boost/spirit/include/support_argument.hpp>
 #include <boost/spirit/include/qi_binary.hpp>
+#include <boost/spirit/include/qi_repeat.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
 #include <boost/cstdint.hpp>
+#include <list>
+#include <string>
+#include <vector>
 #include "test.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +42,8 @@ int main()
     using boost::spirit::qi::bin_double;
     using boost::spirit::qi::big_bin_double;
     using boost::spirit::qi::little_bin_double;
+    using boost::spirit::qi::repeat;
+    using boost::spirit::qi::inf;
 
     boost::uint8_t uc;
     boost::uint16_t us;
@@ -48,7 +55,7 @@ int main()
     double d;
 
     {   // test native endian binaries
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
         BOOST_TEST(test_attr("\x01", byte_, uc) && uc == 0x01);
         BOOST_TEST(test_attr("\x01\x02", word, us) && us == 0x0201);
         BOOST_TEST(test_attr("\x01\x02\x03\x04", dword, ui) && ui == 0x04030201);
@@ -76,7 +83,7 @@ int main()
     }
 
     {   // test native endian binaries
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
         BOOST_TEST(test("\x01", byte_(0x01)));
         BOOST_TEST(test("\x01\x02", word(0x0201)));
         BOOST_TEST(test("\x01\x02\x03\x04", dword(0x04030201)));
@@ -151,5 +158,79 @@ int main()
             little_bin_double(1.0)));
     }
 
+    {   // test binary arrays (contiguous input, bulk copy)
+        std::vector<boost::uint16_t> vs;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06", 6,
+            repeat(3)[big_word], vs) && vs.size() == 3 &&
+            vs[0] == 0x0102 && vs[1] == 0x0304 && vs[2] == 0x0506);
+
+        std::vector<boost::uint32_t> vi;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", 8,
+            repeat(2)[little_dword], vi) && vi.size() == 2 &&
+            vi[0] == 0x04030201 && vi[1] == 0x08070605);
+
+        // appends to the existing elements
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04", 4,
+            repeat(1)[big_dword], vi) && vi.size() == 3 &&
+            vi[2] == 0x01020304);
+
+        std::vector<boost::int32_t> vsi;
+        BOOST_TEST(binary_test_attr("\xff\xff\xff\xff", 4,
+            repeat(1)[little_dword], vsi) && vsi.size() == 1 && vsi[0] == -1);
+
+#ifdef BOOST_HAS_LONG_LONG
+        std::vector<boost::uint64_t> vl;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", 8,
+            repeat(1)[big_qword], vl) && vl.size() == 1 &&
+            vl[0] == 0x0102030405060708LL);
+#endif
+
+        std::vector<float> vf;
+        BOOST_TEST(binary_test_attr("\x3f\x80\x00\x00\x40\x00\x00\x00", 8,
+            repeat(2)[big_bin_float], vf) && vf.size() == 2 &&
+            vf[0] == 1.0f && vf[1] == 2.0f);
+
+        std::vector<double> vd;
+        BOOST_TEST(binary_test_attr("\x00\x00\x00\x00\x00\x00\xf0\x3f", 8,
+            repeat(1)[little_bin_double], vd) && vd.size() == 1 && vd[0] == 1.0);
+
+        // not enough input
+        vi.clear();
+        BOOST_TEST(!binary_test_attr("\x01\x02\x03\x04\x05", 5,
+            repeat(2)[little_dword], vi));
+
+        // repeat(min, max) and repeat(min, inf) take as many as available
+        vs.clear();
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05", 5,
+            repeat(1, 3)[big_word], vs, false) && vs.size() == 2);
+        vs.clear();
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06", 6,
+            repeat(1, 2)[big_word], vs, false) && vs.size() == 2);
+        vs.clear();
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06", 6,
+            repeat(1, inf)[big_word], vs) && vs.size() == 3);
+        BOOST_TEST(!binary_test_attr("\x01\x02", 2,
+            repeat(2, inf)[big_word], vs));
+
+        // unused attribute
+        BOOST_TEST(binary_test("\x01\x02\x03\x04", 4, repeat(2)[word]));
+        BOOST_TEST(binary_test("\x01\x02\x03\x04", 4,
+            repeat(1)[word] >> word));
+    }
+
+    {   // test binary arrays (element by element fallback)
+        std::list<boost::uint16_t> ls;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04", 4,
+            repeat(2)[big_word], ls) && ls.size() == 2 &&
+            ls.front() == 0x0102 && ls.back() == 0x0304);
+
+        std::string const input("\x01\x02\x03\x04", 4);
+        std::string::const_iterator first = input.begin();
+        std::vector<boost::uint16_t> vs;
+        BOOST_TEST(boost::spirit::qi::parse(first, input.end(),
+            repeat(2)[big_word], vs) && first == input.end() &&
+            vs.size() == 2 && vs[1] == 0x0304);
+    }
+
     return boost::report_errors();
 }
@@ -10,10 +10,33 @@
 #include <boost/spirit/include/qi_int.hpp>
 #include <boost/spirit/include/qi_operator.hpp>
 
+#include <boost/fusion/include/std_pair.hpp>
+
+#include <cstddef>
 #include <iostream>
+#include <string>
 #include <vector>
 #include "test.hpp"
 
+// counts the copies made of the elements of an attribute
+struct counted
+{
+    static std::size_t copies;
+
+    counted(int value_ = 0) : value(value_) {}
+    counted(counted const& rhs) : value(rhs.value) { ++copies; }
+    counted& operator=(counted const& rhs)
+    {
+        value = rhs.value;
+        ++copies;
+        return *this;
+    }
+
+    int value;
+};
+
+std::size_t counted::copies = 0;
+
 int
 main()
 {
@@ -42,5 +65,58 @@ main()
         BOOST_TEST(attr == "abc");
     }
 
+    using boost::spirit::qi::hold_append;
+
+    {
+        std::vector<int> vec(1, 0);
+        BOOST_TEST(!test_attr("1$", hold_append[int_ >> ';'], vec));
+        BOOST_TEST(vec.size() == 1);
+        BOOST_TEST(test_attr("1;", hold_append[int_ >> ';'], vec));
+        BOOST_TEST(vec.size() == 2);
+        BOOST_TEST(vec[1] == 1);
+    }
+
+    {
+        std::string attr;
+        BOOST_TEST(
+            test_attr(
+                "abc;",
+                hold_append[alpha >> ';'] | (+alpha >> ';'),
+                attr));
+        BOOST_TEST(attr == "abc");
+
+        attr.clear();
+        BOOST_TEST(
+            test_attr(
+                "ab;cd,ef;",
+                *(hold_append[+alpha >> ';'] | (+alpha >> ',')),
+                attr));
+        BOOST_TEST(attr == "abcdef");
+    }
+
+    {   // fusion sequences roll back every member
+        std::pair<int, std::string> p(7, "x");
+        BOOST_TEST(!test_attr("1ab$", hold_append[int_ >> +alpha >> ';'], p));
+        BOOST_TEST(p.first == 7 && p.second == "x");
+        BOOST_TEST(test_attr("1ab;", hold_append[int_ >> +alpha >> ';'], p));
+        BOOST_TEST(p.first == 1 && p.second == "xab");
+    }
+
+    {   // holding inside a loop over a million elements stays linear: the
+        // failing branch does not copy the elements parsed so far
+        std::size_t const n = 1000000;
+        std::string input;
+        input.reserve(2 * n);
+        for (std::size_t i = 0; i != n; ++i)
+            input += "1,";
+
+        std::vector<counted> vec;
+        counted::copies = 0;
+        BOOST_TEST(test_attr(input.c_str(),
+            *(hold_append[int_ >> ';'] | (int_ >> ',')), vec));
+        BOOST_TEST(vec.size() == n);
+        BOOST_TEST(counted::copies < 16 * n);
+    }
+
     return boost::report_errors();
 }
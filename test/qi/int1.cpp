@@ -93,6 +93,47 @@ main()
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  long numbers followed by more input (converted in blocks of digits)
+    ///////////////////////////////////////////////////////////////////////////
+#ifdef BOOST_HAS_LONG_LONG
+    {
+        using boost::spirit::qi::long_long;
+        using boost::spirit::qi::int_;
+        using boost::spirit::qi::parse;
+        boost::long_long_type ll;
+        int i;
+
+        BOOST_TEST(test_attr("1234567890123456789, 12345678", long_long, ll
+          , false));
+        BOOST_TEST(ll == 1234567890123456789LL);
+        BOOST_TEST(test_attr("-9223372036854775808;;;;;;;;", long_long, ll
+          , false));
+        BOOST_TEST(ll == LONG_LONG_MIN);
+        BOOST_TEST(test_attr("000000000000012345678901234567x", long_long, ll
+          , false));
+        BOOST_TEST(ll == 12345678901234567LL);
+        BOOST_TEST(!test_attr("9223372036854775808........", long_long, ll
+          , false));
+        BOOST_TEST(!test_attr("-92233720368547758080000000000", long_long, ll
+          , false));
+
+        BOOST_TEST(test_attr("2147483647:2147483646", int_, i, false));
+        BOOST_TEST(i == 2147483647);
+        BOOST_TEST(!test_attr("21474836470000000000", int_, i, false));
+        BOOST_TEST(!test_attr("2147483648;;;;;;;;", int_, i, false));
+
+        std::string const overflow("12345678901234567890123, 12345");
+        std::string::const_iterator first = overflow.begin();
+        BOOST_TEST(!parse(first, overflow.end(), long_long, ll));
+
+        std::string const str("1234567890123456, 12345");
+        first = str.begin();
+        BOOST_TEST(parse(first, str.end(), long_long, ll));
+        BOOST_TEST(ll == 1234567890123456LL && *first == ',');
+    }
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     //  short_ and long_ tests
     ///////////////////////////////////////////////////////////////////////////
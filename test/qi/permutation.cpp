@@ -119,6 +119,31 @@ main()
         BOOST_TEST((at_c<1>(attr).get() == 'a'));
     }
 
+    {   // test first character dispatch (literal keys, skipping, parsers
+        // without a known first character)
+        using boost::spirit::qi::lit;
+        using boost::spirit::qi::lexeme;
+        using boost::spirit::ascii::space;
+
+        vector<optional<int>, optional<int>, optional<int> > attr;
+        BOOST_TEST((test_attr(" b=2 a=1 c=3",
+            ("a=" >> int_) ^ ("b=" >> int_) ^ (lit('c') >> '=' >> int_),
+            attr, space)));
+        BOOST_TEST((at_c<0>(attr).get() == 1));
+        BOOST_TEST((at_c<1>(attr).get() == 2));
+        BOOST_TEST((at_c<2>(attr).get() == 3));
+
+        // "ab" and "a" share their first character
+        BOOST_TEST((test("a ab", lit("ab") ^ lit('a') ^ int_, space)));
+        BOOST_TEST((test("ab a 1", lit("ab") ^ lit('a') ^ int_, space)));
+        BOOST_TEST((test("1 ab", lit("ab") ^ lexeme[lit('x') >> 'y'] ^ int_, space)));
+        BOOST_TEST((test("xy1ab", lit("ab") ^ lexeme[lit('x') >> 'y'] ^ int_)));
+        BOOST_TEST((!test("yx", lit("ab") ^ lexeme[lit('x') >> 'y'] ^ int_)));
+
+        // wide input and literals
+        BOOST_TEST((test(L"b\x2010" L"a", lit(L"a") ^ lit(L"\x2010") ^ lit(L"b"))));
+    }
+
     return boost::report_errors();
 }
 
@@ -15,7 +15,7 @@
 int main()
 {
 // This test assumes a little endian architecture
-#ifdef BOOST_LITTLE_ENDIAN
+#if BOOST_ENDIAN_LITTLE_BYTE
     using spirit_test::test_attr;
     using boost::spirit::qi::rule;
     using boost::spirit::qi::locals;
@@ -0,0 +1,115 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_string.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/include/qi_auxiliary.hpp>
+#include <boost/spirit/include/qi_nonterminal.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+#include <boost/spirit/include/phoenix_core.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/fusion/include/std_pair.hpp>
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <iostream>
+#include "test.hpp"
+
+int
+main()
+{
+    using spirit_test::test_attr;
+    using spirit_test::test;
+
+    using namespace boost::spirit::ascii;
+    using namespace boost::spirit::qi::labels;
+    using boost::spirit::qi::rule;
+    using boost::spirit::qi::int_;
+    using boost::spirit::qi::make_static_rule;
+    using boost::spirit::qi::make_static_auto_rule;
+
+    { // basic tests
+        typedef rule<char const*> rule_type;
+
+        boost::spirit::result_of::static_rule<rule_type, char>::type
+            a = make_static_rule<rule_type>('a', "a");
+        BOOST_TEST(a.name() == "a");
+        BOOST_TEST(test("a", a));
+        BOOST_TEST(!test("b", a));
+
+        BOOST_TEST(test("abab", *(a | 'b')));
+
+        // static rules compose with ordinary rules
+        rule_type start = +a >> 'b';
+        BOOST_TEST(test("aaab", start));
+
+        // copies are independent of the original
+        boost::spirit::result_of::static_rule<rule_type, char>::type b(a);
+        BOOST_TEST(test("aa", b >> a));
+    }
+
+#if !defined(BOOST_NO_CXX11_AUTO_DECLARATIONS)
+    { // synthesized attributes, rule = expr vs. rule %= expr
+        typedef rule<char const*, int()> int_rule;
+
+        auto const r1 = make_static_rule<int_rule>(int_[_val = _1 * 2]);
+        int i = 0;
+        BOOST_TEST(test_attr("21", r1, i) && i == 42);
+
+        auto const r2 = make_static_auto_rule<int_rule>(int_ >> '!');
+        i = 0;
+        BOOST_TEST(test_attr("42!", r2, i) && i == 42);
+
+        // without semantic actions = behaves like %=
+        auto const r3 = make_static_rule<int_rule>(int_);
+        i = 0;
+        BOOST_TEST(test_attr("42", r3, i) && i == 42);
+    }
+
+    { // container attributes and skippers
+        typedef rule<char const*, std::vector<int>(), space_type> list_rule;
+
+        auto const r = make_static_auto_rule<list_rule>(int_ % ',');
+        std::vector<int> v;
+        BOOST_TEST(test_attr(" 1 , 2 , 3 ", r, v, space) && v.size() == 3);
+        BOOST_TEST(v[0] == 1 && v[1] == 2 && v[2] == 3);
+
+        std::pair<std::vector<int>, char> p;
+        BOOST_TEST(test_attr("1, 2; x", r >> ';' >> char_, p, space));
+        BOOST_TEST(p.first.size() == 2 && p.second == 'x');
+    }
+
+    { // inherited attributes and locals
+        typedef rule<char const*, int(int), boost::spirit::qi::locals<int> >
+            add_rule;
+
+        auto const r = make_static_rule<add_rule>(
+            int_[_a = _1] >> boost::spirit::qi::eps[_val = _a + _r1]);
+
+        int i = 0;
+        BOOST_TEST(test_attr("40", r(2), i) && i == 42);
+    }
+
+    { // recursion is closed by an ordinary rule
+        typedef rule<char const*, int()> int_rule;
+
+        int_rule expr;
+        auto const factor = make_static_rule<int_rule>(
+            int_[_val = _1] | '(' >> expr[_val = _1] >> ')', "factor");
+        expr = factor[_val = _1] >> *('+' >> factor[_val += _1]);
+
+        int i = 0;
+        BOOST_TEST(test_attr("1+(2+(3+4))+5", expr, i) && i == 15);
+        BOOST_TEST(!test("1+(2", expr));
+    }
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,174 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/qi_string.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_directive.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/home/qi/string/tst_snapshot.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind/bind.hpp>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+namespace
+{
+    typedef boost::spirit::qi::symbols<
+        char, int, boost::spirit::qi::tst_snapshot<char, int> >
+    snapshot_symbols;
+
+    std::string key(int i)
+    {
+        char buffer[16];
+        std::sprintf(buffer, "key%03d", i);
+        return buffer;
+    }
+
+    struct counter
+    {
+        explicit counter(int& n_) : n(n_) {}
+
+        void operator()(std::string const&, int) const
+        {
+            ++n;
+        }
+
+        int& n;
+    };
+
+    // the readers parse all keys over and over, every key found must map
+    // to its own number
+    void reader(snapshot_symbols const& sym, int keys
+      , boost::atomic<bool> const& done, boost::atomic<int>& errors
+      , boost::atomic<long>& found)
+    {
+        std::vector<std::string> input;
+        for (int i = 0; i != keys; ++i)
+            input.push_back(key(i) + ";");
+
+        long count = 0;
+        while (!done.load())
+        {
+            for (int i = 0; i != keys; ++i)
+            {
+                std::string const& str = input[i];
+                std::string::const_iterator first = str.begin();
+                int value = -1;
+                if (boost::spirit::qi::parse(first, str.end(), sym, value))
+                {
+                    if (value != i || *first != ';')
+                        ++errors;
+                    ++count;
+                }
+            }
+        }
+        found += count;
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::qi::symbols;
+
+    { // basics
+        snapshot_symbols sym;
+
+        sym.add
+            ("Joel", 1)
+            ("Ruby", 2)
+            ("Tenji", 3)
+        ;
+
+        int i = 0;
+        BOOST_TEST((test_attr("Joel", sym, i)) && i == 1);
+        BOOST_TEST((test_attr("Tenji", sym, i)) && i == 3);
+        BOOST_TEST((!test("XXX", sym)));
+
+        sym.remove("Ruby");
+        BOOST_TEST((!test("Ruby", sym)));
+
+        sym.at("Kim") = 4;
+        BOOST_TEST((test_attr("Kim", sym, i)) && i == 4);
+        BOOST_TEST(sym.find("Joel") && *sym.find("Joel") == 1);
+
+        int n = 0;
+        sym.for_each(counter(n));
+        BOOST_TEST(n == 3);
+    }
+
+    { // copies and assignments copy the entries
+        snapshot_symbols sym;
+        sym.add("a", 1)("b", 2);
+
+        snapshot_symbols copy(sym);
+        copy.add("c", 3);
+        BOOST_TEST((test("c", copy)));
+
+        snapshot_symbols other;
+        other = copy;
+        BOOST_TEST((test("a", other)));
+        BOOST_TEST((test("c", other)));
+
+        sym.clear();
+        BOOST_TEST((!test("a", sym)));
+        BOOST_TEST((test("a", other)));
+    }
+
+    { // stress test: modify the symbols while other threads parse with them
+        int const keys = 64;
+        int const readers = 4;
+
+        snapshot_symbols sym;
+        for (int i = 0; i != keys; i += 2)
+            sym.add(key(i), i);
+
+        boost::atomic<bool> done(false);
+        boost::atomic<int> errors(0);
+        boost::atomic<long> found(0);
+
+        boost::thread_group threads;
+        for (int i = 0; i != readers; ++i)
+        {
+            threads.create_thread(boost::bind(reader, boost::cref(sym), keys
+              , boost::cref(done), boost::ref(errors), boost::ref(found)));
+        }
+
+        // the writer adds and removes the odd keys, and replaces all
+        // entries at once
+        for (int round = 0; round != 200; ++round)
+        {
+            for (int i = 1; i < keys; i += 2)
+                sym.add(key(i), i);
+            for (int i = 1; i < keys; i += 2)
+                sym.remove(key(i));
+
+            snapshot_symbols all;
+            for (int i = 0; i != keys; ++i)
+                all.add(key(i), i);
+            sym = all;
+            sym.clear();
+            for (int i = 0; i != keys; i += 2)
+                sym.add(key(i), i);
+        }
+
+        done = true;
+        threads.join_all();
+
+        BOOST_TEST(errors == 0);
+        BOOST_TEST(found != 0);
+    }
+
+    return boost::report_errors();
+}
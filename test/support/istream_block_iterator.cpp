@@ -0,0 +1,71 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/support_istream_iterator.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace boost::spirit;
+
+int main()
+{
+    // blocks smaller than the input, characters are read unformatted
+    {
+        std::istringstream iss("a b\ncd");
+        typedef basic_istream_block_iterator<char, std::char_traits<char>, 2>
+            iterator_type;
+
+        std::string s;
+        for (iterator_type it(iss), end; it != end; ++it)
+            s += *it;
+        BOOST_TEST(s == "a b\ncd");
+    }
+
+    // backtracking across block boundaries
+    {
+        std::istringstream iss("abcdefghij");
+        typedef basic_istream_block_iterator<char, std::char_traits<char>, 3>
+            iterator_type;
+
+        iterator_type first(iss), last;
+        iterator_type save = first;
+        std::advance(first, 7);
+        BOOST_TEST(*first == 'h');
+
+        std::string s;
+        for (/**/; save != last; ++save)
+            s += *save;
+        BOOST_TEST(s == "abcdefghij");
+    }
+
+    // empty input
+    {
+        std::istringstream iss("");
+        BOOST_TEST(istream_block_iterator(iss) == istream_block_iterator());
+    }
+
+    // parsing
+    {
+        std::string input;
+        for (int i = 0; i != 1000; ++i)
+            input += "123, 456, 789,\n";
+        input += "0";
+        std::istringstream iss(input);
+
+        istream_block_iterator first(iss), last;
+        std::vector<int> v;
+        BOOST_TEST(qi::phrase_parse(first, last, qi::int_ % ',', qi::space, v));
+        BOOST_TEST(first == last);
+        BOOST_TEST(v.size() == 3001);
+        BOOST_TEST(v[3000] == 0 && v[2999] == 789);
+    }
+
+    return boost::report_errors();
+}
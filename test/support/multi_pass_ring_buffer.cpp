@@ -0,0 +1,187 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/phoenix_core.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/support_multi_pass.hpp>
+#include <boost/spirit/repository/include/qi_flush_multi_pass.hpp>
+#include <sstream>
+#include <iterator>
+#include <string>
+
+using namespace boost::spirit;
+namespace policies = boost::spirit::iterator_policies;
+
+template <std::size_t N, typename Checking = policies::no_check>
+struct ring_buffer_iterator
+{
+    typedef std::istreambuf_iterator<char> base_iterator_type;
+    typedef multi_pass<
+        base_iterator_type
+      , policies::default_policy<
+            policies::ref_counted
+          , Checking
+          , policies::buffering_input_iterator
+          , policies::ring_buffer<N> >
+    > type;
+};
+
+int main()
+{
+    typedef std::istreambuf_iterator<char> base_iterator_type;
+
+    // backtracking over the buffered input
+    {
+        std::istringstream iss("abcdefghijklmnopqrstuvwxyz");
+        typedef ring_buffer_iterator<0>::type iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type last = iterator_type(base_iterator_type());
+
+        iterator_type save = first;
+        std::string s;
+        for (iterator_type it = first; it != last; ++it)
+            s += *it;
+        BOOST_TEST(s == "abcdefghijklmnopqrstuvwxyz");
+
+        // all the input has been buffered, and the buffer grew
+        policies::buffer_statistics stats = policies::get_buffer_statistics(save);
+        BOOST_TEST(stats.size == 26);
+        BOOST_TEST(stats.high_water_mark == 26);
+        BOOST_TEST(stats.capacity >= 26);
+        BOOST_TEST(stats.reallocations == 1);
+        BOOST_TEST(stats.position == 0);
+
+        s.clear();
+        for (iterator_type it = save; it != last; ++it)
+            s += *it;
+        BOOST_TEST(s == "abcdefghijklmnopqrstuvwxyz");
+
+        // committing drops everything in front of the committed iterator
+        iterator_type middle = save;
+        std::advance(middle, 10);
+        middle.clear_queue();
+        stats = policies::get_buffer_statistics(save);
+        BOOST_TEST(stats.size == 16);
+        BOOST_TEST(stats.position == 10);
+        BOOST_TEST(*middle == 'k');
+
+        bool caught = false;
+        try { char c = *save; (void)c; }
+        catch (policies::illegal_backtracking const&) { caught = true; }
+        BOOST_TEST(caught);
+    }
+
+    // a single iterator does not buffer anything
+    {
+        std::istringstream iss("abcdefghijklmnopqrstuvwxyz");
+        typedef ring_buffer_iterator<4>::type iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type last = iterator_type(base_iterator_type());
+
+        std::string s;
+        for (/**/; first != last; ++first)
+            s += *first;
+        BOOST_TEST(s == "abcdefghijklmnopqrstuvwxyz");
+        BOOST_TEST(policies::get_buffer_statistics(first).high_water_mark == 0);
+    }
+
+    // buffering more than N elements throws
+    {
+        std::istringstream iss("abcdefghijklmnopqrstuvwxyz");
+        typedef ring_buffer_iterator<8>::type iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type save = first;
+
+        bool caught = false;
+        try { std::advance(first, 9); }
+        catch (policies::buffer_overflow const&) { caught = true; }
+        BOOST_TEST(caught);
+        BOOST_TEST(policies::get_buffer_statistics(save).size == 8);
+        BOOST_TEST(*save == 'a');
+    }
+
+    // wrapping around the end of the buffer
+    {
+        std::istringstream iss("abcdefghijklmnopqrstuvwx");
+        typedef ring_buffer_iterator<4>::type iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type last = iterator_type(base_iterator_type());
+
+        std::string s;
+        while (first != last)
+        {
+            iterator_type save = first;
+            std::advance(first, 3);
+            for (iterator_type it = save; it != first; ++it)
+                s += *it;
+            first.clear_queue();
+            ++first;
+        }
+        BOOST_TEST(s == "abcefgijkmnoqrsuvw");
+        BOOST_TEST(policies::get_buffer_statistics(first).high_water_mark <= 4);
+        BOOST_TEST(policies::get_buffer_statistics(first).reallocations == 0);
+    }
+
+    // a long streaming parse stays within a bounded buffer, as long as it
+    // commits after every record
+    {
+        std::string input;
+        for (int i = 0; i != 100000; ++i)
+            input += "key = 12345;\n";
+        std::istringstream iss(input);
+        typedef ring_buffer_iterator<64>::type iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type last = iterator_type(base_iterator_type());
+
+        using boost::spirit::repository::qi::flush_multi_pass;
+        int count = 0;
+        BOOST_TEST(qi::phrase_parse(first, last
+          , *((qi::lit("key") >> '=' >> qi::int_ >> ';') [++boost::phoenix::ref(count)]
+                >> flush_multi_pass)
+          , qi::space));
+        BOOST_TEST(first == last);
+        BOOST_TEST(count == 100000);
+
+        policies::buffer_statistics stats = policies::get_buffer_statistics(first);
+        BOOST_TEST(stats.high_water_mark < 16);
+
+        // the last commit point is right behind the last ';'
+        BOOST_TEST(stats.position == input.size() - 1);
+    }
+
+    // with buf_id_check, a commit invalidates all the other iterators,
+    // even those referring to the data behind the committed position
+    {
+        std::istringstream iss("abcdefghijklmnopqrstuvwxyz");
+        typedef ring_buffer_iterator<0, policies::buf_id_check>::type
+            iterator_type;
+
+        iterator_type first = iterator_type(base_iterator_type(iss));
+        iterator_type middle = first;
+        std::advance(middle, 10);
+        iterator_type behind = middle;
+        std::advance(behind, 5);
+        BOOST_TEST(*behind == 'p');
+
+        middle.clear_queue();
+        BOOST_TEST(*middle == 'k');
+
+        bool caught = false;
+        try { char c = *behind; (void)c; }
+        catch (policies::illegal_backtracking const&) { caught = true; }
+        BOOST_TEST(caught);
+    }
+
+    return boost::report_errors();
+}
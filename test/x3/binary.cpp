@@ -0,0 +1,175 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/cstdint.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using spirit_test::test_attr;
+    using spirit_test::test;
+    using spirit_test::binary_test;
+    using spirit_test::binary_test_attr;
+
+    using boost::spirit::x3::byte_;
+    using boost::spirit::x3::word;
+    using boost::spirit::x3::dword;
+    using boost::spirit::x3::big_word;
+    using boost::spirit::x3::big_dword;
+    using boost::spirit::x3::little_word;
+    using boost::spirit::x3::little_dword;
+    using boost::spirit::x3::qword;
+    using boost::spirit::x3::big_qword;
+    using boost::spirit::x3::little_qword;
+    using boost::spirit::x3::bin_float;
+    using boost::spirit::x3::big_bin_float;
+    using boost::spirit::x3::little_bin_float;
+    using boost::spirit::x3::bin_double;
+    using boost::spirit::x3::big_bin_double;
+    using boost::spirit::x3::little_bin_double;
+    using boost::spirit::x3::binary_array;
+
+    boost::uint8_t uc;
+    boost::uint16_t us;
+    boost::uint32_t ui;
+    boost::uint64_t ul;
+    float f;
+    double d;
+
+    {   // test native endian binaries
+#if BOOST_ENDIAN_LITTLE_BYTE
+        BOOST_TEST(test_attr("\x01", byte_, uc) && uc == 0x01);
+        BOOST_TEST(test_attr("\x01\x02", word, us) && us == 0x0201);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04", dword, ui) && ui == 0x04030201);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", qword, ul) &&
+            ul == 0x0807060504030201LL);
+        BOOST_TEST(binary_test_attr("\x00\x00\x80\x3f", 4, bin_float, f) &&
+            f == 1.0f);
+        BOOST_TEST(binary_test_attr("\x00\x00\x00\x00\x00\x00\xf0\x3f",
+            8, bin_double, d) && d == 1.0);
+#else
+        BOOST_TEST(test_attr("\x01", byte_, uc) && uc == 0x01);
+        BOOST_TEST(test_attr("\x01\x02", word, us) && us ==  0x0102);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04", dword, ui) && ui == 0x01020304);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", qword, ul) &&
+            ul == 0x0102030405060708LL);
+        BOOST_TEST(binary_test_attr("\x3f\x80\x00\x00", 4, bin_float, f) &&
+            f == 1.0f);
+        BOOST_TEST(binary_test_attr("\x3f\xf0\x00\x00\x00\x00\x00\x00",
+            8, bin_double, d) && d == 1.0);
+#endif
+    }
+
+    {   // test native endian binary literals
+#if BOOST_ENDIAN_LITTLE_BYTE
+        BOOST_TEST(test("\x01", byte_(0x01)));
+        BOOST_TEST(test("\x01\x02", word(0x0201)));
+        BOOST_TEST(test("\x01\x02\x03\x04", dword(0x04030201)));
+        BOOST_TEST(binary_test("\x00\x00\x80\x3f", 4, bin_float(1.0f)));
+#else
+        BOOST_TEST(test("\x01", byte_(0x01)));
+        BOOST_TEST(test("\x01\x02", word(0x0102)));
+        BOOST_TEST(test("\x01\x02\x03\x04", dword(0x01020304)));
+        BOOST_TEST(binary_test("\x3f\x80\x00\x00", 4, bin_float(1.0f)));
+#endif
+        BOOST_TEST(!test("\x01\x02", word(0x0303)));
+    }
+
+    {   // test big endian binaries
+        BOOST_TEST(test_attr("\x01\x02", big_word, us) && us == 0x0102);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04", big_dword, ui) && ui == 0x01020304);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", big_qword, ul)
+            && ul == 0x0102030405060708LL);
+        BOOST_TEST(binary_test_attr("\x3f\x80\x00\x00", 4, big_bin_float, f) &&
+            f == 1.0f);
+        BOOST_TEST(binary_test_attr("\x3f\xf0\x00\x00\x00\x00\x00\x00",
+            8, big_bin_double, d) && d == 1.0);
+
+        BOOST_TEST(test("\x01\x02", big_word(0x0102)));
+        BOOST_TEST(test("\x01\x02\x03\x04", big_dword(0x01020304)));
+        BOOST_TEST(binary_test("\x3f\xf0\x00\x00\x00\x00\x00\x00", 8,
+            big_bin_double(1.0)));
+    }
+
+    {   // test little endian binaries
+        BOOST_TEST(test_attr("\x01\x02", little_word, us) && us == 0x0201);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04", little_dword, ui) && ui == 0x04030201);
+        BOOST_TEST(test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", little_qword, ul)
+            && ul == 0x0807060504030201LL);
+        BOOST_TEST(binary_test_attr("\x00\x00\x80\x3f", 4,
+            little_bin_float, f) && f == 1.0f);
+        BOOST_TEST(binary_test_attr("\x00\x00\x00\x00\x00\x00\xf0\x3f",
+            8, little_bin_double, d) && d == 1.0);
+
+        BOOST_TEST(test("\x01\x02", little_word(0x0201)));
+        BOOST_TEST(test("\x01\x02\x03\x04", little_dword(0x04030201)));
+        BOOST_TEST(binary_test("\x00\x00\x00\x00\x00\x00\xf0\x3f", 8,
+            little_bin_double(1.0)));
+    }
+
+    {   // test binary arrays (contiguous input, bulk copy)
+        std::vector<boost::uint16_t> vs;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06", 6,
+            binary_array(3)[big_word], vs) && vs.size() == 3 &&
+            vs[0] == 0x0102 && vs[1] == 0x0304 && vs[2] == 0x0506);
+
+        std::vector<boost::uint32_t> vi;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04\x05\x06\x07\x08", 8,
+            binary_array(2)[little_dword], vi) && vi.size() == 2 &&
+            vi[0] == 0x04030201 && vi[1] == 0x08070605);
+
+        std::vector<float> vf;
+        BOOST_TEST(binary_test_attr("\x3f\x80\x00\x00\x40\x00\x00\x00", 8,
+            binary_array(2)[big_bin_float], vf) && vf.size() == 2 &&
+            vf[0] == 1.0f && vf[1] == 2.0f);
+
+        // not enough input
+        vi.clear();
+        BOOST_TEST(!binary_test_attr("\x01\x02\x03\x04\x05", 5,
+            binary_array(2)[little_dword], vi));
+
+        // unused attribute
+        BOOST_TEST(binary_test("\x01\x02\x03\x04", 4,
+            binary_array(1)[word] >> word));
+    }
+
+    {   // test binary arrays (element by element fallback)
+        std::list<boost::uint16_t> ls;
+        BOOST_TEST(binary_test_attr("\x01\x02\x03\x04", 4,
+            binary_array(2)[big_word], ls) && ls.size() == 2 &&
+            ls.front() == 0x0102 && ls.back() == 0x0304);
+
+        std::string const input("\x01\x02\x03\x04", 4);
+        std::string::const_iterator first = input.begin();
+        std::vector<boost::uint16_t> vs;
+        BOOST_TEST(boost::spirit::x3::parse(first, input.end(),
+            binary_array(2)[big_word], vs) && first == input.end() &&
+            vs.size() == 2 && vs[1] == 0x0304);
+    }
+
+    {   // test length prefixed binary arrays
+        using boost::spirit::x3::omit;
+        using boost::spirit::x3::_attr;
+
+        std::size_t count = 0;
+        auto set_count = [&](auto& ctx) { count = _attr(ctx); };
+        auto get_count = [&](auto const&) { return count; };
+
+        std::vector<boost::uint16_t> vs;
+        BOOST_TEST(binary_test_attr("\x02\x01\x02\x03\x04", 5,
+            omit[byte_[set_count]] >> binary_array(get_count)[big_word], vs) &&
+            vs.size() == 2 && vs[0] == 0x0102 && vs[1] == 0x0304);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,123 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "test.hpp"
+
+namespace x3 = boost::spirit::x3;
+
+struct length_tag;
+
+auto const set_length =
+    [](auto& ctx)
+    {
+        x3::get<length_tag>(ctx).get() = x3::_attr(ctx);
+    }
+;
+
+auto const get_length =
+    [](auto const& ctx)
+    {
+        return x3::get<length_tag>(ctx).get();
+    }
+;
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+
+    using x3::reserve_hint;
+    using x3::int_;
+    using x3::uint_;
+    using x3::omit;
+    using x3::with;
+    using x3::ascii::char_;
+    using x3::ascii::alpha;
+    using x3::ascii::alnum;
+
+    {   // fixed hint
+        std::vector<int> v;
+        BOOST_TEST(test_attr("1,2,3", reserve_hint(100)[int_ % ','], v));
+        BOOST_TEST(v.size() == 3);
+        BOOST_TEST(v.capacity() >= 100);
+    }
+
+    {   // the hint adds to what is already in the container
+        std::string s("abc");
+        BOOST_TEST(test_attr("de", reserve_hint(50)[+alpha], s));
+        BOOST_TEST(s == "abcde");
+        BOOST_TEST(s.capacity() >= 53);
+    }
+
+    {   // the hint does not limit the number of elements
+        std::string s;
+        BOOST_TEST(test_attr("abcdefgh", reserve_hint(2)[+alpha], s));
+        BOOST_TEST(s == "abcdefgh");
+    }
+
+    {   // no attribute, no reserve
+        BOOST_TEST(test("abc", reserve_hint(10)[+alpha]));
+    }
+
+    {   // hint from a length prefix
+        std::size_t length = 0;
+        std::string s;
+        auto p = with<length_tag>(std::ref(length))[
+                omit[uint_[set_length]] >> ':'
+            >>  reserve_hint(get_length)[*alnum]
+        ];
+        BOOST_TEST(test_attr("40:hello", p, s));
+        BOOST_TEST(s == "hello");
+        BOOST_TEST(length == 40);
+        BOOST_TEST(s.capacity() >= 40);
+    }
+
+    {   // inline capacity containers
+        typedef boost::container::small_vector<char, 16> small_string;
+        small_string s;
+        BOOST_TEST(test_attr("identifier", alpha >> *alnum, s));
+        BOOST_TEST(std::string(s.begin(), s.end()) == "identifier");
+
+        std::vector<small_string> v;
+        BOOST_TEST(test_attr("abc def", +alpha % ' ', v));
+        BOOST_TEST(v.size() == 2 && std::string(v[1].begin(), v[1].end()) == "def");
+    }
+
+    {   // fixed capacity containers fail the parse when full
+        typedef boost::container::static_vector<char, 4> fixed_string;
+        BOOST_TEST(x3::traits::is_fixed_capacity<fixed_string>::value);
+        BOOST_TEST(!x3::traits::is_fixed_capacity<std::string>::value);
+
+        fixed_string s;
+        BOOST_TEST(test_attr("abcd", +alpha, s));
+        BOOST_TEST(s.size() == 4);
+
+        s.clear();
+        BOOST_TEST(!test_attr("abcde", +alpha, s));
+
+        s.clear();
+        BOOST_TEST(test_attr("abcde", +alpha, s, false));
+        BOOST_TEST(s.size() == 4);
+
+        char const* in = "abcde";
+        char const* last = in + 5;
+        s.clear();
+        BOOST_TEST(x3::parse(in, last, +alpha, s));
+        BOOST_TEST(*in == 'e');     // the fifth char is not consumed
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,132 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/string/tst_snapshot.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+namespace
+{
+    typedef boost::spirit::x3::symbols<
+        char, int, boost::spirit::x3::tst_snapshot<char, int>>
+    snapshot_symbols;
+
+    std::string key(int i)
+    {
+        std::string s = std::to_string(i);
+        return "key" + std::string(3 - s.size(), '0') + s;
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+
+    { // basics
+        snapshot_symbols sym;
+
+        sym.add
+            ("Joel", 1)
+            ("Ruby", 2)
+            ("Tenji", 3)
+        ;
+
+        int i = 0;
+        BOOST_TEST((test_attr("Joel", sym, i)) && i == 1);
+        BOOST_TEST((test_attr("Tenji", sym, i)) && i == 3);
+        BOOST_TEST((!test("XXX", sym)));
+
+        sym.remove("Ruby");
+        BOOST_TEST((!test("Ruby", sym)));
+
+        sym.at("Kim") = 4;
+        BOOST_TEST((test_attr("Kim", sym, i)) && i == 4);
+
+        int n = 0;
+        sym.for_each([&](std::string const&, int) { ++n; });
+        BOOST_TEST(n == 3);
+    }
+
+    { // stress test: modify the symbols while other threads parse with them
+        int const keys = 64;
+        int const readers = 4;
+
+        snapshot_symbols sym;
+        for (int i = 0; i != keys; i += 2)
+            sym.add(key(i), i);
+
+        std::atomic<bool> done(false);
+        std::atomic<int> errors(0);
+        std::atomic<long> found(0);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t != readers; ++t)
+        {
+            threads.emplace_back([&]
+            {
+                std::vector<std::string> input;
+                for (int i = 0; i != keys; ++i)
+                    input.push_back(key(i) + ";");
+
+                long count = 0;
+                while (!done)
+                {
+                    for (int i = 0; i != keys; ++i)
+                    {
+                        std::string const& str = input[i];
+                        auto first = str.begin();
+                        int value = -1;
+                        if (boost::spirit::x3::parse(first, str.end(), sym, value))
+                        {
+                            if (value != i || *first != ';')
+                                ++errors;
+                            ++count;
+                        }
+                    }
+                }
+                found += count;
+            });
+        }
+
+        // the writer adds and removes the odd keys, and replaces all
+        // entries at once
+        for (int round = 0; round != 200; ++round)
+        {
+            for (int i = 1; i < keys; i += 2)
+                sym.add(key(i), i);
+            for (int i = 1; i < keys; i += 2)
+                sym.remove(key(i));
+
+            boost::spirit::x3::tst_snapshot<char, int> all;
+            for (int i = 0; i != keys; ++i)
+            {
+                std::string const k = key(i);
+                all.add(k.begin(), k.end(), i);
+            }
+            *sym.lookup = all;
+            sym.clear();
+            for (int i = 0; i != keys; i += 2)
+                sym.add(key(i), i);
+        }
+
+        done = true;
+        for (auto& thread : threads)
+            thread.join();
+
+        BOOST_TEST(errors == 0);
+        BOOST_TEST(found != 0);
+    }
+
+    return boost::report_errors();
+}
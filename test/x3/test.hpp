@@ -49,31 +49,31 @@ namespace spirit_test
         return !boost::spirit::x3::parse(in, last, p) && (in == start);
     }
 
-    //~ template <typename Char, typename Parser>
-    //~ bool binary_test(Char const* in, std::size_t size, Parser const& p,
-        //~ bool full_match = true)
-    //~ {
-        //~ // we don't care about the result of the "what" function.
-        //~ // we only care that all parsers have it:
-        //~ boost::spirit::x3::what(p);
+    template <typename Char, typename Parser>
+    bool binary_test(Char const* in, std::size_t size, Parser const& p,
+        bool full_match = true)
+    {
+        // we don't care about the result of the "what" function.
+        // we only care that all parsers have it:
+        boost::spirit::x3::what(p);
 
-        //~ Char const* last = in + size;
-        //~ return boost::spirit::qi::parse(in, last, p)
-            //~ && (!full_match || (in == last));
-    //~ }
+        Char const* last = in + size;
+        return boost::spirit::x3::parse(in, last, p)
+            && (!full_match || (in == last));
+    }
 
-    //~ template <typename Char, typename Parser, typename Skipper>
-    //~ bool binary_test(Char const* in, std::size_t size, Parser const& p,
-        //~ Skipper const& s, bool full_match = true)
-    //~ {
-        //~ // we don't care about the result of the "what" function.
-        //~ // we only care that all parsers have it:
-        //~ boost::spirit::x3::what(p);
+    template <typename Char, typename Parser, typename Skipper>
+    bool binary_test(Char const* in, std::size_t size, Parser const& p,
+        Skipper const& s, bool full_match = true)
+    {
+        // we don't care about the result of the "what" function.
+        // we only care that all parsers have it:
+        boost::spirit::x3::what(p);
 
-        //~ Char const* last = in + size;
-        //~ return boost::spirit::x3::phrase_parse(in, last, p, s)
-            //~ && (!full_match || (in == last));
-    //~ }
+        Char const* last = in + size;
+        return boost::spirit::x3::phrase_parse(in, last, p, s)
+            && (!full_match || (in == last));
+    }
 
     template <typename Char, typename Parser, typename Attr>
     bool test_attr(Char const* in, Parser const& p
@@ -97,31 +97,31 @@ namespace spirit_test
             && (!full_match || (in == last));
     }
 
-    //~ template <typename Char, typename Parser, typename Attr>
-    //~ bool binary_test_attr(Char const* in, std::size_t size, Parser const& p,
-        //~ Attr& attr, bool full_match = true)
-    //~ {
-        //~ // we don't care about the result of the "what" function.
-        //~ // we only care that all parsers have it:
-        //~ boost::spirit::x3::what(p);
+    template <typename Char, typename Parser, typename Attr>
+    bool binary_test_attr(Char const* in, std::size_t size, Parser const& p,
+        Attr& attr, bool full_match = true)
+    {
+        // we don't care about the result of the "what" function.
+        // we only care that all parsers have it:
+        boost::spirit::x3::what(p);
 
-        //~ Char const* last = in + size;
-        //~ return boost::spirit::x3::parse(in, last, p, attr)
-            //~ && (!full_match || (in == last));
-    //~ }
+        Char const* last = in + size;
+        return boost::spirit::x3::parse(in, last, p, attr)
+            && (!full_match || (in == last));
+    }
 
-    //~ template <typename Char, typename Parser, typename Attr, typename Skipper>
-    //~ bool binary_test_attr(Char const* in, std::size_t size, Parser const& p,
-        //~ Attr& attr, Skipper const& s, bool full_match = true)
-    //~ {
-        //~ // we don't care about the result of the "what" function.
-        //~ // we only care that all parsers have it:
-        //~ boost::spirit::x3::what(p);
+    template <typename Char, typename Parser, typename Attr, typename Skipper>
+    bool binary_test_attr(Char const* in, std::size_t size, Parser const& p,
+        Attr& attr, Skipper const& s, bool full_match = true)
+    {
+        // we don't care about the result of the "what" function.
+        // we only care that all parsers have it:
+        boost::spirit::x3::what(p);
 
-        //~ Char const* last = in + size;
-        //~ return boost::spirit::x3::phrase_parse(in, last, p, s, attr)
-            //~ && (!full_match || (in == last));
-    //~ }
+        Char const* last = in + size;
+        return boost::spirit::x3::phrase_parse(in, last, p, s, attr)
+            && (!full_match || (in == last));
+    }
 
     //~ struct printer
     //~ {
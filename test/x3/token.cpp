@@ -0,0 +1,191 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+    Copyright (c) 2001-2012 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/token/lexertl.hpp>
+#include <boost/fusion/include/std_pair.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <iostream>
+
+namespace lex = boost::spirit::lex;
+
+enum token_ids
+{
+    ID_KEYWORD_VAR = 1000,
+    ID_IDENTIFIER,
+    ID_INT,
+    ID_WS,
+    ID_ASSIGN = '=',
+    ID_SEMICOLON = ';'
+};
+
+template <typename Lexer>
+struct statement_tokens : lex::lexer<Lexer>
+{
+    statement_tokens()
+    {
+        this->self.add
+            ("var", ID_KEYWORD_VAR)
+            ("[a-zA-Z_][a-zA-Z_0-9]*", ID_IDENTIFIER)
+            ("[0-9]+", ID_INT)
+            ("[ \\t\\n]+", ID_WS)
+            ('=')
+            (';')
+        ;
+    }
+};
+
+// a token type with a plain value, using the default customization points
+struct simple_token
+{
+    int id() const { return id_; }
+    int const& value() const { return value_; }
+
+    int id_;
+    int value_;
+};
+
+// a base iterator counting how often the input is read
+struct counting_iterator
+  : boost::iterator_adaptor<counting_iterator, std::string::const_iterator>
+{
+    counting_iterator() {}
+
+    explicit counting_iterator(std::string::const_iterator it)
+      : counting_iterator::iterator_adaptor_(it) {}
+
+    static std::size_t reads;
+
+private:
+    friend class boost::iterator_core_access;
+
+    char const& dereference() const
+    {
+        ++reads;
+        return *this->base();
+    }
+};
+
+std::size_t counting_iterator::reads = 0;
+
+int
+main()
+{
+    using boost::spirit::x3::token;
+    using boost::spirit::x3::tokenize_into;
+    using boost::spirit::x3::phrase_parse;
+    using boost::spirit::x3::parse;
+    using boost::spirit::x3::what;
+
+    typedef std::string::const_iterator base_iterator;
+    typedef lex::lexertl::token<
+        base_iterator, boost::mpl::vector<std::string, int> > token_type;
+    typedef lex::lexertl::lexer<token_type> lexer_type;
+
+    statement_tokens<lexer_type> lexer;
+
+    {   // tokenize into a contiguous vector
+        std::string const input("var x = 42;");
+        base_iterator first = input.begin();
+        std::vector<token_type> tokens;
+        BOOST_TEST(tokenize_into(first, input.end(), lexer, tokens));
+        BOOST_TEST(first == input.end());
+        BOOST_TEST(tokens.size() == 8);
+    }
+
+    {   // token ids and values, skipping whitespace tokens
+        std::string const input("var x = 42;");
+        base_iterator first = input.begin();
+        std::vector<token_type> tokens;
+        BOOST_TEST(tokenize_into(first, input.end(), lexer, tokens));
+
+        std::pair<std::string, int> decl_attr;
+        auto decl =
+                token(ID_KEYWORD_VAR)
+            >>  token<std::string>(ID_IDENTIFIER)
+            >>  token(ID_ASSIGN)
+            >>  token<int>(ID_INT)
+            >>  token(ID_SEMICOLON)
+            ;
+
+        auto f = tokens.cbegin();
+        BOOST_TEST(phrase_parse(f, tokens.cend()
+          , decl, token(ID_WS), decl_attr));
+        BOOST_TEST(f == tokens.cend());
+        BOOST_TEST(decl_attr.first == "x");
+        BOOST_TEST(decl_attr.second == 42);
+    }
+
+    {   // backtracking only revisits tokens, the input isn't read again
+        typedef lex::lexertl::token<counting_iterator> counting_token_type;
+        statement_tokens<lex::lexertl::lexer<counting_token_type> >
+            counting_lexer;
+
+        std::string const input("x = 1; var y; var z = 2; var w;");
+        counting_iterator first(input.begin());
+        std::vector<counting_token_type> tokens;
+        BOOST_TEST(tokenize_into(first, counting_iterator(input.end())
+          , counting_lexer, tokens));
+        std::size_t const reads = counting_iterator::reads;
+        BOOST_TEST(reads != 0);
+
+        //  'var y;' fails as an initialized declaration only at ';'
+        auto assignment =
+            token(ID_IDENTIFIER) >> token(ID_ASSIGN) >> token(ID_INT) >> ';';
+        auto decl = token(ID_KEYWORD_VAR) >> assignment;
+        auto uninitialized_decl =
+            token(ID_KEYWORD_VAR) >> token(ID_IDENTIFIER) >> ';';
+        auto stmt = +(decl | uninitialized_decl | assignment);
+
+        auto f = tokens.cbegin();
+        BOOST_TEST(phrase_parse(f, tokens.cend(), stmt, token(ID_WS)));
+        BOOST_TEST(f == tokens.cend());
+        BOOST_TEST(counting_iterator::reads == reads);
+    }
+
+    {   // token id ranges
+        std::string const input("x 1");
+        base_iterator first = input.begin();
+        std::vector<token_type> tokens;
+        BOOST_TEST(tokenize_into(first, input.end(), lexer, tokens));
+
+        auto f = tokens.cbegin();
+        BOOST_TEST(phrase_parse(f, tokens.cend()
+          , +token(ID_IDENTIFIER, ID_INT), token(ID_WS)));
+        BOOST_TEST(f == tokens.cend());
+
+        f = tokens.cbegin();
+        BOOST_TEST(!parse(f, tokens.cend(), token(ID_INT)));
+        BOOST_TEST(f == tokens.cbegin());
+    }
+
+    {   // user defined token types
+        simple_token const tokens[] = { { 1, 10 }, { 2, 20 }, { 1, 30 } };
+        std::vector<int> values;
+
+        simple_token const* f = tokens;
+        BOOST_TEST(parse(f, tokens + 3
+          , token<int>(1) % token(2), values));
+        BOOST_TEST(f == tokens + 3);
+        BOOST_TEST(values.size() == 2);
+        BOOST_TEST(values[0] == 10 && values[1] == 30);
+    }
+
+    {
+        BOOST_TEST(what(token(ID_INT)) == "token(1002)");
+        BOOST_TEST(what(token(1, 3)) == "token(1, 3)");
+    }
+
+    return boost::report_errors();
+}
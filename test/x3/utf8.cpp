@@ -0,0 +1,124 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#define BOOST_SPIRIT_X3_UNICODE
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/utility/utf8_iterator.hpp>
+#include <boost/regex/pending/unicode_iterator.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace x3 = boost::spirit::x3;
+
+// checks the ASCII fast path of the unicode char classes against the
+// encoding's (ucd table based) classification
+template <typename Tag, typename Function>
+bool ascii_matches_ucd(Function f)
+{
+    for (x3::ucs4_char ch = 0; ch < 0x80; ++ch)
+    {
+        if (x3::unicode_char_class_base::is(Tag(), ch) != f(ch))
+        {
+            std::cout << "mismatch at " << ch << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int
+main()
+{
+    using x3::utf8_iterator;
+    using x3::utf8_find_invalid;
+    using x3::utf8_is_valid;
+    using x3::make_utf8_range;
+    typedef boost::spirit::char_encoding::unicode encoding;
+
+    {   // ASCII table vs. ucd tables
+        BOOST_TEST(ascii_matches_ucd<x3::alnum_tag>(&encoding::isalnum));
+        BOOST_TEST(ascii_matches_ucd<x3::alpha_tag>(&encoding::isalpha));
+        BOOST_TEST(ascii_matches_ucd<x3::digit_tag>(&encoding::isdigit));
+        BOOST_TEST(ascii_matches_ucd<x3::xdigit_tag>(&encoding::isxdigit));
+        BOOST_TEST(ascii_matches_ucd<x3::cntrl_tag>(&encoding::iscntrl));
+        BOOST_TEST(ascii_matches_ucd<x3::graph_tag>(&encoding::isgraph));
+        BOOST_TEST(ascii_matches_ucd<x3::lower_tag>(&encoding::islower));
+        BOOST_TEST(ascii_matches_ucd<x3::print_tag>(&encoding::isprint));
+        BOOST_TEST(ascii_matches_ucd<x3::punct_tag>(&encoding::ispunct));
+        BOOST_TEST(ascii_matches_ucd<x3::space_tag>(&encoding::isspace));
+        BOOST_TEST(ascii_matches_ucd<x3::blank_tag>(&encoding::isblank));
+        BOOST_TEST(ascii_matches_ucd<x3::upper_tag>(&encoding::isupper));
+        BOOST_TEST(ascii_matches_ucd<x3::alphabetic_tag>(&encoding::is_alphabetic));
+        BOOST_TEST(ascii_matches_ucd<x3::uppercase_tag>(&encoding::is_uppercase));
+        BOOST_TEST(ascii_matches_ucd<x3::lowercase_tag>(&encoding::is_lowercase));
+        BOOST_TEST(ascii_matches_ucd<x3::white_space_tag>(&encoding::is_white_space));
+        BOOST_TEST(ascii_matches_ucd<x3::hex_digit_tag>(&encoding::is_hex_digit));
+        BOOST_TEST(ascii_matches_ucd<x3::decimal_number_tag>(&encoding::is_decimal_number));
+    }
+
+    {   // decoding, compared with boost's u8_to_u32_iterator
+        std::string const s =
+            "ascii \xC3\xA9t\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 end of a longer ascii run";
+        typedef boost::u8_to_u32_iterator<std::string::const_iterator> u32_iterator;
+        u32_iterator ref(s.begin(), s.begin(), s.end());
+        u32_iterator ref_end(s.end(), s.begin(), s.end());
+
+        x3::utf8_range r = make_utf8_range(s);
+        utf8_iterator i = r.begin();
+        for (; i != r.end() && ref != ref_end; ++i, ++ref)
+            BOOST_TEST(*i == *ref);
+        BOOST_TEST(i == r.end() && ref == ref_end);
+        BOOST_TEST(r.end().base() == s.data() + s.size());
+    }
+
+    {   // validation
+        std::string const good =
+            "0123456789abcdef\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF"
+            "\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF 0123456789";
+        BOOST_TEST(utf8_is_valid(good.data(), good.data() + good.size()));
+
+        char const* bad[] =
+        {
+            "0123456789\x80",           // stray continuation byte
+            "0123456789\xC0\xAF",       // overlong
+            "0123456789\xE0\x80\xAF",   // overlong
+            "0123456789\xED\xA0\x80",   // surrogate
+            "0123456789\xF4\x90\x80\x80",// above U+10FFFF
+            "0123456789\xF5\x80\x80\x80",// invalid lead byte
+            "0123456789\xE2\x82",       // truncated
+            "0123456789\xE2\x28\xA1"    // bad continuation
+        };
+        for (std::size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); ++i)
+        {
+            char const* last = bad[i] + std::strlen(bad[i]);
+            BOOST_TEST(utf8_find_invalid(bad[i], last) == bad[i] + 10);
+        }
+    }
+
+    {   // parsing
+        using namespace x3::unicode;
+        std::string const s = "gr\xC3\xBC\xC3\x9F  \xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5 world";
+        x3::utf8_range r = make_utf8_range(s);
+
+        std::vector<std::basic_string<x3::ucs4_char>> words;
+        utf8_iterator f = r.begin();
+        BOOST_TEST(x3::phrase_parse(f, r.end(), +x3::lexeme[+alpha], space, words));
+        BOOST_TEST(f == r.end());
+        BOOST_TEST(words.size() == 3);
+        BOOST_TEST(words[1].size() == 5 && words[1][0] == 0x3BA);
+
+        f = r.begin();
+        BOOST_TEST(x3::parse(f, r.end(), +lower));
+        BOOST_TEST(f.base() == s.data() + 6);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,68 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_TEST_ALLOCATION_COUNTER_HPP)
+#define BOOST_SPIRIT_TEST_ALLOCATION_COUNTER_HPP
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Counts the heap allocations made through the global operator new by
+//  replacing it. Like measure.hpp this is meant to be included by the
+//  single translation unit of a benchmark executable.
+//
+//      std::size_t before = test::allocations;
+//      ... parse ...
+//      std::size_t count = test::allocations - before;
+//
+///////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace test
+{
+    std::size_t allocations = 0;
+
+    inline void* counted_allocate(std::size_t size)
+    {
+        ++allocations;
+        if (void* p = std::malloc(size ? size : 1))
+            return p;
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return test::counted_allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return test::counted_allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif
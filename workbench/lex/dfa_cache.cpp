@@ -0,0 +1,243 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  The startup time of a lexer with about 400 token definitions (keywords,
+//  operators and literals): building (and minimizing) its DFA at runtime,
+//  compared to loading the DFA saved by lexer::save_dfa, from memory and
+//  from a memory mapped file. Loading includes hashing the token
+//  definitions. Checks that the loaded lexers produce the same tokens.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    char const* const syllables[] =
+    {
+        "al", "be", "co", "de", "ex", "fu", "ga", "ho", "in", "jo", "ka",
+        "lu", "mo", "ne", "or", "pa", "qu", "ri", "st", "tu"
+    };
+    std::size_t const keyword_count = 360;
+
+    std::string keyword(std::size_t i)
+    {
+        return std::string(syllables[i % 20]) + syllables[(i / 20) % 20]
+            + syllables[(i * 7 + 3) % 20];
+    }
+
+    char const* const operators[] =
+    {
+        "\"...\"", "\">>=\"", "\"<<=\"", "\"+=\"", "\"-=\"", "\"*=\"",
+        "\"/=\"", "\"%=\"", "\"&=\"", "\"^=\"", "\"|=\"", "\">>\"", "\"<<\"",
+        "\"++\"", "\"--\"", "\"->\"", "\"&&\"", "\"||\"", "\"<=\"", "\">=\"",
+        "\"==\"", "\"!=\"", "\";\"", "\"{\"", "\"}\"", "\",\"", "\":\"",
+        "\"=\"", "\"(\"", "\")\"", "\"[\"", "\"]\"", "\".\"", "\"&\"",
+        "\"!\"", "\"~\"", "\"-\"", "\"+\"", "\"*\"", "\"/\"", "\"%\"",
+        "\"<\"", "\">\"", "\"^\"", "\"|\"", "\"?\""
+    };
+
+    template <typename Lexer>
+    struct tokens : lex::lexer<Lexer>
+    {
+        tokens()
+        {
+            this->self.add_pattern
+                ("D", "[0-9]")
+                ("L", "[a-zA-Z_]")
+                ("H", "[a-fA-F0-9]")
+                ("E", "[Ee][-+]?{D}+")
+                ("IS", "([uU]|[lL]|[uU][lL]|[lL][uU]|[lL][lL]|[uU][lL][lL])")
+                ("FS", "[fFlL]")
+            ;
+
+            std::size_t id = lex::min_token_id;
+            for (std::size_t i = 0; i != keyword_count; ++i)
+                this->self.add(keyword(i), id++);
+
+            this->self.add("{L}({L}|{D})*", id++);
+            this->self.add("0[xX]{H}+{IS}?", id++);
+            this->self.add("0[0-7]*{IS}?", id++);
+            this->self.add("[1-9]{D}*{IS}?", id++);
+            this->self.add("L?'(\\\\.|[^\\\\'\\n])+'", id++);
+            this->self.add("{D}+{E}{FS}?", id++);
+            this->self.add("{D}*\\.{D}+({E})?{FS}?", id++);
+            this->self.add("{D}+\\.{D}*({E})?{FS}?", id++);
+            this->self.add("L?\\\"(\\\\.|[^\\\\\"\\n])*\\\"", id++);
+            this->self.add("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]", id++);
+            this->self.add("[/][/][^\\n]*", id++);
+
+            for (std::size_t i = 0; i != sizeof(operators)/sizeof(operators[0]); ++i)
+                this->self.add(operators[i], id++);
+
+            this->self.add("[ \\t\\v\\n\\f]+", id++);
+        }
+    };
+
+    typedef std::string::const_iterator base_iterator_type;
+    typedef lexertl::lexer<lexertl::token<base_iterator_type> > lexer_type;
+
+    std::string input()
+    {
+        std::string input;
+        for (std::size_t i = 0; i != 4 * keyword_count; ++i)
+        {
+            char buffer[64];
+            std::sprintf(buffer, " x%u += 0x%xu; /* %u */ \"s\" <<= 1.5e3\n"
+              , unsigned(i), unsigned(i), unsigned(i));
+            input += keyword(i % keyword_count) + buffer;
+        }
+        return input;
+    }
+
+    std::size_t tokenize(lexer_type& lexer, std::string const& input
+      , std::size_t& checksum)
+    {
+        base_iterator_type first = input.begin();
+        lexer_type::iterator_type it = lexer.begin(first, input.end());
+        lexer_type::iterator_type end = lexer.end();
+
+        std::size_t n = 0;
+        for (/**/; it != end && token_is_valid(*it); ++it, ++n)
+            checksum += it->id() * (n + 1);
+        return (it == end) ? n : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  the saved DFA in memory aligned to 8 bytes, as a file would be mapped
+    struct buffer
+    {
+        explicit buffer(std::string const& data)
+          : size(data.size()), words((data.size() + 7) / 8 + 1, 0)
+        {
+            std::copy(data.begin(), data.end()
+              , reinterpret_cast<char*>(&words.front()));
+        }
+
+        void const* data() const { return &words.front(); }
+
+        std::size_t size;
+        std::vector<boost::uint64_t> words;
+    };
+
+    void report(char const* name, double elapsed, int repeats)
+    {
+        std::cout.precision(3);
+        std::cout << name << ": " << std::fixed
+            << elapsed / repeats * 1e3 << " [ms]" << std::endl;
+    }
+}
+
+int main()
+{
+    char const* const filename = "dfa_cache.bin";
+    std::string const text = input();
+
+    // build the DFA at runtime, the way the lexer does without a saved DFA
+    int const build_repeats = 5;
+    util::high_resolution_timer build_time;
+    for (int i = 0; i != build_repeats; ++i)
+    {
+        tokens<lexer_type> lexer;
+        lexer.init_dfa(true);
+    }
+    double const build_elapsed = build_time.elapsed();
+
+    std::size_t checksum1 = 0;
+    std::string saved;
+    {
+        tokens<lexer_type> lexer;
+        std::ostringstream os(std::ios::out | std::ios::binary);
+        if (!lexer.save_dfa(os))
+        {
+            std::cout << "could not save the DFA" << std::endl;
+            return -1;
+        }
+        saved = os.str();
+
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file << saved;
+        if (!file.good())
+        {
+            std::cout << "could not write " << filename << std::endl;
+            return -1;
+        }
+        tokenize(lexer, text, checksum1);
+    }
+
+    // load the DFA from memory
+    int const load_repeats = 200;
+    buffer const memory(saved);
+    std::size_t checksum2 = 0;
+    util::high_resolution_timer memory_time;
+    for (int i = 0; i != load_repeats; ++i)
+    {
+        tokens<lexer_type> lexer;
+        if (!lexer.load_dfa(memory.data(), memory.size))
+        {
+            std::cout << "could not load the DFA" << std::endl;
+            return -1;
+        }
+        if (i == 0)
+            tokenize(lexer, text, checksum2);
+    }
+    double const memory_elapsed = memory_time.elapsed();
+
+    // map the file and load the DFA from there
+    std::size_t checksum3 = 0;
+    util::high_resolution_timer mapped_time;
+    for (int i = 0; i != load_repeats; ++i)
+    {
+        boost::iostreams::mapped_file_source file(filename);
+        tokens<lexer_type> lexer;
+        if (!lexer.load_dfa(file.data(), file.size()))
+        {
+            std::cout << "could not load the DFA from " << filename
+                << std::endl;
+            return -1;
+        }
+        if (i == 0)
+            tokenize(lexer, text, checksum3);
+    }
+    double const mapped_elapsed = mapped_time.elapsed();
+
+    // the token definitions alone
+    util::high_resolution_timer definitions_time;
+    for (int i = 0; i != load_repeats; ++i)
+        tokens<lexer_type> lexer;
+    double const definitions_elapsed = definitions_time.elapsed();
+
+    std::remove(filename);
+
+    if (checksum1 == 0 || checksum1 != checksum2 || checksum1 != checksum3)
+    {
+        std::cout << "the lexers disagree" << std::endl;
+        return -1;
+    }
+
+    std::cout << "saved DFA: " << saved.size() << " [bytes]" << std::endl;
+    report("token definitions only    ", definitions_elapsed, load_repeats);
+    report("build and minimize the DFA", build_elapsed, build_repeats);
+    report("load the DFA from memory  ", memory_elapsed, load_repeats);
+    report("load the DFA from a file  ", mapped_elapsed, load_repeats);
+    return 0;
+}
@@ -0,0 +1,233 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  The latency of keeping the tokens of 5 MB (or the number of MB given on
+//  the command line) of C-like source up to date while typing: after
+//  every single character inserted into or erased from the source, its
+//  tokens are updated with lexer::retokenize, or tokenized again as a
+//  whole with lexer::tokenize. Reports the average, the median and the
+//  worst time per edit, and checks that the tokens are the same in the end.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    struct tokens : lex::lexer<Lexer>
+    {
+        tokens()
+        {
+            this->self.add
+                ("[a-zA-Z_][a-zA-Z_0-9]*")
+                ("[0-9]+")
+                ("[-+*/%<>=!&|^~?:;,.(){}\\[\\]]|<<|>>|<=|>=|==|!=|&&|[|][|]"
+                 "|[-+*/%&|^]=|<<=|>>=|[+][+]|--|->")
+                ("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]|[/][/][^\\n]*")
+                ("\\\"(\\\\.|[^\\\\\"\\n])*\\\"")
+                ("[ \\t\\n]+")
+            ;
+        }
+    };
+
+    typedef std::string::const_iterator base_iterator_type;
+    typedef lexertl::token<base_iterator_type> token_type;
+    typedef lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type> tokens_type;
+
+    std::string c_input(std::size_t size)
+    {
+        char const* const chunk =
+            "/* compute the checksum of a block of memory, the slow way */\n"
+            "static unsigned long checksum%d(unsigned char const* p, int n)\n"
+            "{\n"
+            "    unsigned long sum = %d; // seed\n"
+            "    for (int i = 0; i < n; ++i)\n"
+            "    {\n"
+            "        sum = (sum << 5) + sum + p[i] * %d;\n"
+            "        if (sum >= 15000 && p[i] != 10)\n"
+            "            sum ^= sum >> 3;\n"
+            "    }\n"
+            "    printf(\"checksum %%lu of %%d bytes\\n\", sum, n);\n"
+            "    return sum %% 4294967291;\n"
+            "}\n\n";
+
+        std::string input;
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[1024];
+            std::sprintf(buffer, chunk, i, i * 7919, i % 97);
+            input += buffer;
+        }
+        return input;
+    }
+
+    //  the edits typed: inserting a character at a random position and
+    //  erasing it again, or erasing a character and inserting it again
+    struct edit
+    {
+        std::size_t offset;
+        std::size_t erased;
+        std::size_t inserted;
+        char character;
+    };
+
+    std::vector<edit> typing(std::string const& input, std::size_t count)
+    {
+        char const characters[] = "x1 (*/\"\n";
+
+        std::vector<edit> edits;
+        unsigned int seed = 42;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            std::size_t const offset = (seed >> 4) % input.size();
+            seed = seed * 1103515245u + 12345u;
+
+            edit e = { offset, 0, 1
+              , characters[(seed >> 8) % (sizeof(characters) - 1)] };
+            edit undo = { offset, 1, 0, 0 };
+            if ((seed >> 16) % 2)
+            {
+                std::swap(e, undo);
+                undo.character = input[offset];
+            }
+            edits.push_back(e);
+            edits.push_back(undo);
+        }
+        return edits;
+    }
+
+    void apply(std::string& input, edit const& e)
+    {
+        if (e.erased)
+            input.erase(e.offset, 1);
+        else
+            input.insert(e.offset, 1, e.character);
+    }
+
+    struct latency
+    {
+        latency() : total(0), worst(0), tokens(0) {}
+
+        void add(double elapsed, std::size_t changed)
+        {
+            times.push_back(elapsed);
+            total += elapsed;
+            if (elapsed > worst)
+                worst = elapsed;
+            tokens += changed;
+        }
+
+        double median()
+        {
+            std::nth_element(times.begin(), times.begin() + times.size() / 2
+              , times.end());
+            return times[times.size() / 2];
+        }
+
+        std::vector<double> times;
+        double total;
+        double worst;
+        std::size_t tokens;
+    };
+
+    void report(char const* name, latency& l, std::size_t edits)
+    {
+        std::cout.precision(1);
+        std::cout << name << ": " << std::fixed
+            << l.total / edits * 1e6 << " [us] per edit, median "
+            << l.median() * 1e6 << " [us], worst " << l.worst * 1e6
+            << " [us]";
+        if (l.tokens)
+        {
+            std::cout.precision(2);
+            std::cout << ", " << double(l.tokens) / edits
+                << " tokens matched";
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t const mb = (argc > 1) ? std::atoi(argv[1]) : 5;
+
+    tokens_type tok;
+    std::string input = c_input(mb * 1024 * 1024);
+    std::vector<edit> const edits = typing(input, 200);
+
+    //  the tokens after every edit, tokenizing all of the input
+    std::string text = input;
+    std::vector<lexertl::compact_token> all;
+    all.reserve(text.size() / 2);
+    tok.tokenize(text.begin(), text.end(), all);
+
+    latency full;
+    for (std::size_t i = 0; i != edits.size(); ++i)
+    {
+        apply(text, edits[i]);
+
+        util::high_resolution_timer time;
+        all.clear();
+        tok.tokenize(text.begin(), text.end(), all);
+        full.add(time.elapsed(), 0);
+    }
+
+    //  updating the tokens after every edit
+    lexertl::incremental_tokens incremental;
+    util::high_resolution_timer time;
+    tok.tokenize(input.begin(), input.end(), incremental);
+    double const initial = time.elapsed();
+
+    latency updated;
+    for (std::size_t i = 0; i != edits.size(); ++i)
+    {
+        apply(input, edits[i]);
+
+        util::high_resolution_timer time;
+        lexertl::changed_tokens const changed = tok.retokenize(input.begin()
+          , input.end(), incremental, edits[i].offset, edits[i].erased
+          , edits[i].inserted);
+        updated.add(time.elapsed(), changed.inserted);
+    }
+
+    std::vector<lexertl::compact_token> const& tokens = incremental.tokens();
+    bool same = tokens.size() == all.size();
+    for (std::size_t i = 0; same && i != tokens.size(); ++i)
+    {
+        same = tokens[i].id == all[i].id && tokens[i].state == all[i].state
+            && tokens[i].offset == all[i].offset
+            && tokens[i].length == all[i].length;
+    }
+    if (!same)
+    {
+        std::cout << "the tokens differ" << std::endl;
+        return -1;
+    }
+
+    std::cout << edits.size() << " edits of " << input.size() << " bytes, "
+        << tokens.size() << " tokens, tokenized initially in "
+        << initial * 1e3 << " [ms]" << std::endl;
+    report("tokenize    ", full, edits.size());
+    report("retokenize  ", updated, edits.size());
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Parsing 100 MB (or the number of MB given on the command line) of
+//  simple statements with a backtracking Qi grammar, using
+//
+//    - the lexer iterator, whose tokens convert their value once,
+//    - the token_vector_iterator over the compact tokens stored by
+//      lexer::tokenize, constructing a full token (and converting its
+//      value) on every access,
+//    - the lazy_token_iterator over the same compact tokens, converting
+//      the values on first use and caching them in a side table, which
+//      holds either all values or only the last 1024 of them.
+//
+//  Reports the throughput in tokens/s and the memory needed for storing
+//  the tokens.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_stl.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    struct tokens : lex::lexer<Lexer>
+    {
+        tokens()
+        {
+            identifier = "[a-zA-Z_][a-zA-Z_0-9]*";
+            number = "[0-9]+";
+            white_space = "[ \\t\\n]+";
+
+            this->self = identifier | number | white_space
+                | '=' | ';' | '(' | ')' | ',';
+        }
+
+        lex::token_def<std::string> identifier;
+        lex::token_def<unsigned int> number;
+        lex::token_def<lex::omit> white_space;
+    };
+
+    typedef std::string::const_iterator base_iterator_type;
+    typedef lexertl::token<base_iterator_type
+      , boost::mpl::vector<std::string, unsigned int> > token_type;
+    typedef lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type> tokens_type;
+
+    std::string statements(std::size_t size)
+    {
+        char const* const chunk =
+            "counter%d = %d;\n"
+            "total_of_all%d = counter%d;\n"
+            "print(total_of_all%d, %d);\n";
+
+        std::string input;
+        input.reserve(size + 256);
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[256];
+            std::sprintf(buffer, chunk, i % 1000, i, i % 1000, i % 1000
+              , i % 1000, i % 97);
+            input += buffer;
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  the statements are told apart by backtracking, the identifier at
+    //  their start is converted up to three times (unless cached)
+    template <typename Iterator>
+    bool parse(tokens_type const& tok, Iterator first, Iterator const& last
+      , std::size_t& sum)
+    {
+        using boost::phoenix::ref;
+        using boost::phoenix::size;
+        using qi::_1;
+
+        bool const r = qi::phrase_parse(first, last
+          , *(  (   tok.identifier[ref(sum) += size(_1)]
+                 >> qi::token('=') >> tok.number[ref(sum) += _1]
+                 >> qi::token(';')
+                )
+              | (   tok.identifier[ref(sum) += size(_1)]
+                 >> qi::token('=') >> tok.identifier[ref(sum) += size(_1)]
+                 >> qi::token(';')
+                )
+              | (   tok.identifier[ref(sum) += size(_1)]
+                 >> qi::token('(') >> tok.identifier[ref(sum) += size(_1)]
+                 >> qi::token(',') >> tok.number[ref(sum) += _1]
+                 >> qi::token(')') >> qi::token(';')
+                )
+             )
+          , tok.white_space);
+        return r && first == last;
+    }
+
+    std::vector<lexertl::compact_token> compact_tokens;
+
+    double iterate_parse(tokens_type const& tok, std::string const& input
+      , std::size_t& sum)
+    {
+        util::high_resolution_timer time;
+
+        base_iterator_type first = input.begin();
+        if (!parse(tok, tok.begin(first, input.end()), tok.end(), sum))
+            sum = 0;
+        return time.elapsed();
+    }
+
+    double tokenize_parse(tokens_type const& tok, std::string const& input
+      , std::size_t& sum)
+    {
+        typedef tokens_type::token_vector_iterator_type iterator_type;
+
+        util::high_resolution_timer time;
+
+        compact_tokens.clear();
+        if (!tok.tokenize(input.begin(), input.end(), compact_tokens) ||
+            !parse(tok, iterator_type(input.begin(), compact_tokens.begin())
+              , iterator_type(input.begin(), compact_tokens.end()), sum))
+        {
+            sum = 0;
+        }
+        return time.elapsed();
+    }
+
+    //  the size of the value cache after parsing
+    std::size_t cached_values = 0;
+
+    template <std::size_t MaxSize>
+    double tokenize_parse_lazy(tokens_type const& tok
+      , std::string const& input, std::size_t& sum)
+    {
+        typedef tokens_type::lazy_token_iterator_type iterator_type;
+
+        util::high_resolution_timer time;
+
+        compact_tokens.clear();
+        tokens_type::token_value_cache_type values(compact_tokens, MaxSize);
+        if (!tok.tokenize(input.begin(), input.end(), compact_tokens) ||
+            !parse(tok
+              , iterator_type(input.begin(), compact_tokens.begin(), values)
+              , iterator_type(input.begin(), compact_tokens.end(), values)
+              , sum))
+        {
+            sum = 0;
+        }
+        cached_values = values.size();
+        return time.elapsed();
+    }
+
+    //  the best of a few runs, as the timings of a single run of a
+    //  parser over a large input vary a lot
+    int const repeats = 3;
+
+    template <typename F>
+    double measure(F f, tokens_type const& tok, std::string const& input
+      , std::size_t& sum)
+    {
+        double best = 0;
+        for (int i = 0; i != repeats; ++i)
+        {
+            sum = 0;
+            double const elapsed = f(tok, input, sum);
+            if (i == 0 || elapsed < best)
+                best = elapsed;
+        }
+        return best;
+    }
+
+    void report(char const* name, std::size_t tokens, double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": " << std::fixed
+            << tokens / elapsed / 1e6 << " [Mtokens/s]" << std::endl;
+    }
+
+    void report_memory(char const* name, std::size_t bytes)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": " << std::fixed
+            << bytes / (1024. * 1024.) << " [MB]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t const mb = (argc > 1) ? std::atoi(argv[1]) : 100;
+
+    tokens_type tok;
+    std::string const input = statements(mb * 1024 * 1024);
+    compact_tokens.reserve(input.size() / 3);
+
+    std::size_t sum1 = 0, sum2 = 0, sum3 = 0, sum4 = 0;
+    double const elapsed1 = measure(&iterate_parse, tok, input, sum1);
+    double const elapsed2 = measure(&tokenize_parse, tok, input, sum2);
+    double const elapsed3 =
+        measure(&tokenize_parse_lazy<0>, tok, input, sum3);
+    std::size_t const all_values = cached_values;
+    double const elapsed4 =
+        measure(&tokenize_parse_lazy<1024>, tok, input, sum4);
+
+    if (sum1 == 0 || sum1 != sum2 || sum1 != sum3 || sum1 != sum4)
+    {
+        std::cout << "the results differ" << std::endl;
+        return -1;
+    }
+
+    typedef std::pair<boost::uint32_t
+      , tokens_type::token_value_cache_type::value_type> entry_type;
+    std::size_t const count = compact_tokens.size();
+
+    std::cout << count << " tokens in " << input.size() << " bytes, "
+        << all_values << " values converted" << std::endl;
+    report("lexer iterator                 ", count, elapsed1);
+    report("token_vector_iterator          ", count, elapsed2);
+    report("lazy_token_iterator (all)      ", count, elapsed3);
+    report("lazy_token_iterator (1024)     ", count, elapsed4);
+
+    report_memory("vector of lexertl::token       ", count * sizeof(token_type));
+    report_memory("vector of compact_token        "
+      , count * sizeof(lexertl::compact_token));
+    report_memory("value cache (all)              "
+      , all_values * sizeof(entry_type));
+    report_memory("value cache (1024)             "
+      , cached_values * sizeof(entry_type));
+    return 0;
+}
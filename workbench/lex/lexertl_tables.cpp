@@ -0,0 +1,209 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Tokenizing a few MB of C-like source with the tables of lexertl (a
+//  std::size_t per cell, the state columns interleaved with the transitions)
+//  and with the packed tables the dynamic lexer uses (see
+//  packed_state_machine.hpp). Reports the size of both tables and the
+//  throughput in tokens/s.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    char const* const keywords[] =
+    {
+        "auto", "break", "case", "char", "const", "continue", "default", "do",
+        "double", "else", "enum", "extern", "float", "for", "goto", "if",
+        "inline", "int", "long", "register", "restrict", "return", "short",
+        "signed", "sizeof", "static", "struct", "switch", "typedef", "union",
+        "unsigned", "void", "volatile", "while", "_Bool", "_Complex",
+        "_Imaginary", "_Alignas", "_Alignof", "_Atomic", "_Generic",
+        "_Noreturn", "_Static_assert", "_Thread_local"
+    };
+
+    char const* const operators[] =
+    {
+        "\"...\"", "\">>=\"", "\"<<=\"", "\"+=\"", "\"-=\"", "\"*=\"",
+        "\"/=\"", "\"%=\"", "\"&=\"", "\"^=\"", "\"|=\"", "\">>\"", "\"<<\"",
+        "\"++\"", "\"--\"", "\"->\"", "\"&&\"", "\"||\"", "\"<=\"", "\">=\"",
+        "\"==\"", "\"!=\"", "\";\"", "\"{\"", "\"}\"", "\",\"", "\":\"",
+        "\"=\"", "\"(\"", "\")\"", "\"[\"", "\"]\"", "\".\"", "\"&\"",
+        "\"!\"", "\"~\"", "\"-\"", "\"+\"", "\"*\"", "\"/\"", "\"%\"",
+        "\"<\"", "\">\"", "\"^\"", "\"|\"", "\"?\""
+    };
+
+    void c_rules(boost::lexer::rules& rules)
+    {
+        rules.add_macro("D", "[0-9]");
+        rules.add_macro("L", "[a-zA-Z_]");
+        rules.add_macro("H", "[a-fA-F0-9]");
+        rules.add_macro("E", "[Ee][-+]?{D}+");
+        rules.add_macro("IS", "([uU]|[lL]|[uU][lL]|[lL][uU]|[lL][lL]|[uU][lL][lL])");
+        rules.add_macro("FS", "[fFlL]");
+
+        std::size_t id = 1;
+        for (std::size_t i = 0; i != sizeof(keywords)/sizeof(keywords[0]); ++i)
+            rules.add(keywords[i], id++);
+
+        rules.add("{L}({L}|{D})*", id++);
+        rules.add("0[xX]{H}+{IS}?", id++);
+        rules.add("0[0-7]*{IS}?", id++);
+        rules.add("[1-9]{D}*{IS}?", id++);
+        rules.add("L?'(\\\\.|[^\\\\'\\n])+'", id++);
+        rules.add("{D}+{E}{FS}?", id++);
+        rules.add("{D}*\\.{D}+({E})?{FS}?", id++);
+        rules.add("{D}+\\.{D}*({E})?{FS}?", id++);
+        rules.add("L?\\\"(\\\\.|[^\\\\\"\\n])*\\\"", id++);
+        rules.add("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]", id++);
+        rules.add("[/][/][^\\n]*", id++);
+        rules.add("^#[ \\t]*{L}+[^\\n]*", id++);
+
+        for (std::size_t i = 0; i != sizeof(operators)/sizeof(operators[0]); ++i)
+            rules.add(operators[i], id++);
+
+        rules.add("[ \\t\\v\\n\\f]+", id++);
+    }
+
+    std::string c_input(std::size_t size)
+    {
+        char const* const chunk =
+            "#include <stdio.h>\n"
+            "/* compute the checksum of a block of memory, the slow way */\n"
+            "static unsigned long checksum%d(unsigned char const* p, int n)\n"
+            "{\n"
+            "    unsigned long sum = 0x%xUL; // seed\n"
+            "    for (int i = 0; i < n; ++i)\n"
+            "    {\n"
+            "        sum = (sum << 5) + sum + p[i] * %d;\n"
+            "        if (sum >= 1.5e%d && p[i] != '\\n')\n"
+            "            sum ^= sum >> 3;\n"
+            "    }\n"
+            "    printf(\"checksum %%lu of %%d bytes\\n\", sum, n);\n"
+            "    return sum %% 4294967291u;\n"
+            "}\n\n";
+
+        std::string input;
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[1024];
+            std::sprintf(buffer, chunk, i, i * 7919, i % 97, i % 300);
+            input += buffer;
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    typedef std::string::const_iterator iterator_type;
+    typedef lexertl::basic_iterator_tokeniser<iterator_type> tokenizer;
+
+    template <typename StateMachine>
+    std::size_t tokenize(StateMachine const& sm, std::string const& input
+      , std::size_t& checksum)
+    {
+        std::size_t state = 0;
+        bool bol = true;
+        iterator_type first = input.begin();
+        iterator_type const last = input.end();
+
+        std::size_t tokens = 0;
+        for (;;)
+        {
+            std::size_t unique_id = 0;
+            std::size_t const id =
+                tokenizer::next(sm, state, bol, first, last, unique_id);
+            if (id == 0 || id == boost::lexer::npos)
+                break;
+            checksum += id;
+            ++tokens;
+        }
+        return first == last ? tokens : 0;
+    }
+
+    int const repeats = 20;
+
+    template <typename StateMachine>
+    double measure(StateMachine const& sm, std::string const& input
+      , std::size_t& tokens, std::size_t& checksum)
+    {
+        tokenize(sm, input, checksum);       // warm up
+
+        util::high_resolution_timer time;
+        for (int i = 0; i != repeats; ++i)
+            tokens = tokenize(sm, input, checksum);
+        return time.elapsed();
+    }
+
+    std::size_t table_size(boost::lexer::state_machine const& sm)
+    {
+        boost::lexer::detail::internals const& internals = sm.data();
+        std::size_t size = 0;
+        for (std::size_t i = 0; i != internals._dfa->size(); ++i)
+        {
+            size += (internals._lookup[i]->size() + internals._dfa[i]->size())
+                * sizeof(std::size_t);
+        }
+        return size;
+    }
+
+    void report(char const* name, std::size_t size, std::size_t tokens
+      , double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": table size: " << size << " [bytes], "
+            << std::fixed << repeats * tokens / elapsed / 1e6
+            << " [Mtokens/s]" << std::endl;
+    }
+}
+
+int main()
+{
+    boost::lexer::rules rules;
+    c_rules(rules);
+
+    boost::lexer::state_machine sm;
+    boost::lexer::generator::build(rules, sm);
+    boost::lexer::generator::minimise(sm);
+
+    lexertl::packed_state_machine<char> packed(sm);
+
+    std::cout << "DFA: " << packed[0].states() << " states, "
+        << packed[0].columns() << " columns, "
+        << packed[0].width() << " byte state indices" << std::endl;
+
+    std::string const input = c_input(4 * 1024 * 1024);
+    std::size_t checksum1 = 0, checksum2 = 0;
+    std::size_t tokens1 = 0, tokens2 = 0;
+
+    double const elapsed1 = measure(sm, input, tokens1, checksum1);
+    double const elapsed2 = measure(packed, input, tokens2, checksum2);
+
+    if (tokens1 == 0 || tokens1 != tokens2 || checksum1 != checksum2)
+    {
+        std::cout << "the tokenizers disagree" << std::endl;
+        return -1;
+    }
+
+    std::cout << tokens1 << " tokens in " << input.size() << " bytes"
+        << std::endl;
+    report("lexertl", table_size(sm), tokens1, elapsed1);
+    report("packed ", packed.table_size(), tokens2, elapsed2);
+    return 0;
+}
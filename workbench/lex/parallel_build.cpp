@@ -0,0 +1,152 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  The startup cost of a lexer for a template language with 30 lexer
+//  states and a few thousand token definitions: building (and minimising)
+//  the DFAs of all states one after the other, and concurrently with
+//  build_parallel using 2, 4 and one thread per hardware thread. Checks
+//  that all of them generate the same DFAs.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/home/lex/lexer/lexertl/parallel_build.hpp>
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  every state has the common tokens of the language, keywords and
+    //  a few states of their own, the first ones (the markup and the code
+    //  of the templates) having by far the most token definitions
+    std::size_t const states = 30;
+
+    std::size_t template_rules(boost::lexer::rules& rules)
+    {
+        rules.add_macro("D", "[0-9]");
+        rules.add_macro("L", "[a-zA-Z_]");
+        rules.add_macro("H", "[a-fA-F0-9]");
+
+        char name[64];
+        for (std::size_t s = 1; s != states; ++s)
+        {
+            std::sprintf(name, "S%u", unsigned(s));
+            rules.add_state(name);
+        }
+
+        std::size_t count = 0;
+        for (std::size_t s = 0; s != states; ++s)
+        {
+            std::string state("INITIAL");
+            if (s != 0)
+            {
+                std::sprintf(name, "S%u", unsigned(s));
+                state = name;
+            }
+            char const* const st = state.c_str();
+
+            std::size_t id = 1;
+            rules.add(st, "{L}({L}|{D})*", id++, st);
+            rules.add(st, "0[xX]{H}+|{D}+([.]{D}*)?([eE][-+]?{D}+)?", id++, st);
+            rules.add(st, "\\\"(\\\\.|[^\\\\\"\\n])*\\\"", id++, st);
+            rules.add(st, "[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]", id++, st);
+            rules.add(st, "[ \\t\\n]+", id++, st);
+            rules.add(st, "[-+*/%<>=!&|^~?:;,.(){}\\[\\]]", id++, st);
+
+            std::size_t const keywords = (s < 4) ? 600 : 40;
+            for (std::size_t k = 0; k != keywords; ++k)
+            {
+                std::sprintf(name, "%c%c%skw%u", char('a' + k % 26)
+                  , char('a' + (k / 26) % 26), (k % 3) ? "_" : "", unsigned(k));
+                rules.add(st, name, id++, st);
+            }
+
+            //  switching to the next state and back
+            std::sprintf(name, "S%u", unsigned((s + 1) % states));
+            rules.add(st, "[{][%][a-z]+", id++, (s + 1) % states ? name : "INITIAL");
+            count += id - 1;
+        }
+        return count;
+    }
+
+    bool equal(boost::lexer::state_machine const& lhs
+      , boost::lexer::state_machine const& rhs)
+    {
+        boost::lexer::detail::internals const& l = lhs.data();
+        boost::lexer::detail::internals const& r = rhs.data();
+
+        if (l._dfa_alphabet != r._dfa_alphabet || l._dfa->size() != r._dfa->size())
+            return false;
+
+        for (std::size_t i = 0; i != l._dfa->size(); ++i)
+        {
+            if (*l._lookup[i] != *r._lookup[i] || *l._dfa[i] != *r._dfa[i])
+                return false;
+        }
+        return true;
+    }
+
+    void report(char const* name, double elapsed, double sequential)
+    {
+        std::cout.precision(1);
+        std::cout << name << ": " << std::fixed << elapsed * 1e3
+            << " [ms], speedup " << std::setprecision(2)
+            << sequential / elapsed << std::endl;
+    }
+}
+
+int main()
+{
+    boost::lexer::rules rules;
+    std::size_t const count = template_rules(rules);
+
+    util::high_resolution_timer time;
+    boost::lexer::state_machine sequential;
+    boost::lexer::generator::build(rules, sequential);
+    boost::lexer::generator::minimise(sequential);
+    double const elapsed = time.elapsed();
+
+    std::size_t dfa_states = 0;
+    for (std::size_t i = 0; i != states; ++i)
+    {
+        dfa_states += sequential.data()._dfa[i]->size()
+            / sequential.data()._dfa_alphabet[i];
+    }
+    std::cout << states << " lexer states, " << count
+        << " token definitions, " << dfa_states << " DFA states, "
+        << boost::thread::hardware_concurrency() << " hardware threads"
+        << std::endl;
+    report("sequential            ", elapsed, elapsed);
+
+    std::size_t const threads[] = { 1, 2, 4, 0 };
+    char const* const names[] = {
+        "parallel, 1 thread    ", "parallel, 2 threads   "
+      , "parallel, 4 threads   ", "parallel, all threads " };
+
+    for (std::size_t i = 0; i != sizeof(threads)/sizeof(threads[0]); ++i)
+    {
+        util::high_resolution_timer time;
+        boost::lexer::state_machine sm;
+        lexertl::build_parallel(rules, sm, true, threads[i]);
+        double const parallel = time.elapsed();
+
+        if (!equal(sm, sequential))
+        {
+            std::cout << "the DFAs differ" << std::endl;
+            return -1;
+        }
+        report(names[i], parallel, elapsed);
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  The cost of knowing the line of every token, tokenizing 20 MB (or the
+//  number of MB given on the command line) of C-like source
+//
+//    - with the lexer iterator, producing lexertl::token, and
+//      lexertl::position_token over a line_pos_iterator,
+//    - with lexer::tokenize into a vector of compact tokens, without
+//      lines, and together with a line_index giving the line of each
+//      token.
+//
+//  Reports the throughput in tokens/s and checks that all lines are the
+//  same.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_lexertl_position_token.hpp>
+#include <boost/spirit/include/support_line_pos_iterator.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    struct tokens : lex::lexer<Lexer>
+    {
+        tokens()
+        {
+            this->self.add
+                ("[a-zA-Z_][a-zA-Z_0-9]*")
+                ("[0-9]+")
+                ("[-+*/%<>=!&|^~?:;,.(){}\\[\\]]|<<|>>|<=|>=|==|!=|&&|[|][|]"
+                 "|[-+*/%&|^]=|<<=|>>=|[+][+]|--|->")
+                ("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]|[/][/][^\\n]*")
+                ("\\\"(\\\\.|[^\\\\\"\\n])*\\\"")
+                ("[ \\t\\n]+")
+            ;
+        }
+    };
+
+    typedef std::string::const_iterator base_iterator_type;
+    typedef boost::spirit::line_pos_iterator<base_iterator_type>
+        pos_iterator_type;
+
+    typedef tokens<lexertl::lexer<lexertl::token<base_iterator_type> > >
+        plain_tokens_type;
+    typedef tokens<lexertl::lexer<lexertl::position_token<pos_iterator_type> > >
+        position_tokens_type;
+
+    std::string c_input(std::size_t size)
+    {
+        char const* const chunk =
+            "/* compute the checksum of a block of memory, the slow way */\n"
+            "static unsigned long checksum%d(unsigned char const* p, int n)\n"
+            "{\n"
+            "    unsigned long sum = %d; // seed\n"
+            "    for (int i = 0; i < n; ++i)\n"
+            "    {\n"
+            "        sum = (sum << 5) + sum + p[i] * %d;\n"
+            "        if (sum >= 15000 && p[i] != 10)\n"
+            "            sum ^= sum >> 3;\n"
+            "    }\n"
+            "    printf(\"checksum %%lu of %%d bytes\\n\", sum, n);\n"
+            "    return sum %% 4294967291;\n"
+            "}\n\n";
+
+        std::string input;
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[1024];
+            std::sprintf(buffer, chunk, i, i * 7919, i % 97);
+            input += buffer;
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  every function returns the number of tokens and sums up their lines
+    std::size_t plain(std::string const& input, std::size_t&)
+    {
+        static plain_tokens_type const tok;
+
+        base_iterator_type first = input.begin();
+        plain_tokens_type::iterator_type it = tok.begin(first, input.end());
+        plain_tokens_type::iterator_type const end = tok.end();
+
+        std::size_t count = 0;
+        for (/**/; it != end && token_is_valid(*it); ++it)
+            ++count;
+        return (it == end) ? count : 0;
+    }
+
+    std::size_t position(std::string const& input, std::size_t& lines)
+    {
+        static position_tokens_type const tok;
+
+        pos_iterator_type first(input.begin());
+        position_tokens_type::iterator_type it =
+            tok.begin(first, pos_iterator_type(input.end()));
+        position_tokens_type::iterator_type const end = tok.end();
+
+        std::size_t count = 0;
+        for (/**/; it != end && token_is_valid(*it); ++it)
+        {
+            lines += boost::spirit::get_line(it->matched().begin());
+            ++count;
+        }
+        return (it == end) ? count : 0;
+    }
+
+    std::vector<lexertl::compact_token> token_buffer;
+    std::vector<boost::uint32_t> line_buffer;
+
+    std::size_t tokenize(std::string const& input, std::size_t&)
+    {
+        static plain_tokens_type const tok;
+
+        token_buffer.clear();
+        return tok.tokenize(input.begin(), input.end(), token_buffer)
+          ? token_buffer.size() : 0;
+    }
+
+    std::size_t tokenize_lines(std::string const& input, std::size_t& lines)
+    {
+        static plain_tokens_type const tok;
+
+        token_buffer.clear();
+        if (!tok.tokenize(input.begin(), input.end(), token_buffer))
+            return 0;
+
+        lexertl::line_index index(input.begin(), input.end());
+        index.lines(token_buffer, line_buffer);
+
+        for (std::size_t i = 0; i != line_buffer.size(); ++i)
+            lines += line_buffer[i];
+        return token_buffer.size();
+    }
+
+    //  the best of a few runs
+    int const repeats = 3;
+
+    double measure(std::size_t (*f)(std::string const&, std::size_t&)
+      , std::string const& input, std::size_t& count, std::size_t& lines)
+    {
+        double best = 0;
+        for (int i = 0; i != repeats; ++i)
+        {
+            lines = 0;
+            util::high_resolution_timer time;
+            count = f(input, lines);
+            double const elapsed = time.elapsed();
+            if (i == 0 || elapsed < best)
+                best = elapsed;
+        }
+        return best;
+    }
+
+    void report(char const* name, std::size_t tokens, double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": " << std::fixed
+            << tokens / elapsed / 1e6 << " [Mtokens/s]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t const mb = (argc > 1) ? std::atoi(argv[1]) : 20;
+
+    std::string const input = c_input(mb * 1024 * 1024);
+    token_buffer.reserve(input.size() / 2);
+    line_buffer.reserve(input.size() / 2);
+
+    std::size_t count1 = 0, count2 = 0, count3 = 0, count4 = 0;
+    std::size_t lines1 = 0, lines2 = 0, lines3 = 0, lines4 = 0;
+    double const elapsed1 = measure(&plain, input, count1, lines1);
+    double const elapsed2 = measure(&position, input, count2, lines2);
+    double const elapsed3 = measure(&tokenize, input, count3, lines3);
+    double const elapsed4 = measure(&tokenize_lines, input, count4, lines4);
+
+    if (count1 == 0 || count1 != count2 || count1 != count3 ||
+        count1 != count4 || lines2 != lines4)
+    {
+        std::cout << "the results differ" << std::endl;
+        return -1;
+    }
+
+    std::cout << count1 << " tokens in " << input.size() << " bytes"
+        << std::endl;
+    report("lexer iterator, token                 ", count1, elapsed1);
+    report("lexer iterator, position_token        ", count2, elapsed2);
+    report("tokenize                              ", count3, elapsed3);
+    report("tokenize, line_index                  ", count4, elapsed4);
+    return 0;
+}
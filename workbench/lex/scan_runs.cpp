@@ -0,0 +1,189 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Tokenizing C-like source dominated by comments and string literals with
+//  the packed tables of the dynamic lexer, which skip the runs of
+//  characters the DFA loops on (the bodies of comments and literals) by
+//  searching for the next character leaving the loop. The same tables are
+//  used through an iterator adaptor, which hides that the characters are
+//  contiguous and thus matches every character. Reports the throughput in
+//  tokens/s and MB/s. Compile with -DBOOST_SPIRIT_LEXERTL_NO_SIMD to search
+//  without SSE2 instructions.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    void c_rules(boost::lexer::rules& rules)
+    {
+        rules.add_macro("D", "[0-9]");
+        rules.add_macro("L", "[a-zA-Z_]");
+        rules.add_macro("H", "[a-fA-F0-9]");
+
+        std::size_t id = 1;
+        rules.add("{L}({L}|{D})*", id++);
+        rules.add("0[xX]{H}+", id++);
+        rules.add("{D}+", id++);
+        rules.add("'(\\\\.|[^\\\\'\\n])+'", id++);
+        rules.add("\\\"(\\\\.|[^\\\\\"\\n])*\\\"", id++);
+        rules.add("[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]", id++);
+        rules.add("[/][/][^\\n]*", id++);
+        rules.add("^#[ \\t]*{L}+[^\\n]*", id++);
+        rules.add("[-+*/%<>=!&|^~?:;,.(){}\\[\\]]", id++);
+        rules.add("[ \\t\\v\\n\\f]+", id++);
+    }
+
+    std::string c_input(std::size_t size)
+    {
+        char const* const chunk =
+            "/*\n"
+            " * Copyright (c) the authors of this file, all rights reserved.\n"
+            " * Distributed under the Boost Software License, Version 1.0.\n"
+            " * Permission is hereby granted, free of charge, to any person\n"
+            " * obtaining a copy of the software and accompanying documentation\n"
+            " */\n"
+            "#include \"messages%d.h\"\n\n"
+            "// the messages reported by the checker number %d, these are\n"
+            "// looked up by their index into the table below\n"
+            "static char const* const messages%d[] =\n"
+            "{\n"
+            "    \"the input file could not be opened for reading\",\n"
+            "    \"unexpected end of input while reading a \\\"quoted\\\" name\",\n"
+            "    \"the checksum of the block does not match the expected value\",\n"
+            "    \"too many nested include files, the limit is %d levels\\n\",\n"
+            "};\n\n"
+            "/** Return the message for the given code (see messages%d). */\n"
+            "char const* message%d(int code)\n"
+            "{\n"
+            "    return messages%d[code]; // no range check at all\n"
+            "}\n\n";
+
+        std::string input;
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[2048];
+            std::sprintf(buffer, chunk, i, i, i, i % 64, i, i, i);
+            input += buffer;
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  a char const* the tokenizer does not know to be contiguous
+    class opaque_iterator
+      : public boost::iterator_adaptor<opaque_iterator, char const*>
+    {
+    public:
+        opaque_iterator() {}
+        explicit opaque_iterator(char const* p)
+          : opaque_iterator::iterator_adaptor_(p) {}
+    };
+
+    template <typename Iterator>
+    std::size_t tokenize(lexertl::packed_state_machine<char> const& sm
+      , std::string const& input, std::size_t& checksum)
+    {
+        typedef lexertl::basic_iterator_tokeniser<Iterator> tokenizer;
+
+        bool bol = sm.seen_bol_assertion();
+        Iterator first(input.data());
+        Iterator const last(input.data() + input.size());
+
+        std::size_t tokens = 0;
+        for (;;)
+        {
+            std::size_t unique_id = 0;
+            std::size_t const id =
+                tokenizer::next(sm, bol, first, last, unique_id);
+            if (id == 0 || id == boost::lexer::npos)
+                break;
+            checksum += id * (tokens % 7 + 1);
+            ++tokens;
+        }
+        return first == last ? tokens : 0;
+    }
+
+    int const repeats = 20;
+
+    template <typename Iterator>
+    double measure(lexertl::packed_state_machine<char> const& sm
+      , std::string const& input, std::size_t& tokens, std::size_t& checksum)
+    {
+        tokenize<Iterator>(sm, input, checksum);       // warm up
+
+        util::high_resolution_timer time;
+        for (int i = 0; i != repeats; ++i)
+            tokens = tokenize<Iterator>(sm, input, checksum);
+        return time.elapsed();
+    }
+
+    void report(char const* name, std::size_t bytes, std::size_t tokens
+      , double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": " << std::fixed
+            << repeats * tokens / elapsed / 1e6 << " [Mtokens/s], "
+            << repeats * bytes / elapsed / (1024. * 1024.) << " [MB/s]"
+            << std::endl;
+    }
+}
+
+int main()
+{
+    boost::lexer::rules rules;
+    c_rules(rules);
+
+    boost::lexer::state_machine sm;
+    boost::lexer::generator::build(rules, sm);
+    boost::lexer::generator::minimise(sm);
+
+    lexertl::packed_state_machine<char> packed(sm);
+
+    std::size_t scanned = 0;
+    for (std::size_t s = 1; s != packed[0].states(); ++s)
+    {
+        if (packed[0].has_scans() && packed[0].scan(s).scan)
+            ++scanned;
+    }
+    std::cout << "DFA: " << packed[0].states() << " states, " << scanned
+        << " of them skipping runs" << std::endl;
+
+    std::string const input = c_input(4 * 1024 * 1024);
+    std::size_t checksum1 = 0, checksum2 = 0;
+    std::size_t tokens1 = 0, tokens2 = 0;
+
+    double const elapsed1 =
+        measure<opaque_iterator>(packed, input, tokens1, checksum1);
+    double const elapsed2 =
+        measure<char const*>(packed, input, tokens2, checksum2);
+
+    if (tokens1 == 0 || tokens1 != tokens2 || checksum1 != checksum2)
+    {
+        std::cout << "the tokenizers disagree" << std::endl;
+        return -1;
+    }
+
+    std::cout << tokens1 << " tokens in " << input.size() << " bytes"
+        << std::endl;
+    report("every character ", input.size(), tokens1, elapsed1);
+    report("skipping runs   ", input.size(), tokens2, elapsed2);
+    return 0;
+}
@@ -0,0 +1,296 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Tokenizing conjure programs (see example/qi/compiler_tutorial/conjure3)
+//  with the three lexers of conjure3:
+//
+//    - the dynamic lexer, matching with the (packed) tables generated at
+//      runtime from the token definitions,
+//    - the static table driven lexer (conjure_static_lexer.hpp),
+//    - the static switch based lexer (conjure_static_switch_lexer.hpp).
+//
+//  The inputs are the conjure sample programs repeated to 1MB, and 16MB of
+//  generated conjure functions having longer identifiers, comments and runs
+//  of white space. Reports the throughput in tokens/s and MB/s. Compile with
+//  -DBOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO to measure the switch based lexer
+//  without computed gotos.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+
+#include "../../example/qi/compiler_tutorial/conjure3/lexer_def.hpp"
+#include "../../example/qi/compiler_tutorial/conjure3/conjure_static_lexer.hpp"
+#include "../../example/qi/compiler_tutorial/conjure3/conjure_static_switch_lexer.hpp"
+
+#include <boost/spirit/home/lex/lexer/lexertl/packed_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    typedef char const* iterator_type;
+
+    // the signature of the functions generated by generate_static
+    typedef std::size_t (*next_token_type)(std::size_t&, bool&
+      , iterator_type&, iterator_type const&, std::size_t&);
+
+    struct dynamic_lexer
+    {
+        explicit dynamic_lexer(lexertl::packed_state_machine<char> const& sm)
+          : sm(sm) {}
+
+        std::size_t operator()(std::size_t& state, bool& bol
+          , iterator_type& first, iterator_type const& last
+          , std::size_t& unique_id) const
+        {
+            return lexertl::basic_iterator_tokeniser<iterator_type>::next(
+                sm, state, bol, first, last, unique_id);
+        }
+
+        lexertl::packed_state_machine<char> const& sm;
+    };
+
+    template <typename Lexer>
+    std::size_t tokenize(Lexer const& next, std::string const& input
+      , std::size_t& checksum)
+    {
+        std::size_t state = 0;
+        bool bol = true;
+        iterator_type first = input.data();
+        iterator_type const last = first + input.size();
+
+        std::size_t tokens = 0;
+        for (;;)
+        {
+            std::size_t unique_id = 0;
+            std::size_t const id = next(state, bol, first, last, unique_id);
+            if (id == 0 || id == boost::lexer::npos)
+                break;
+            checksum += id * (unique_id + 1);
+            ++tokens;
+        }
+        return first == last ? tokens : 0;
+    }
+
+    int const repeats = 10;
+
+    template <typename Lexer>
+    double measure(Lexer const& next, std::string const& input
+      , std::size_t& tokens, std::size_t& checksum)
+    {
+        tokenize(next, input, checksum);       // warm up
+
+        util::high_resolution_timer time;
+        for (int i = 0; i != repeats; ++i)
+            tokens = tokenize(next, input, checksum);
+        return time.elapsed();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    char const* const samples =
+        "/* My first conjure program */\n"
+        "\n"
+        "int pow2(n)\n"
+        "{\n"
+        "    int a = 2;\n"
+        "    int i = 1;\n"
+        "    while (i < n)\n"
+        "    {\n"
+        "        a = a * 2;\n"
+        "        i = i + 1;\n"
+        "    }\n"
+        "    return a;\n"
+        "}\n"
+        "\n"
+        "int factorial(n)\n"
+        "{\n"
+        "    if (n <= 0)\n"
+        "        return 1;\n"
+        "    else\n"
+        "        return n * factorial(n-1);\n"
+        "}\n"
+        "\n"
+        "// assign ops\n"
+        "\n"
+        "int ashl(x, y)\n"
+        "{\n"
+        "    int t = x;\n"
+        "    t <<= y;\n"
+        "    return t;\n"
+        "}\n"
+        "\n"
+        "int main()\n"
+        "{\n"
+        "    return 1 + 2 + 3 + 5 * 4 * 6 + 5; /* answer is 131 */\n"
+        "}\n"
+        "\n";
+
+    std::string samples_input(std::size_t size)
+    {
+        std::string input;
+        while (input.size() < size)
+            input += samples;
+        return input;
+    }
+
+    // a simple linear congruential generator, for reproducible inputs
+    struct random
+    {
+        random() : seed(12345) {}
+
+        unsigned operator()(unsigned n)
+        {
+            seed = seed * 1103515245u + 12345u;
+            return (seed >> 16) % n;
+        }
+
+        unsigned seed;
+    };
+
+    std::string generated_input(std::size_t size)
+    {
+        char const* const names[] =
+        {
+            "count", "accumulated_total", "i", "next_index", "upper_bound",
+            "tmp", "remaining_iterations", "x_1", "result_value", "n"
+        };
+        char const* const operators[] =
+        {
+            " + ", " - ", " * ", " / ", " % ", " << ", " >> ", " & ", " | ",
+            " ^ ", " && ", " || ", " == ", " != ", " < ", " <= ", " > ", " >= "
+        };
+        char const* const assignments[] =
+        {
+            " = ", " += ", " -= ", " *= ", " /= ", " %= ", " <<= ", " >>= ",
+            " &= ", " |= ", " ^= "
+        };
+
+        random rand;
+        std::string input;
+        for (int f = 0; input.size() < size; ++f)
+        {
+            char buffer[256];
+            std::sprintf(buffer, "/* function number %d,\n * generated */\n"
+                "int function_%d(a, b, c)\n{\n", f, f);
+            input += buffer;
+
+            for (unsigned s = rand(12) + 4; s != 0; --s)
+            {
+                input.append(4 + 4 * rand(3), ' ');
+                switch (rand(4))
+                {
+                case 0:
+                    input += "while (";
+                    input += names[rand(10)];
+                    input += operators[12 + rand(6)];
+                    input += names[rand(10)];
+                    input += ")\n        ++";
+                    input += names[rand(10)];
+                    input += ";\n";
+                    break;
+
+                case 1:
+                    std::sprintf(buffer, "// %u is the magic number\n"
+                        , rand(100000));
+                    input += buffer;
+                    break;
+
+                default:
+                    input += names[rand(10)];
+                    input += assignments[rand(11)];
+                    for (unsigned t = rand(6); t != 0; --t)
+                    {
+                        if (rand(2))
+                        {
+                            std::sprintf(buffer, "%u", rand(1000000));
+                            input += buffer;
+                        }
+                        else
+                        {
+                            input += names[rand(10)];
+                        }
+                        input += operators[rand(18)];
+                    }
+                    input += rand(2) ? "true;\n" : "function_0(1, 2, 3);\n";
+                    break;
+                }
+            }
+            input += "    return a;\n}\n\n";
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void report(char const* name, std::size_t bytes, std::size_t tokens
+      , double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << "    " << name << ": " << std::fixed
+            << repeats * tokens / elapsed / 1e6 << " [Mtokens/s], "
+            << repeats * bytes / elapsed / (1024. * 1024.) << " [MB/s]"
+            << std::endl;
+    }
+
+    bool run(char const* name, std::string const& input
+      , lexertl::packed_state_machine<char> const& sm)
+    {
+        using namespace boost::spirit::lex::lexertl::static_;
+
+        next_token_type const table_lexer =
+            &next_token_conjure_static<iterator_type>;
+        next_token_type const switch_lexer =
+            &next_token_conjure_static_switch<iterator_type>;
+
+        std::size_t checksum1 = 0, checksum2 = 0, checksum3 = 0;
+        std::size_t tokens1 = 0, tokens2 = 0, tokens3 = 0;
+
+        double const elapsed1 =
+            measure(dynamic_lexer(sm), input, tokens1, checksum1);
+        double const elapsed2 = measure(table_lexer, input, tokens2, checksum2);
+        double const elapsed3 = measure(switch_lexer, input, tokens3, checksum3);
+
+        if (tokens1 == 0 || tokens1 != tokens2 || tokens1 != tokens3 ||
+            checksum1 != checksum2 || checksum1 != checksum3)
+        {
+            std::cout << name << ": the lexers disagree" << std::endl;
+            return false;
+        }
+
+        std::cout << name << ": " << tokens1 << " tokens in "
+            << input.size() << " bytes" << std::endl;
+        report("dynamic     ", input.size(), tokens1, elapsed1);
+        report("static table", input.size(), tokens2, elapsed2);
+        report("static code ", input.size(), tokens3, elapsed3);
+        return true;
+    }
+}
+
+int main()
+{
+    // the dynamic lexer of conjure3, the static lexers have been generated
+    // from the very same token definitions
+    client::lexer::conjure_tokens<std::string::const_iterator> tokens;
+
+    boost::lexer::state_machine sm;
+    boost::lexer::generator::build(tokens.get_rules(), sm);
+    lexertl::packed_state_machine<char> packed(sm);
+
+    if (!run("conjure samples", samples_input(1024 * 1024), packed) ||
+        !run("generated", generated_input(16 * 1024 * 1024), packed))
+    {
+        return -1;
+    }
+    return 0;
+}
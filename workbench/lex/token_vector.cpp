@@ -0,0 +1,229 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Tokenizing a few MB of C-like source through the lexer iterator (the
+//  multi_pass pipeline) and with lexer::tokenize into a vector of compact
+//  tokens, on its own and together with parsing the tokens with a Qi
+//  grammar (using the lexer iterator or the token_vector_iterator).
+//  Reports the throughput in tokens/s, counting all tokens including the
+//  skipped comments and white space.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+#include <boost/spirit/include/qi_numeric.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace lex = boost::spirit::lex;
+namespace lexertl = boost::spirit::lex::lexertl;
+
+namespace
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    struct tokens : lex::lexer<Lexer>
+    {
+        tokens()
+        {
+            identifier = "[a-zA-Z_][a-zA-Z_0-9]*";
+            number = "[0-9]+";
+            op = "[-+*/%<>=!&|^~?:;,.(){}\\[\\]]|<<|>>|<=|>=|==|!=|&&|[|][|]"
+                "|[-+*/%&|^]=|<<=|>>=|[+][+]|--|->";
+            comment = "[/][*][^*]*[*]+([^/*][^*]*[*]+)*[/]|[/][/][^\\n]*";
+            string = "\\\"(\\\\.|[^\\\\\"\\n])*\\\"";
+            white_space = "[ \\t\\n]+";
+
+            this->self = identifier | number | op | comment | string
+                | white_space;
+        }
+
+        lex::token_def<lex::omit> identifier, op, comment, string
+          , white_space;
+        lex::token_def<unsigned int> number;
+    };
+
+    typedef std::string::const_iterator base_iterator_type;
+    typedef lexertl::token<base_iterator_type
+      , boost::mpl::vector<unsigned int> > token_type;
+    typedef lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type> tokens_type;
+
+    std::string c_input(std::size_t size)
+    {
+        char const* const chunk =
+            "/* compute the checksum of a block of memory, the slow way */\n"
+            "static unsigned long checksum%d(unsigned char const* p, int n)\n"
+            "{\n"
+            "    unsigned long sum = %d; // seed\n"
+            "    for (int i = 0; i < n; ++i)\n"
+            "    {\n"
+            "        sum = (sum << 5) + sum + p[i] * %d;\n"
+            "        if (sum >= 15000 && p[i] != 10)\n"
+            "            sum ^= sum >> 3;\n"
+            "    }\n"
+            "    printf(\"checksum %%lu of %%d bytes\\n\", sum, n);\n"
+            "    return sum %% 4294967291;\n"
+            "}\n\n";
+
+        std::string input;
+        for (int i = 0; input.size() < size; ++i)
+        {
+            char buffer[1024];
+            std::sprintf(buffer, chunk, i, i * 7919, i % 97);
+            input += buffer;
+        }
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  the tokens of the input, counting the tokens and summing the numbers
+    template <typename Iterator>
+    std::size_t parse(tokens_type const& tok, Iterator first
+      , Iterator const& last, unsigned int& sum)
+    {
+        using boost::phoenix::ref;
+        using qi::_1;
+
+        std::size_t count = 0;
+        bool const r = qi::phrase_parse(first, last
+          , *(  tok.identifier[++ref(count)]
+              | tok.number[++ref(count), ref(sum) += _1]
+              | tok.op[++ref(count)]
+              | tok.string[++ref(count)]
+             )
+          , tok.comment | tok.white_space);
+        return (r && first == last) ? count : 0;
+    }
+
+    std::size_t iterate(tokens_type const& tok, std::string const& input
+      , unsigned int&)
+    {
+        base_iterator_type first = input.begin();
+        tokens_type::iterator_type it = tok.begin(first, input.end());
+        tokens_type::iterator_type const end = tok.end();
+
+        std::size_t count = 0;
+        for (/**/; it != end && token_is_valid(*it); ++it)
+            ++count;
+        return (it == end) ? count : 0;
+    }
+
+    //  tokenizing into a new vector costs the page faults for the memory
+    //  of the tokens, which are avoided when reusing a vector
+    std::vector<lexertl::compact_token> token_buffer;
+
+    std::size_t tokenize_new(tokens_type const& tok
+      , std::string const& input, unsigned int&)
+    {
+        std::vector<lexertl::compact_token> tokens;
+        tokens.reserve(input.size() / 2);
+        return tok.tokenize(input.begin(), input.end(), tokens)
+          ? tokens.size() : 0;
+    }
+
+    std::size_t tokenize(tokens_type const& tok, std::string const& input
+      , unsigned int&)
+    {
+        token_buffer.clear();
+        token_buffer.reserve(input.size() / 2);
+        return tok.tokenize(input.begin(), input.end(), token_buffer)
+          ? token_buffer.size() : 0;
+    }
+
+    std::size_t iterate_parse(tokens_type const& tok
+      , std::string const& input, unsigned int& sum)
+    {
+        base_iterator_type first = input.begin();
+        return parse(tok, tok.begin(first, input.end()), tok.end(), sum);
+    }
+
+    std::size_t tokenize_parse(tokens_type const& tok
+      , std::string const& input, unsigned int& sum)
+    {
+        typedef tokens_type::token_vector_iterator_type iterator_type;
+
+        token_buffer.clear();
+        token_buffer.reserve(input.size() / 2);
+        if (!tok.tokenize(input.begin(), input.end(), token_buffer))
+            return 0;
+
+        return parse(tok, iterator_type(input.begin(), token_buffer.begin())
+          , iterator_type(input.begin(), token_buffer.end()), sum);
+    }
+
+    int const repeats = 5;
+
+    template <typename F>
+    double measure(F f, tokens_type const& tok, std::string const& input
+      , std::size_t& tokens, unsigned int& sum)
+    {
+        f(tok, input, sum);       // warm up
+
+        util::high_resolution_timer time;
+        for (int i = 0; i != repeats; ++i)
+        {
+            sum = 0;
+            tokens = f(tok, input, sum);
+        }
+        return time.elapsed();
+    }
+
+    void report(char const* name, std::size_t tokens, double elapsed)
+    {
+        std::cout.precision(2);
+        std::cout << name << ": " << std::fixed
+            << repeats * tokens / elapsed / 1e6 << " [Mtokens/s]"
+            << std::endl;
+    }
+}
+
+int main()
+{
+    tokens_type tok;
+    std::string const input = c_input(4 * 1024 * 1024);
+
+    std::size_t tokens1 = 0, tokens2 = 0, tokens3 = 0, tokens4 = 0;
+    std::size_t tokens5 = 0;
+    unsigned int sum4 = 0, sum5 = 0, unused = 0;
+
+    double const elapsed1 = measure(&iterate, tok, input, tokens1, unused);
+    double const elapsed2 =
+        measure(&tokenize_new, tok, input, tokens2, unused);
+    double const elapsed3 = measure(&tokenize, tok, input, tokens3, unused);
+    double const elapsed4 =
+        measure(&iterate_parse, tok, input, tokens4, sum4);
+    double const elapsed5 =
+        measure(&tokenize_parse, tok, input, tokens5, sum5);
+
+    // the parsers count the tokens except comments and white space
+    if (tokens1 == 0 || tokens1 != tokens2 || tokens1 != tokens3 ||
+        tokens4 == 0 || tokens4 != tokens5 || sum4 != sum5)
+    {
+        std::cout << "the results differ" << std::endl;
+        return -1;
+    }
+
+    std::cout << tokens1 << " tokens in " << input.size() << " bytes, "
+        << tokens4 << " of them parsed" << std::endl;
+    report("lexer iterator                 ", tokens1, elapsed1);
+    report("tokenize into a new vector     ", tokens1, elapsed2);
+    report("tokenize into a reused vector  ", tokens1, elapsed3);
+    report("lexer iterator and parse       ", tokens1, elapsed4);
+    report("tokenize (reused) and parse    ", tokens1, elapsed5);
+    return 0;
+}
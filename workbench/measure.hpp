@@ -26,6 +26,18 @@ namespace test
     // sure it's needed.
     int live_code;
 
+    // This has to be at least as large as the number of
+    // simultaneous accumulations that can be executing in the
+    // compiler pipeline.  A safe number here is larger than the
+    // machine's maximum pipeline depth. If you want to test the L2
+    // or L3 cache, or main memory, you can increase the size of
+    // this array.  1024 is an upper limit on the pipeline depth of
+    // current vector machines.
+    //
+    // A measurement of N repeats calls benchmark() on each of these
+    // accumulators N times.
+    const std::size_t number_of_accumulators = 1024;
+
     // Call objects of the given Accumulator type repeatedly
     template <class Accumulator>
     void hammer(long const repeats)
@@ -44,15 +56,6 @@ namespace test
         // concern is specific to the particular application at which
         // we're targeting the test. ***
 
-        // This has to be at least as large as the number of
-        // simultaneous accumulations that can be executing in the
-        // compiler pipeline.  A safe number here is larger than the
-        // machine's maximum pipeline depth. If you want to test the L2
-        // or L3 cache, or main memory, you can increase the size of
-        // this array.  1024 is an upper limit on the pipeline depth of
-        // current vector machines.
-        
-        const std::size_t number_of_accumulators = 1024;
         live_code = 0; // reset to zero
 
         Accumulator a[number_of_accumulators];
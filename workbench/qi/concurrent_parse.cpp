@@ -0,0 +1,285 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Scaling of Qi grammars shared by several threads: a list of numbers,
+//  a list of employee records (parsed into structs) and a calculator
+//  (evaluating expressions in semantic actions), each parsed by 1, 2, 4
+//  and 8 threads at once using the very same grammar objects. Every thread
+//  parses its own copy of the input a couple of times. The throughput is
+//  reported in MB/s, and the scaling efficiency relative to a single
+//  thread (100% means linear). The numbers are only meaningful on a
+//  machine with at least 8 cores.
+//
+//  Parsing does not modify a grammar: rule::parse is const and calls the
+//  stored boost::function directly, rules refer to each other by reference
+//  (no copies, no reference counts touched while parsing), symbols only
+//  dereference their shared_ptr, and the attributes, locals and contexts
+//  live on the stack of the parsing thread. The shared mutable state there
+//  is, which this benchmark exercises where it is on the parse path:
+//
+//  - function local statics initialized on first use (the dispatch tables
+//    of the permutation operator, the end iterator of the multi_pass
+//    buffering_input_iterator policy). After their initialization they are
+//    only read; each use costs a check of the initialization guard.
+//  - the indentation of the debug output (simple_trace::get_indent, used
+//    by qi::debug and BOOST_SPIRIT_DEBUG_NODE) is a static counter shared
+//    by all threads, and the output of the threads is interleaved. Debug
+//    rules must not be used from several threads.
+//  - symbols modified while others parse are a data race unless they use
+//    the tst_snapshot Lookup (see symbols_snapshot.cpp).
+//  - anything the semantic actions of a grammar refer to (phoenix::ref to
+//    members of the grammar, for instance) is shared by all threads.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/phoenix_core.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind/bind.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace ascii = boost::spirit::ascii;
+
+///////////////////////////////////////////////////////////////////////////////
+struct employee
+{
+    int age;
+    std::string surname;
+    std::string forename;
+    double salary;
+};
+
+BOOST_FUSION_ADAPT_STRUCT(
+    employee,
+    (int, age)
+    (std::string, surname)
+    (std::string, forename)
+    (double, salary)
+)
+
+namespace
+{
+    typedef std::string::const_iterator iterator_type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct numbers_grammar
+      : qi::grammar<iterator_type, std::vector<double>(), ascii::space_type>
+    {
+        numbers_grammar() : numbers_grammar::base_type(start)
+        {
+            start = qi::double_ % ',';
+        }
+
+        qi::rule<iterator_type, std::vector<double>(), ascii::space_type> start;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct employee_grammar
+      : qi::grammar<iterator_type, std::vector<employee>(), ascii::space_type>
+    {
+        employee_grammar() : employee_grammar::base_type(start)
+        {
+            quoted_string %= qi::lexeme['"' >> +(ascii::char_ - '"') >> '"'];
+
+            record %=
+                qi::lit("employee")
+                >> '{'
+                >>  qi::int_ >> ','
+                >>  quoted_string >> ','
+                >>  quoted_string >> ','
+                >>  qi::double_
+                >>  '}'
+                ;
+
+            start = *record;
+        }
+
+        qi::rule<iterator_type, std::string(), ascii::space_type> quoted_string;
+        qi::rule<iterator_type, employee(), ascii::space_type> record;
+        qi::rule<iterator_type, std::vector<employee>(), ascii::space_type> start;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct calculator_grammar
+      : qi::grammar<iterator_type, int(), ascii::space_type>
+    {
+        calculator_grammar() : calculator_grammar::base_type(start)
+        {
+            using qi::_val;
+            using qi::_1;
+
+            expression =
+                term                            [_val = _1]
+                >> *(   ('+' >> term            [_val += _1])
+                    |   ('-' >> term            [_val -= _1])
+                    )
+                ;
+
+            term =
+                factor                          [_val = _1]
+                >> *(   ('*' >> factor          [_val *= _1])
+                    |   ('/' >> factor          [_val /= _1])
+                    )
+                ;
+
+            factor =
+                qi::uint_                       [_val = _1]
+                |   '(' >> expression           [_val = _1] >> ')'
+                |   ('-' >> factor              [_val = -_1])
+                |   ('+' >> factor              [_val = _1])
+                ;
+
+            start = *(expression [_val += _1] >> ';');
+        }
+
+        qi::rule<iterator_type, int(), ascii::space_type>
+            expression, term, factor, start;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string numbers_input()
+    {
+        std::string input;
+        for (int i = 0; i != 10000; ++i)
+        {
+            char buffer[32];
+            std::sprintf(buffer, i ? ", %d.%03d" : "%d.%03d", i, i % 1000);
+            input += buffer;
+        }
+        return input;
+    }
+
+    std::string employee_input()
+    {
+        std::string input;
+        for (int i = 0; i != 2000; ++i)
+        {
+            char buffer[128];
+            std::sprintf(buffer
+              , "employee{%d, \"Surname%d\", \"Forename%d\", %d.50}\n"
+              , 20 + i % 45, i, i, 30000 + i);
+            input += buffer;
+        }
+        return input;
+    }
+
+    std::string calculator_input()
+    {
+        std::string input;
+        for (int i = 0; i != 4000; ++i)
+            input += "(1 + 2) * (3 + 4 * (5 + 6)) / -(7 - 4);\n";
+        return input;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    int const repeats = 20;
+
+    template <typename T>
+    long checksum(std::vector<T> const& v)
+    {
+        return static_cast<long>(v.size());
+    }
+
+    long checksum(int value)
+    {
+        return value;
+    }
+
+    template <typename Grammar, typename Attribute>
+    void worker(Grammar const& g, std::string input, long& result)
+    {
+        long sum = 0;
+        for (int r = 0; r != repeats; ++r)
+        {
+            iterator_type first = input.begin();
+            iterator_type const last = input.end();
+            Attribute attr = Attribute();
+            if (qi::phrase_parse(first, last, g, ascii::space, attr)
+                && first == last)
+            {
+                sum += checksum(attr);
+            }
+            else
+            {
+                sum = -1000000;
+            }
+        }
+        result = sum;
+    }
+
+    long live_code = 0;
+
+    template <typename Attribute, typename Grammar>
+    void report(char const* name, Grammar const& g, std::string const& input)
+    {
+        double single = 0;
+        long expected = 0;
+        for (int threads = 1; threads <= 8; threads *= 2)
+        {
+            std::vector<long> results(threads);
+
+            util::high_resolution_timer time;
+            boost::thread_group group;
+            for (int i = 0; i != threads; ++i)
+            {
+                group.create_thread(boost::bind(worker<Grammar, Attribute>
+                  , boost::cref(g), input, boost::ref(results[i])));
+            }
+            group.join_all();
+            double const elapsed = time.elapsed();
+
+            // every thread must have gotten the same result
+            if (threads == 1)
+                expected = results[0];
+            for (int i = 0; i != threads; ++i)
+            {
+                if (results[i] != expected)
+                    std::cout << name << ": thread " << i << " failed" << std::endl;
+                live_code += results[i];
+            }
+
+            double const throughput = double(threads) * repeats
+                * input.size() / (1024. * 1024.) / elapsed;
+            if (threads == 1)
+                single = throughput;
+
+            std::cout.precision(2);
+            std::cout << name << ": ";
+            for (int i = 0; i < (12-int(std::strlen(name))); ++i)
+                std::cout << ' ';
+            std::cout << threads << " threads: " << std::fixed << throughput
+                << " [MB/s], efficiency: " << std::fixed
+                << 100. * throughput / (single * threads) << " [%]"
+                << std::endl;
+        }
+    }
+}
+
+int main()
+{
+    numbers_grammar const numbers;
+    employee_grammar const employees;
+    calculator_grammar const calculator;
+
+    report<std::vector<double> >("numbers", numbers, numbers_input());
+    report<std::vector<employee> >("employees", employees, employee_input());
+    report<int>("calculator", calculator, calculator_input());
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.
+    return live_code != 0;
+}
@@ -31,6 +31,11 @@ namespace
     char const* first[9];
     char const* last[9];
 
+    // long long numbers with 10 .. 18 digits
+    std::string long_numbers[9];
+    char const* long_first[9];
+    char const* long_last[9];
+
     ///////////////////////////////////////////////////////////////////////////
     struct atoi_test : test::base
     {
@@ -69,6 +74,36 @@ namespace
                 this->val += parse(first[i], last[i]);
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct strtoll_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += static_cast<int>(strtoll(long_first[i]
+                  , const_cast<char**>(&long_last[i]), 10));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct spirit_long_long_test : test::base
+    {
+        static int parse(char const* first, char const* last)
+        {
+            boost::long_long_type n;
+            namespace qi = boost::spirit::qi;
+            using qi::long_long;
+            qi::parse(first, last, long_long, n);
+            return static_cast<int>(n);
+        }
+
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += parse(long_first[i], long_last[i]);
+        }
+    };
 }
 
 int main()
@@ -89,6 +124,15 @@ int main()
             last[i]++;
         std::cout << i+1 << " digit number:" << numbers[i] << std::endl;
     }
+    for (int i = 0; i < 9; ++i)
+    {
+        long_numbers[i] = gen_int(i+10);
+        long_first[i] = long_numbers[i].c_str();
+        long_last[i] = long_first[i];
+        while (*long_last[i])
+            long_last[i]++;
+        std::cout << i+10 << " digit number:" << long_numbers[i] << std::endl;
+    }
     std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
 
     BOOST_SPIRIT_TEST_BENCHMARK(
@@ -96,6 +140,8 @@ int main()
         (atoi_test)
         (strtol_test)
         (spirit_int_test)
+        (strtoll_test)
+        (spirit_long_long_test)
     )
     
     // This is ultimately responsible for preventing all the test code
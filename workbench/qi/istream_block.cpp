@@ -0,0 +1,147 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Parsing a large file of comma separated integers (32 MB by default, the
+//  size in MB can be given on the command line) through
+//
+//  - the istream_iterator (characters extracted one by one),
+//  - a multi_pass wrapping a std::istreambuf_iterator,
+//  - the istream_block_iterator (characters read in blocks), and
+//  - a std::string holding the whole file (read in advance),
+//
+//  reporting the throughput in MB/s. The file is parsed a couple of times
+//  for every iterator, the best time is reported.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/phoenix_core.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/support_istream_iterator.hpp>
+#include <boost/spirit/include/support_multi_pass.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+namespace qi = boost::spirit::qi;
+
+namespace
+{
+    char const* const filename = "istream_block.dat";
+    int const runs = 3;
+
+    void generate(std::size_t size)
+    {
+        std::ofstream out(filename, std::ios_base::binary);
+        std::size_t written = 0;
+        unsigned int seed = 0;
+        while (written < size)
+        {
+            std::string line;
+            for (int i = 0; i != 15; ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+                char buffer[16];
+                std::sprintf(buffer, i ? ", %u" : "%u", (seed >> 8) & 0xffffff);
+                line += buffer;
+            }
+            line += '\n';
+            out << line;
+            written += line.size();
+        }
+    }
+
+    template <typename Iterator>
+    long parse(Iterator first, Iterator last)
+    {
+        long sum = 0;
+        bool r = qi::phrase_parse(first, last
+          , *(qi::uint_ [boost::phoenix::ref(sum) += qi::_1] % ',')
+          , qi::space);
+        if (!r || first != last)
+            std::cerr << "parse failed" << std::endl;
+        return sum;
+    }
+
+    long parse_istream_iterator()
+    {
+        std::ifstream in(filename, std::ios_base::binary);
+        in.unsetf(std::ios::skipws);
+        return parse(boost::spirit::istream_iterator(in)
+          , boost::spirit::istream_iterator());
+    }
+
+    long parse_istreambuf_iterator()
+    {
+        std::ifstream in(filename, std::ios_base::binary);
+        typedef std::istreambuf_iterator<char> base_iterator_type;
+        return parse(
+            boost::spirit::make_default_multi_pass(base_iterator_type(in))
+          , boost::spirit::make_default_multi_pass(base_iterator_type()));
+    }
+
+    long parse_istream_block_iterator()
+    {
+        std::ifstream in(filename, std::ios_base::binary);
+        return parse(boost::spirit::istream_block_iterator(in)
+          , boost::spirit::istream_block_iterator());
+    }
+
+    long parse_string()
+    {
+        std::ifstream in(filename, std::ios_base::binary);
+        std::string input((std::istreambuf_iterator<char>(in))
+          , std::istreambuf_iterator<char>());
+        return parse(input.begin(), input.end());
+    }
+
+    long live_code = 0;
+
+    void report(char const* name, long (*f)(), std::size_t size)
+    {
+        double best = 0;
+        for (int i = 0; i != runs; ++i)
+        {
+            util::high_resolution_timer time;
+            live_code += f();
+            double const elapsed = time.elapsed();
+            if (i == 0 || elapsed < best)
+                best = elapsed;
+        }
+
+        std::cout.precision(2);
+        std::cout << name << ": ";
+        for (int i = 0; i < (32-int(std::strlen(name))); ++i)
+            std::cout << ' ';
+        std::cout << std::fixed << (size / (1024. * 1024.)) / best
+            << " [MB/s]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t const size =
+        (argc > 1 ? std::atoi(argv[1]) : 32) * std::size_t(1024 * 1024);
+    generate(size);
+
+    report("istream_iterator", parse_istream_iterator, size);
+    report("multi_pass<istreambuf_iterator>", parse_istreambuf_iterator, size);
+    report("istream_block_iterator", parse_istream_block_iterator, size);
+    report("std::string", parse_string, size);
+
+    std::remove(filename);
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.
+    return live_code != 0;
+}
@@ -26,8 +26,6 @@
 #include <boost/spirit/repository/include/qi_kwd.hpp>
 #include <boost/spirit/repository/include/qi_keywords.hpp>
 #include <boost/optional.hpp>
-#include <boost/spirit/home/phoenix/core/argument.hpp>
-#include <boost/spirit/home/phoenix/bind/bind_member_variable.hpp>
 
 #include <iostream>
 #include <string>
@@ -42,7 +40,7 @@
 #include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/stringize.hpp>
 
-#define KEYS_5
+#define KEYS_10
 
 #include "keywords.hpp"
 
@@ -0,0 +1,140 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  A 32 element permutation parsing a block of HTTP like header lines,
+//  given in the order of the permutation, in the reverse order and in a
+//  shuffled order. The dispatch versions start every element with its
+//  header name, so the permutation only tries the elements whose first
+//  character matches the next input character. The no_dispatch versions
+//  start every element with an eps, hiding the first character and
+//  making the permutation try every element which did not match yet.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include <boost/spirit/include/qi.hpp>
+
+#include <string>
+
+namespace qi = boost::spirit::qi;
+
+namespace
+{
+    typedef char const* iterator_type;
+
+    using qi::lit;
+    using qi::omit;
+    using qi::eps;
+    using qi::char_;
+
+#define HEADERS(h)                                                          \
+    h("Accept") ^ h("Accept-Charset") ^ h("Accept-Encoding")               \
+    ^ h("Accept-Language") ^ h("Authorization") ^ h("Cache-Control")       \
+    ^ h("Connection") ^ h("Content-Length") ^ h("Content-MD5")             \
+    ^ h("Content-Type") ^ h("Cookie") ^ h("Date") ^ h("Expect")            \
+    ^ h("Forwarded") ^ h("From") ^ h("Host") ^ h("If-Match")               \
+    ^ h("If-Modified-Since") ^ h("If-None-Match") ^ h("If-Range")          \
+    ^ h("If-Unmodified-Since") ^ h("Max-Forwards") ^ h("Origin")           \
+    ^ h("Pragma") ^ h("Proxy-Authorization") ^ h("Range") ^ h("Referer")   \
+    ^ h("TE") ^ h("Upgrade") ^ h("User-Agent") ^ h("Via") ^ h("Warning")   \
+    /***/
+#define HEADER(name)                                                        \
+    omit[lit(name ": ") >> *~char_('\r') >> "\r\n"]                         \
+    /***/
+#define EPS_HEADER(name)                                                    \
+    omit[eps >> lit(name ": ") >> *~char_('\r') >> "\r\n"]                  \
+    /***/
+
+    char const* const names[] =
+    {
+        "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language"
+      , "Authorization", "Cache-Control", "Connection", "Content-Length"
+      , "Content-MD5", "Content-Type", "Cookie", "Date", "Expect"
+      , "Forwarded", "From", "Host", "If-Match", "If-Modified-Since"
+      , "If-None-Match", "If-Range", "If-Unmodified-Since", "Max-Forwards"
+      , "Origin", "Pragma", "Proxy-Authorization", "Range", "Referer", "TE"
+      , "Upgrade", "User-Agent", "Via", "Warning"
+    };
+    int const count = sizeof(names) / sizeof(names[0]);
+
+    struct headers
+    {
+        headers()
+        {
+            dispatch = HEADERS(HEADER);
+            no_dispatch = HEADERS(EPS_HEADER);
+
+            for (int i = 0; i != count; ++i)
+            {
+                in_order += line(i);
+                reversed += line(count - 1 - i);
+                shuffled += line((i * 7) % count);
+            }
+        }
+
+        static std::string line(int i)
+        {
+            return std::string(names[i]) + ": some value\r\n";
+        }
+
+        qi::rule<iterator_type> dispatch, no_dispatch;
+        std::string in_order, reversed, shuffled;
+    };
+
+#undef HEADERS
+#undef HEADER
+#undef EPS_HEADER
+
+    headers const& get_headers()
+    {
+        static headers const h;
+        return h;
+    }
+
+    template <int Order, bool Dispatch>
+    struct permutation_test : test::base
+    {
+        void benchmark()
+        {
+            headers const& h = get_headers();
+            std::string const& input = Order == 0 ? h.in_order :
+                Order == 1 ? h.reversed : h.shuffled;
+
+            iterator_type first = input.data();
+            iterator_type const last = first + input.size();
+            qi::parse(first, last, Dispatch ? h.dispatch : h.no_dispatch);
+            this->val += last - first;
+        }
+    };
+
+    typedef permutation_test<0, true> dispatch_in_order;
+    typedef permutation_test<0, false> no_dispatch_in_order;
+    typedef permutation_test<1, true> dispatch_reversed;
+    typedef permutation_test<1, false> no_dispatch_reversed;
+    typedef permutation_test<2, true> dispatch_shuffled;
+    typedef permutation_test<2, false> no_dispatch_shuffled;
+}
+
+int main()
+{
+    get_headers();
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        1000,       // This is the maximum repetitions to execute
+        (dispatch_in_order)
+        (no_dispatch_in_order)
+        (dispatch_reversed)
+        (no_dispatch_reversed)
+        (dispatch_shuffled)
+        (no_dispatch_shuffled)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,289 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Compares grammars built from type erased qi::rules against the same
+//  grammars built from qi::static_rules: the employee parser
+//  (example/qi/employee.cpp) and the calc3 calculator (example/qi/calc3.cpp).
+//  In the calculator, the expression rule closes the recursion and remains
+//  an ordinary rule.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/phoenix_core.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace qi = boost::spirit::qi;
+namespace ascii = boost::spirit::ascii;
+
+namespace client
+{
+    struct employee
+    {
+        int age;
+        std::string surname;
+        std::string forename;
+        double salary;
+    };
+}
+
+BOOST_FUSION_ADAPT_STRUCT(
+    client::employee,
+    (int, age)
+    (std::string, surname)
+    (std::string, forename)
+    (double, salary)
+)
+
+namespace
+{
+    typedef char const* iterator_type;
+
+    using qi::int_;
+    using qi::uint_;
+    using qi::double_;
+    using qi::lit;
+    using qi::lexeme;
+    using qi::_val;
+    using qi::_1;
+    using ascii::char_;
+    using ascii::space;
+    using ascii::space_type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The employee grammar
+    ///////////////////////////////////////////////////////////////////////////
+    typedef qi::rule<iterator_type, std::string(), space_type> string_rule;
+    typedef qi::rule<iterator_type, client::employee(), space_type>
+        employee_rule;
+
+    struct employee_rules
+    {
+        employee_rules()
+        {
+            quoted_string %= lexeme['"' >> +(char_ - '"') >> '"'];
+            start %=
+                lit("employee")
+                >> '{'
+                >>  int_ >> ','
+                >>  quoted_string >> ','
+                >>  quoted_string >> ','
+                >>  double_
+                >>  '}'
+                ;
+        }
+
+        string_rule quoted_string;
+        employee_rule start;
+    };
+
+#define QUOTED_STRING_DEF                                                   \
+        lexeme['"' >> +(char_ - '"') >> '"']                                \
+        /***/
+#define START_DEF                                                           \
+        lit("employee")                                                     \
+        >> '{'                                                              \
+        >>  int_ >> ','                                                     \
+        >>  quoted_string >> ','                                            \
+        >>  quoted_string >> ','                                            \
+        >>  double_                                                         \
+        >>  '}'                                                             \
+        /***/
+
+    struct static_employee_rules
+    {
+        static_employee_rules()
+          : quoted_string(
+                qi::make_static_auto_rule<string_rule>(QUOTED_STRING_DEF))
+          , start(qi::make_static_auto_rule<employee_rule>(START_DEF))
+        {}
+
+        boost::spirit::result_of::static_rule<
+            string_rule, BOOST_TYPEOF(QUOTED_STRING_DEF), boost::mpl::true_
+        >::type quoted_string;
+        boost::spirit::result_of::static_rule<
+            employee_rule, BOOST_TYPEOF(START_DEF), boost::mpl::true_
+        >::type start;
+    };
+
+#undef QUOTED_STRING_DEF
+#undef START_DEF
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The calculator grammar
+    ///////////////////////////////////////////////////////////////////////////
+    typedef qi::rule<iterator_type, int(), space_type> int_rule;
+
+    struct calc_rules
+    {
+        calc_rules()
+        {
+            expression =
+                term                            [_val = _1]
+                >> *(   ('+' >> term            [_val += _1])
+                    |   ('-' >> term            [_val -= _1])
+                    )
+                ;
+
+            term =
+                factor                          [_val = _1]
+                >> *(   ('*' >> factor          [_val *= _1])
+                    |   ('/' >> factor          [_val /= _1])
+                    )
+                ;
+
+            factor =
+                uint_                           [_val = _1]
+                |   '(' >> expression           [_val = _1] >> ')'
+                |   ('-' >> factor              [_val = -_1])
+                |   ('+' >> factor              [_val = _1])
+                ;
+        }
+
+        int_rule expression, term, factor;
+    };
+
+#define PRIMARY_DEF                                                         \
+        uint_                                   [_val = _1]                 \
+        |   '(' >> expression                   [_val = _1] >> ')'          \
+        /***/
+#define TERM_DEF                                                            \
+        factor                                  [_val = _1]                 \
+        >> *(   ('*' >> factor                  [_val *= _1])               \
+            |   ('/' >> factor                  [_val /= _1])               \
+            )                                                               \
+        /***/
+
+    struct static_calc_rules
+    {
+        static_calc_rules()
+          : primary(qi::make_static_rule<int_rule>(PRIMARY_DEF))
+          , term(qi::make_static_rule<int_rule>(TERM_DEF))
+        {
+            // the unary operators recurse into factor, so this is split
+            // into a static primary and an erased factor
+            factor =
+                primary                         [_val = _1]
+                |   ('-' >> factor              [_val = -_1])
+                |   ('+' >> factor              [_val = _1])
+                ;
+
+            expression =
+                term                            [_val = _1]
+                >> *(   ('+' >> term            [_val += _1])
+                    |   ('-' >> term            [_val -= _1])
+                    )
+                ;
+        }
+
+        int_rule expression, factor;
+
+        boost::spirit::result_of::static_rule<
+            int_rule, BOOST_TYPEOF(PRIMARY_DEF)>::type primary;
+        boost::spirit::result_of::static_rule<
+            int_rule, BOOST_TYPEOF(TERM_DEF)>::type term;
+    };
+
+#undef PRIMARY_DEF
+#undef TERM_DEF
+
+    ///////////////////////////////////////////////////////////////////////////
+    char const* volatile employee_input =
+        "employee{38, \"Doe\", \"John\", 12345.67}";
+    char const* volatile calc_input =
+        "(1 + 2) * (3 - 4) / 5 + ((6 * 7) - (8 / (9 + 10))) * -11 + 12";
+
+    employee_rules const* employee_grammar;
+    static_employee_rules const* static_employee_grammar;
+    calc_rules const* calc_grammar;
+    static_calc_rules const* static_calc_grammar;
+
+    template <typename Rule>
+    int parse_employee(Rule const& r)
+    {
+        client::employee emp = client::employee();
+        iterator_type first = employee_input;
+        iterator_type last = first + std::strlen(first);
+        if (!qi::phrase_parse(first, last, r, space, emp))
+            return 0;
+        return emp.age + int(emp.surname.size());
+    }
+
+    template <typename Rule>
+    int parse_calc(Rule const& r)
+    {
+        int result = 0;
+        iterator_type first = calc_input;
+        iterator_type last = first + std::strlen(first);
+        qi::phrase_parse(first, last, r, space, result);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct employee_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_employee(employee_grammar->start);
+        }
+    };
+
+    struct employee_static_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_employee(static_employee_grammar->start);
+        }
+    };
+
+    struct calc_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_calc(calc_grammar->expression);
+        }
+    };
+
+    struct calc_static_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_calc(static_calc_grammar->expression);
+        }
+    };
+}
+
+int main()
+{
+    employee_rules g1;
+    static_employee_rules g2;
+    calc_rules g3;
+    static_calc_rules g4;
+
+    employee_grammar = &g1;
+    static_employee_grammar = &g2;
+    calc_grammar = &g3;
+    static_calc_grammar = &g4;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        100,        // This is the maximum repetitions to execute
+        (employee_rule_test)
+        (employee_static_rule_test)
+        (calc_rule_test)
+        (calc_static_rule_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
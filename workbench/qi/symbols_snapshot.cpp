@@ -0,0 +1,155 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Scaling of a symbols lookup shared by 1, 2, 4 and 8 threads, every
+//  thread parsing the same list of 200 keywords a couple of times:
+//
+//  - tst:          the default symbols (safe only as long as nobody
+//                  modifies it while others parse),
+//  - mutex:        the default symbols, parses serialized by a mutex (what
+//                  it takes to modify it while others parse),
+//  - tst_snapshot: symbols which may be modified while others parse.
+//
+//  The throughput is reported in million lookups per second, and the
+//  scaling efficiency relative to a single thread (100% means linear).
+//  The numbers are only meaningful on a machine with at least 8 cores.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/home/qi/string/tst_snapshot.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/bind/bind.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+
+namespace
+{
+    int const keywords = 200;
+    int const repeats = 2000;
+
+    typedef qi::symbols<char, int> tst_symbols;
+    typedef qi::symbols<char, int, qi::tst_snapshot<char, int> >
+        snapshot_symbols;
+
+    std::string keyword(int i)
+    {
+        char buffer[32];
+        std::sprintf(buffer, "keyword_%d_%c%c", i, 'a' + i % 26, 'a' + i % 7);
+        return buffer;
+    }
+
+    template <typename Symbols>
+    void fill(Symbols& sym)
+    {
+        for (int i = 0; i != keywords; ++i)
+            sym.add(keyword(i), i);
+    }
+
+    // no locking at all
+    struct no_lock
+    {
+        struct scoped_lock
+        {
+            explicit scoped_lock(no_lock&) {}
+        };
+    };
+
+    template <typename Symbols, typename Mutex>
+    void worker(Symbols const& sym, Mutex& mutex, long& result)
+    {
+        std::vector<std::string> input;
+        for (int i = 0; i != keywords; ++i)
+            input.push_back(keyword(i));
+
+        long sum = 0;
+        for (int r = 0; r != repeats; ++r)
+        {
+            for (int i = 0; i != keywords; ++i)
+            {
+                std::string::const_iterator first = input[i].begin();
+                std::string::const_iterator const last = input[i].end();
+                int value = 0;
+
+                typename Mutex::scoped_lock lock(mutex);
+                if (qi::parse(first, last, sym, value))
+                    sum += value;
+            }
+        }
+        result = sum;
+    }
+
+    long live_code = 0;
+
+    template <typename Symbols, typename Mutex>
+    double run(Symbols const& sym, int threads)
+    {
+        Mutex mutex;
+        std::vector<long> results(threads);
+
+        util::high_resolution_timer time;
+        boost::thread_group group;
+        for (int i = 0; i != threads; ++i)
+        {
+            group.create_thread(boost::bind(worker<Symbols, Mutex>
+              , boost::cref(sym), boost::ref(mutex), boost::ref(results[i])));
+        }
+        group.join_all();
+        double const elapsed = time.elapsed();
+
+        for (int i = 0; i != threads; ++i)
+            live_code += results[i];
+
+        // million lookups per second
+        return double(threads) * repeats * keywords / elapsed / 1e6;
+    }
+
+    template <typename Symbols, typename Mutex>
+    void report(char const* name, Symbols const& sym)
+    {
+        double single = 0;
+        for (int threads = 1; threads <= 8; threads *= 2)
+        {
+            double const throughput = run<Symbols, Mutex>(sym, threads);
+            if (threads == 1)
+                single = throughput;
+
+            std::cout.precision(2);
+            std::cout << name << ": ";
+            for (int i = 0; i < (14-int(std::strlen(name))); ++i)
+                std::cout << ' ';
+            std::cout << threads << " threads: " << std::fixed << throughput
+                << " [M lookups/s], efficiency: " << std::fixed
+                << 100. * throughput / (single * threads) << " [%]"
+                << std::endl;
+        }
+    }
+}
+
+int main()
+{
+    tst_symbols tst;
+    fill(tst);
+    snapshot_symbols snapshot;
+    fill(snapshot);
+
+    report<tst_symbols, no_lock>("tst", tst);
+    report<tst_symbols, boost::mutex>("mutex", tst);
+    report<snapshot_symbols, no_lock>("tst_snapshot", snapshot);
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.
+    return live_code != 0;
+}
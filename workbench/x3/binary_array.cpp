@@ -0,0 +1,118 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Decoding an array of big endian floats (a telemetry frame): the Qi
+//  element by element loop (*big_bin_float), the Qi bulk path
+//  (repeat(n)[big_bin_float]), the X3 element by element fallback
+//  (binary_array over a non contiguous iterator) and the X3 bulk path
+//  (binary_array(n)[big_bin_float]).
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include <boost/spirit/include/qi_binary.hpp>
+#include <boost/spirit/include/qi_repeat.hpp>
+#include <boost/spirit/include/qi_kleene.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+#include <boost/spirit/home/x3.hpp>
+
+#include <cstring>
+#include <deque>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    std::size_t const count = 1024;
+
+    std::vector<char> frame;
+    std::deque<char> frame_deque;
+    char const* volatile first;
+    char const* volatile last;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct qi_kleene_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<float> v;
+            v.reserve(count);
+            char const* f = first;
+            qi::parse(f, (char const*)last, *qi::big_bin_float, v);
+            this->val += v.size();
+        }
+    };
+
+    struct qi_repeat_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<float> v;
+            char const* f = first;
+            qi::parse(f, (char const*)last, qi::repeat(count)[qi::big_bin_float], v);
+            this->val += v.size();
+        }
+    };
+
+    struct x3_element_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<float> v;
+            v.reserve(count);
+            std::deque<char>::const_iterator f = frame_deque.begin();
+            x3::parse(f, frame_deque.cend(), x3::binary_array(count)[x3::big_bin_float], v);
+            this->val += v.size();
+        }
+    };
+
+    struct x3_bulk_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<float> v;
+            char const* f = first;
+            x3::parse(f, (char const*)last, x3::binary_array(count)[x3::big_bin_float], v);
+            this->val += v.size();
+        }
+    };
+}
+
+int main()
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        float const value = i * 0.25f;
+        unsigned char bytes[sizeof(float)];
+        std::memcpy(bytes, &value, sizeof(float));
+#if BOOST_ENDIAN_LITTLE_BYTE
+        for (int j = sizeof(float) - 1; j >= 0; --j)
+#else
+        for (int j = 0; j != sizeof(float); ++j)
+#endif
+            frame.push_back(char(bytes[j]));
+    }
+    frame_deque.assign(frame.begin(), frame.end());
+
+    first = &frame[0];
+    last = first + frame.size();
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10,         // This is the maximum repetitions to execute
+        (qi_kleene_test)
+        (qi_repeat_test)
+        (x3_element_test)
+        (x3_bulk_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
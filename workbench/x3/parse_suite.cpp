@@ -0,0 +1,467 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  The x3 benchmark suite: numerics, symbols, alternatives, skipper heavy
+//  input, AST building and error handling. For each benchmark it reports
+//  the time per input byte, the throughput and the number of heap
+//  allocations per parse.
+//
+//      parse_suite             human readable table
+//      parse_suite --csv       one comma separated line per benchmark,
+//                              for tracking regressions over commits
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include "../allocation_counter.hpp"
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/ast/variant.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace x3 = boost::spirit::x3;
+
+///////////////////////////////////////////////////////////////////////////////
+//  The AST of the calc5 example (example/x3/calc5.cpp)
+///////////////////////////////////////////////////////////////////////////////
+namespace client { namespace ast
+{
+    struct nil {};
+    struct signed_;
+    struct program;
+
+    struct operand : x3::variant<
+            nil
+          , unsigned int
+          , x3::forward_ast<signed_>
+          , x3::forward_ast<program>
+        >
+    {
+        using base_type::base_type;
+        using base_type::operator=;
+    };
+
+    struct signed_
+    {
+        char sign;
+        operand operand_;
+    };
+
+    struct operation
+    {
+        char operator_;
+        operand operand_;
+    };
+
+    struct program
+    {
+        operand first;
+        std::list<operation> rest;
+    };
+}}
+
+BOOST_FUSION_ADAPT_STRUCT(
+    client::ast::signed_,
+    (char, sign)
+    (client::ast::operand, operand_)
+)
+
+BOOST_FUSION_ADAPT_STRUCT(
+    client::ast::operation,
+    (char, operator_)
+    (client::ast::operand, operand_)
+)
+
+BOOST_FUSION_ADAPT_STRUCT(
+    client::ast::program,
+    (client::ast::operand, first)
+    (std::list<client::ast::operation>, rest)
+)
+
+namespace client
+{
+    namespace calculator_grammar
+    {
+        using x3::uint_;
+        using x3::char_;
+
+        struct expression_class;
+        struct term_class;
+        struct factor_class;
+
+        x3::rule<expression_class, ast::program> const expression("expression");
+        x3::rule<term_class, ast::program> const term("term");
+        x3::rule<factor_class, ast::operand> const factor("factor");
+
+        auto const expression_def =
+            term
+            >> *(   (char_('+') > term)
+                |   (char_('-') > term)
+                )
+            ;
+
+        auto const term_def =
+            factor
+            >> *(   (char_('*') > factor)
+                |   (char_('/') > factor)
+                )
+            ;
+
+        auto const factor_def =
+                uint_
+            |   '(' > expression > ')'
+            |   (char_('-') > factor)
+            |   (char_('+') > factor)
+            ;
+
+        BOOST_SPIRIT_DEFINE(
+            expression = expression_def
+          , term = term_def
+          , factor = factor_def
+        );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A statement grammar whose error handler swallows the expectation
+    //  failures, so that every erroneous statement costs a throw and catch
+    ///////////////////////////////////////////////////////////////////////////
+    namespace statement_grammar
+    {
+        using x3::int_;
+        using x3::lit;
+        using x3::lexeme;
+        using x3::ascii::alpha;
+        using x3::ascii::alnum;
+
+        struct statement_class;
+
+        x3::rule<statement_class> const statement("statement");
+
+        auto const statement_def =
+            lexeme[alpha >> *alnum] > '=' > int_ > ';';
+
+        BOOST_SPIRIT_DEFINE(statement = statement_def);
+
+        struct statement_class
+        {
+            template <typename Iterator, typename Exception, typename Context>
+            x3::error_handler_result
+            on_error(Iterator&, Iterator const&, Exception const&, Context const&)
+            {
+                return x3::error_handler_result::fail;
+            }
+        };
+    }
+}
+
+namespace
+{
+    using x3::ascii::space;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The inputs. These are accessed through volatile pointers, so that the
+    //  compiler can not hoist the parse out of the benchmark loop.
+    ///////////////////////////////////////////////////////////////////////////
+    struct input_data
+    {
+        std::string text;
+        char const* volatile first;
+        char const* volatile last;
+
+        void set(std::string const& s)
+        {
+            text = s;
+            first = text.data();
+            last = text.data() + text.size();
+        }
+    };
+
+    input_data int_input;
+    input_data double_input;
+    input_data symbols_input;
+    input_data alternative_input;
+    input_data skipper_input;
+    input_data ast_input;
+    input_data error_input;
+
+    char const* keywords[] =
+    {
+        "alignas", "alignof", "and", "asm", "auto", "bitand", "bitor", "bool",
+        "break", "case", "catch", "char", "class", "compl", "const",
+        "constexpr", "continue", "decltype", "default", "delete", "do",
+        "double", "else", "enum", "explicit", "export", "extern", "false",
+        "float", "for", "friend", "goto", "if", "inline", "int", "long",
+        "mutable", "namespace", "new", "noexcept", "not", "nullptr",
+        "operator", "or", "private", "protected", "public", "register",
+        "return", "short", "signed", "sizeof", "static", "struct", "switch",
+        "template", "this", "throw", "true", "try", "typedef", "typename",
+        "union", "unsigned", "using", "virtual", "void", "volatile", "while"
+    };
+    std::size_t const num_keywords = sizeof(keywords) / sizeof(keywords[0]);
+
+    x3::symbols<char, int> keyword_symbols;
+
+    void make_inputs()
+    {
+        std::string s;
+
+        for (int i = 0; i < 200; ++i)
+            s += std::to_string((i * 7919) % 100000 - 50000) + ',';
+        s += "0";
+        int_input.set(s);
+
+        s.clear();
+        for (int i = 0; i < 200; ++i)
+            s += std::to_string((i * 7919) % 1000 / 7.0) + "e-3,";
+        s += "0.0";
+        double_input.set(s);
+
+        s.clear();
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            s += keywords[(i * 31) % num_keywords];
+            s += ' ';
+        }
+        symbols_input.set(s);
+
+        s.clear();
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            s += keywords[(i * 31) % 16];
+            s += ' ';
+        }
+        alternative_input.set(s);
+
+        s.clear();
+        for (int i = 0; i < 50; ++i)
+        {
+            s += "  /* a block\n     comment */ ";
+            s += std::to_string(i);
+            s += " ;  // a line comment\n\t\t\n";
+        }
+        skipper_input.set(s);
+
+        s.clear();
+        for (int i = 0; i < 20; ++i)
+            s += "(1 + 2 * -3) / (4 - +5) * ";
+        s += "42";
+        ast_input.set(s);
+
+        s.clear();
+        for (int i = 0; i < 20; ++i)
+            s += (i % 2) ? "count = ;" : "total 42;";
+        error_input.set(s);
+
+        for (std::size_t i = 0; i < num_keywords; ++i)
+            keyword_symbols.add(keywords[i], int(i));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The benchmarks
+    ///////////////////////////////////////////////////////////////////////////
+    struct int_list : test::base
+    {
+        static input_data& input() { return int_input; }
+
+        void benchmark()
+        {
+            std::vector<int> v;
+            char const* f = input().first;
+            x3::parse(f, input().last, x3::int_ % ',', v);
+            this->val += v.size() + v.back();
+        }
+    };
+
+    struct double_list : test::base
+    {
+        static input_data& input() { return double_input; }
+
+        void benchmark()
+        {
+            std::vector<double> v;
+            char const* f = input().first;
+            x3::parse(f, input().last, x3::double_ % ',', v);
+            this->val += v.size();
+        }
+    };
+
+    struct symbols : test::base
+    {
+        static input_data& input() { return symbols_input; }
+
+        void benchmark()
+        {
+            std::vector<int> v;
+            char const* f = input().first;
+            x3::phrase_parse(f, input().last, *keyword_symbols, space, v);
+            this->val += v.size() + v.back();
+        }
+    };
+
+    struct alternatives : test::base
+    {
+        static input_data& input() { return alternative_input; }
+
+        void benchmark()
+        {
+            using x3::lit;
+            char const* first = input().first;
+            char const* f = first;
+            x3::phrase_parse(f, input().last,
+                *(  lit("alignas") | "alignof" | "and" | "asm"
+                  | "auto" | "bitand" | "bitor" | "bool"
+                  | "break" | "case" | "catch" | "char"
+                  | "class" | "compl" | "constexpr" | "const")
+              , space);
+            this->val += f - first;
+        }
+    };
+
+    struct skipper : test::base
+    {
+        static input_data& input() { return skipper_input; }
+
+        void benchmark()
+        {
+            using x3::lit;
+            using x3::eol;
+            using x3::ascii::char_;
+
+            auto const comment_skipper =
+                    space
+                |   "/*" >> *(char_ - "*/") >> "*/"
+                |   "//" >> *(char_ - eol) >> eol
+                ;
+
+            char const* first = input().first;
+            char const* f = first;
+            x3::phrase_parse(f, input().last
+              , *(x3::int_ >> ';'), comment_skipper);
+            this->val += f - first;
+        }
+    };
+
+    struct ast : test::base
+    {
+        static input_data& input() { return ast_input; }
+
+        void benchmark()
+        {
+            client::ast::program program;
+            char const* first = input().first;
+            char const* f = first;
+            x3::phrase_parse(f, input().last
+              , client::calculator_grammar::expression, space, program);
+            this->val += f - first;
+        }
+    };
+
+    struct error_handling : test::base
+    {
+        static input_data& input() { return error_input; }
+
+        void benchmark()
+        {
+            char const* f = input().first;
+            char const* const l = input().last;
+            while (f != l)
+            {
+                if (!x3::phrase_parse(f, l
+                  , client::statement_grammar::statement, space))
+                {
+                    // resynchronize after the next ';'
+                    while (f != l && *f++ != ';')
+                        ;
+                    ++this->val;
+                }
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Measuring and reporting
+    ///////////////////////////////////////////////////////////////////////////
+    bool csv = false;
+
+    template <typename Benchmark>
+    void run(char const* name)
+    {
+        std::size_t const bytes = Benchmark::input().text.size();
+
+        // allocations of a single parse
+        std::size_t allocations = test::allocations;
+        Benchmark b;
+        b.benchmark();
+        allocations = test::allocations - allocations;
+
+        // find a repeat count that takes long enough to be measured
+        long repeats = 1;
+        double seconds = test::measure<Benchmark>(repeats);
+        while (seconds < 0.5 && repeats < 100000)
+        {
+            repeats *= 10;
+            seconds = test::measure<Benchmark>(repeats);
+        }
+
+        double const parses = double(repeats) * test::number_of_accumulators;
+        double const ns_per_byte = seconds * 1e9 / (parses * bytes);
+        double const mb_per_second = (parses * bytes) / seconds / 1e6;
+
+        if (csv)
+        {
+            std::printf("%s,%lu,%.4f,%.2f,%lu,%d\n"
+              , name, (unsigned long)bytes, ns_per_byte, mb_per_second
+              , (unsigned long)allocations, b.val);
+        }
+        else
+        {
+            std::printf("%-16s %8lu %12.4f %10.2f %14lu\n"
+              , name, (unsigned long)bytes, ns_per_byte, mb_per_second
+              , (unsigned long)allocations);
+        }
+    }
+}
+
+#define BOOST_SPIRIT_X3_SUITE_RUN(r, data, elem)                    \
+    run<elem>(BOOST_PP_STRINGIZE(elem));                            \
+    /***/
+
+int main(int argc, char* argv[])
+{
+    csv = (argc > 1 && std::strcmp(argv[1], "--csv") == 0);
+    make_inputs();
+
+    if (csv)
+    {
+        std::printf("benchmark,bytes,ns_per_byte,mb_per_s,allocations_per_parse,checksum\n");
+    }
+    else
+    {
+        std::printf("%-16s %8s %12s %10s %14s\n"
+          , "benchmark", "bytes", "ns/byte", "MB/s", "allocs/parse");
+    }
+
+    BOOST_PP_SEQ_FOR_EACH(BOOST_SPIRIT_X3_SUITE_RUN, _,
+        (int_list)
+        (double_list)
+        (symbols)
+        (alternatives)
+        (skipper)
+        (ast)
+        (error_handling)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,133 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Parses identifier-heavy input into a vector of identifiers, using
+//  std::string and an inline capacity container (small_vector) as the
+//  identifier attribute, and std::string with the vector pre-sized by
+//  reserve_hint. Prints the number of heap allocations per identifier,
+//  then the timings.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include "../allocation_counter.hpp"
+#include <boost/spirit/home/x3.hpp>
+#include <boost/container/small_vector.hpp>
+#include <string>
+#include <vector>
+
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    std::string input;
+    std::size_t identifiers = 0;
+
+    // volatile, so that the compiler can not hoist the parse out of the
+    // benchmark loop
+    char const* volatile input_first;
+    char const* volatile input_last;
+
+    using x3::ascii::alpha;
+    using x3::ascii::alnum;
+    using x3::ascii::space;
+    using x3::lexeme;
+    using x3::reserve_hint;
+
+    template <typename Parser, typename Container>
+    int parse_identifiers(Parser const& p, Container& ids)
+    {
+        char const* f = input_first;
+        x3::phrase_parse(f, input_last, p, space, ids);
+        return static_cast<int>(ids.size());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct std_string_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<std::string> ids;
+            this->val += parse_identifiers(*lexeme[(alpha | '_') >> *(alnum | '_')], ids);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct small_vector_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<boost::container::small_vector<char, 32>> ids;
+            this->val += parse_identifiers(*lexeme[(alpha | '_') >> *(alnum | '_')], ids);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct reserve_hint_test : test::base
+    {
+        void benchmark()
+        {
+            std::vector<std::string> ids;
+            this->val += parse_identifiers(
+                reserve_hint(identifiers)[
+                    *lexeme[(alpha | '_') >> *(alnum | '_')]]
+              , ids);
+        }
+    };
+
+    template <typename Test>
+    void report_allocations(char const* name)
+    {
+        Test t;
+        std::size_t const before = test::allocations;
+        t.benchmark();
+        std::size_t const count = test::allocations - before;
+        std::cout << name << ": " << count << " allocations, "
+            << double(count) / identifiers << " per identifier" << std::endl;
+    }
+}
+
+int main()
+{
+    // identifiers of 3 to 28 characters
+    char const* words[] =
+    {
+        "id", "value", "counter", "x", "getElementById", "parse_into_container",
+        "customer_account_balance", "tmp", "HTTPRequestHandlerFactory2", "i"
+    };
+    for (int i = 0; i < 20; ++i)
+    {
+        for (int j = 0; j < 10; ++j)
+        {
+            input += words[j];
+            input += i % 2 ? "x1 " : "yz ";
+            ++identifiers;
+        }
+    }
+    input_first = input.data();
+    input_last = input.data() + input.size();
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << "Input: " << input.size() << " characters, "
+        << identifiers << " identifiers" << std::endl;
+    report_allocations<std_string_test>("std_string_test");
+    report_allocations<small_vector_test>("small_vector_test");
+    report_allocations<reserve_hint_test>("reserve_hint_test");
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10,         // This is the maximum repetitions to execute
+        (std_string_test)
+        (small_vector_test)
+        (reserve_hint_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,329 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Compares the calc9 statement grammar (example/x3/calc9) parsing plain
+//  characters against the same grammar parsing a token vector produced by
+//  a lexertl lexer. Both grammars are pure recognizers (no AST) so that we
+//  measure the cost of matching and backtracking only.
+//
+///////////////////////////////////////////////////////////////////////////////
+#include "../measure.hpp"
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/token/lexertl.hpp>
+#include <string>
+#include <vector>
+
+namespace x3 = boost::spirit::x3;
+namespace lex = boost::spirit::lex;
+
+namespace
+{
+    char const* source =
+        "var a = 123;\n"
+        "var b = 456;\n"
+        "var c = a + b * 2;\n"
+        "var d = (a + b) * (c - 1) / 7;\n"
+        "var flag = !(a < b) && c >= d || false;\n"
+        "var variable = -a + +b * (c == d);\n"
+        "a = a + 1;\n"
+        "b = (b * 2) != (a - 3) && true;\n"
+        ;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The character level calc9 grammar
+    ///////////////////////////////////////////////////////////////////////////
+    namespace char_level
+    {
+        using x3::uint_;
+        using x3::bool_;
+        using x3::lexeme;
+        using x3::lit;
+        using namespace x3::ascii;
+
+        x3::symbols<char> logical_op;
+        x3::symbols<char> equality_op;
+        x3::symbols<char> relational_op;
+        x3::symbols<char> additive_op;
+        x3::symbols<char> multiplicative_op;
+        x3::symbols<char> unary_op;
+        x3::symbols<char> keywords;
+
+        void add_keywords()
+        {
+            logical_op.add("&&")("||");
+            equality_op.add("==")("!=");
+            relational_op.add("<")("<=")(">")(">=");
+            additive_op.add("+")("-");
+            multiplicative_op.add("*")("/");
+            unary_op.add("+")("-")("!");
+            keywords.add("var")("true")("false")("if")("else")("while");
+        }
+
+        x3::rule<class statement_list_class> const statement_list = "statement_list";
+        x3::rule<class variable_declaration_class> const variable_declaration = "variable_declaration";
+        x3::rule<class assignment_class> const assignment = "assignment";
+        x3::rule<class identifier_class> const identifier = "identifier";
+        x3::rule<class expression_class> const expression = "expression";
+        x3::rule<class equality_expr_class> const equality_expr = "equality_expr";
+        x3::rule<class relational_expr_class> const relational_expr = "relational_expr";
+        x3::rule<class additive_expr_class> const additive_expr = "additive_expr";
+        x3::rule<class multiplicative_expr_class> const multiplicative_expr = "multiplicative_expr";
+        x3::rule<class unary_expr_class> const unary_expr = "unary_expr";
+        x3::rule<class primary_expr_class> const primary_expr = "primary_expr";
+
+        auto const statement_list_def =
+            +(variable_declaration | assignment);
+
+        auto const variable_declaration_def =
+            lexeme["var" >> !(alnum | '_')] > assignment;
+
+        auto const assignment_def =
+            identifier > '=' > expression > ';';
+
+        auto const identifier_def =
+            lexeme[(alpha | '_') >> *(alnum | '_')];
+
+        auto const expression_def =
+            equality_expr >> *(logical_op > equality_expr);
+
+        auto const equality_expr_def =
+            relational_expr >> *(equality_op > relational_expr);
+
+        auto const relational_expr_def =
+            additive_expr >> *(relational_op > additive_expr);
+
+        auto const additive_expr_def =
+            multiplicative_expr >> *(additive_op > multiplicative_expr);
+
+        auto const multiplicative_expr_def =
+            unary_expr >> *(multiplicative_op > unary_expr);
+
+        auto const unary_expr_def =
+            primary_expr | (unary_op > primary_expr);
+
+        auto const primary_expr_def =
+                uint_
+            |   bool_
+            |   (!keywords >> identifier)
+            |   '(' > expression > ')'
+            ;
+
+        BOOST_SPIRIT_DEFINE(
+            statement_list = statement_list_def
+          , variable_declaration = variable_declaration_def
+          , assignment = assignment_def
+          , identifier = identifier_def
+          , expression = expression_def
+          , equality_expr = equality_expr_def
+          , relational_expr = relational_expr_def
+          , additive_expr = additive_expr_def
+          , multiplicative_expr = multiplicative_expr_def
+          , unary_expr = unary_expr_def
+          , primary_expr = primary_expr_def
+        );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The token level calc9 grammar
+    ///////////////////////////////////////////////////////////////////////////
+    namespace token_level
+    {
+        enum token_ids
+        {
+            ID_VAR = 1000,
+            ID_TRUE,
+            ID_FALSE,
+            ID_IF,
+            ID_ELSE,
+            ID_WHILE,
+            ID_IDENTIFIER,
+            ID_UINT,
+            ID_AND,
+            ID_OR,
+            ID_EQUAL,
+            ID_NOT_EQUAL,
+            ID_LESS_EQUAL,
+            ID_GREATER_EQUAL,
+            ID_WS
+        };
+
+        template <typename Lexer>
+        struct calc_tokens : lex::lexer<Lexer>
+        {
+            calc_tokens()
+            {
+                this->self.add
+                    ("var", ID_VAR)
+                    ("true", ID_TRUE)
+                    ("false", ID_FALSE)
+                    ("if", ID_IF)
+                    ("else", ID_ELSE)
+                    ("while", ID_WHILE)
+                    ("[a-zA-Z_][a-zA-Z_0-9]*", ID_IDENTIFIER)
+                    ("[0-9]+", ID_UINT)
+                    ("&&", ID_AND)
+                    ("\\|\\|", ID_OR)
+                    ("==", ID_EQUAL)
+                    ("!=", ID_NOT_EQUAL)
+                    ("<=", ID_LESS_EQUAL)
+                    (">=", ID_GREATER_EQUAL)
+                    ("[ \\t\\n]+", ID_WS)
+                    ('<')('>')('+')('-')('*')('/')('!')
+                    ('(')(')')('=')(';')
+                ;
+            }
+        };
+
+        typedef lex::lexertl::token<char const*, lex::omit> token_type;
+        typedef lex::lexertl::lexer<token_type> lexer_type;
+        typedef std::vector<token_type>::const_iterator iterator_type;
+
+        using x3::token;
+
+        x3::rule<class statement_list_class> const statement_list = "statement_list";
+        x3::rule<class variable_declaration_class> const variable_declaration = "variable_declaration";
+        x3::rule<class assignment_class> const assignment = "assignment";
+        x3::rule<class expression_class> const expression = "expression";
+        x3::rule<class equality_expr_class> const equality_expr = "equality_expr";
+        x3::rule<class relational_expr_class> const relational_expr = "relational_expr";
+        x3::rule<class additive_expr_class> const additive_expr = "additive_expr";
+        x3::rule<class multiplicative_expr_class> const multiplicative_expr = "multiplicative_expr";
+        x3::rule<class unary_expr_class> const unary_expr = "unary_expr";
+        x3::rule<class primary_expr_class> const primary_expr = "primary_expr";
+
+        auto const logical_op = token(ID_AND) | token(ID_OR);
+        auto const equality_op = token(ID_EQUAL) | token(ID_NOT_EQUAL);
+        auto const relational_op =
+            token('<') | token(ID_LESS_EQUAL) | token('>') | token(ID_GREATER_EQUAL);
+        auto const additive_op = token('+') | token('-');
+        auto const multiplicative_op = token('*') | token('/');
+        auto const unary_op = token('+') | token('-') | token('!');
+
+        auto const statement_list_def =
+            +(variable_declaration | assignment);
+
+        auto const variable_declaration_def =
+            token(ID_VAR) > assignment;
+
+        auto const assignment_def =
+            token(ID_IDENTIFIER) > token('=') > expression > token(';');
+
+        auto const expression_def =
+            equality_expr >> *(logical_op > equality_expr);
+
+        auto const equality_expr_def =
+            relational_expr >> *(equality_op > relational_expr);
+
+        auto const relational_expr_def =
+            additive_expr >> *(relational_op > additive_expr);
+
+        auto const additive_expr_def =
+            multiplicative_expr >> *(additive_op > multiplicative_expr);
+
+        auto const multiplicative_expr_def =
+            unary_expr >> *(multiplicative_op > unary_expr);
+
+        auto const unary_expr_def =
+            primary_expr | (unary_op > primary_expr);
+
+        auto const primary_expr_def =
+                token(ID_UINT)
+            |   token(ID_TRUE)
+            |   token(ID_FALSE)
+            |   token(ID_IDENTIFIER)
+            |   token('(') > expression > token(')')
+            ;
+
+        BOOST_SPIRIT_DEFINE(
+            statement_list = statement_list_def
+          , variable_declaration = variable_declaration_def
+          , assignment = assignment_def
+          , expression = expression_def
+          , equality_expr = equality_expr_def
+          , relational_expr = relational_expr_def
+          , additive_expr = additive_expr_def
+          , multiplicative_expr = multiplicative_expr_def
+          , unary_expr = unary_expr_def
+          , primary_expr = primary_expr_def
+        );
+
+        calc_tokens<lexer_type> lexer;
+        std::vector<token_type> tokens;
+    }
+
+    char const* first;
+    char const* last;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct char_level_test : test::base
+    {
+        void benchmark()
+        {
+            char const* f = first;
+            this->val += x3::phrase_parse(
+                f, last, char_level::statement_list, x3::ascii::space);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct token_level_test : test::base
+    {
+        void benchmark()
+        {
+            using namespace token_level;
+            iterator_type f = tokens.begin();
+            this->val += x3::phrase_parse(
+                f, iterator_type(tokens.end()), statement_list, token(ID_WS));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tokenize_and_parse_test : test::base
+    {
+        void benchmark()
+        {
+            using namespace token_level;
+            std::vector<token_type> tokens;
+            char const* f = first;
+            x3::tokenize_into(f, last, lexer, tokens);
+
+            iterator_type tf = tokens.begin();
+            this->val += x3::phrase_parse(
+                tf, iterator_type(tokens.end()), statement_list, token(ID_WS));
+        }
+    };
+}
+
+int main()
+{
+    char_level::add_keywords();
+
+    first = source;
+    last = first + std::strlen(first);
+
+    char const* f = first;
+    x3::tokenize_into(f, last, token_level::lexer, token_level::tokens);
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << "Input: " << (last - first) << " characters, "
+        << token_level::tokens.size() << " tokens" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        100,        // This is the maximum repetitions to execute
+        (char_level_test)
+        (token_level_test)
+        (tokenize_and_parse_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
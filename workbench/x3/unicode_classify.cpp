@@ -0,0 +1,107 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Measures the throughput of the x3 unicode char classes (which go
+//  through the ucd property tables for everything but ASCII) on mixed
+//  script text.
+//
+///////////////////////////////////////////////////////////////////////////////
+#define BOOST_SPIRIT_X3_UNICODE
+
+#include "../measure.hpp"
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/utility/utf8_iterator.hpp>
+#include <string>
+
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    x3::ucs4_string input;
+
+    // volatile, so that the compiler can not hoist the parse out of the
+    // benchmark loop
+    x3::ucs4_char const* volatile input_first;
+    x3::ucs4_char const* volatile input_last;
+
+    template <typename Parser>
+    int consumed(Parser const& p)
+    {
+        x3::ucs4_char const* first = input_first;
+        x3::ucs4_char const* f = first;
+        x3::parse(f, input_last, p);
+        return static_cast<int>(f - first);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct alpha_test : test::base
+    {
+        void benchmark()
+        {
+            using x3::unicode::alpha;
+            this->val += consumed(*(+alpha | +~alpha));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct lower_test : test::base
+    {
+        void benchmark()
+        {
+            using x3::unicode::lower;
+            this->val += consumed(*(+lower | +~lower));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct letter_test : test::base
+    {
+        void benchmark()
+        {
+            using x3::unicode::letter;
+            this->val += consumed(*(+letter | +~letter));
+        }
+    };
+}
+
+int main()
+{
+    char const* text =
+        "Der Fu\xC3\x9F\x62\x61ll \xC3\xBC\x62\x65r die Stra\xC3\x9F\x65. "
+        "\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 "
+        "\xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5! "
+        "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+        "\xD0\xBC\xD0\xB8\xD1\x80, "
+        "\xE4\xBD\xA0\xE5\xA5\xBD\xE4\xB8\x96\xE7\x95\x8C "
+        "\xE3\x81\x93\xE3\x82\x93\xE3\x81\xAB\xE3\x81\xA1\xE3\x81\xAF "
+        "\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7 "
+        "\xE2\x82\xAC 42\n";
+
+    x3::utf8_range r = x3::make_utf8_range(text, text + std::strlen(text));
+    x3::ucs4_string line(r.begin(), r.end());
+    for (int i = 0; i < 16; ++i)
+        input += line;
+    input_first = input.data();
+    input_last = input.data() + input.size();
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << "Input: " << input.size() << " code points" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        100,        // This is the maximum repetitions to execute
+        (alpha_test)
+        (lower_test)
+        (letter_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
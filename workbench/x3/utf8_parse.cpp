@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Splits mostly-ASCII UTF-8 text into words using the x3 unicode char
+//  classes, once through boost's u8_to_u32_iterator and once through the
+//  lightweight x3::utf8_iterator (which expects validated input, so the
+//  validation pass is measured as well).
+//
+///////////////////////////////////////////////////////////////////////////////
+#define BOOST_SPIRIT_X3_UNICODE
+
+#include "../measure.hpp"
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/utility/utf8_iterator.hpp>
+#include <boost/regex/pending/unicode_iterator.hpp>
+#include <string>
+
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    std::string input;
+
+    // volatile, so that the compiler can not hoist the parse out of the
+    // benchmark loop
+    char const* volatile input_first;
+    char const* volatile input_last;
+
+    auto const words =
+        *(+x3::unicode::alpha | +x3::unicode::digit
+            | +x3::unicode::space | +x3::unicode::punct
+            | x3::unicode::char_);
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct u8_to_u32_test : test::base
+    {
+        void benchmark()
+        {
+            typedef boost::u8_to_u32_iterator<char const*> iterator_type;
+            char const* first = input_first;
+            char const* last = input_last;
+            iterator_type f(first, first, last);
+            iterator_type l(last, first, last);
+            x3::parse(f, l, words);
+            this->val += f.base() - first;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct utf8_iterator_test : test::base
+    {
+        void benchmark()
+        {
+            char const* first = input_first;
+            x3::utf8_iterator f(first);
+            x3::parse(f, x3::utf8_iterator(input_last), words);
+            this->val += f.base() - first;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct validate_and_parse_test : test::base
+    {
+        void benchmark()
+        {
+            char const* first = input_first;
+            char const* last = input_last;
+            if (x3::utf8_is_valid(first, last))
+            {
+                x3::utf8_iterator f(first);
+                x3::parse(f, x3::utf8_iterator(last), words);
+                this->val += f.base() - first;
+            }
+        }
+    };
+}
+
+int main()
+{
+    char const* text =
+        "The quick brown fox jumps over the lazy dog, 1234567890 times. "
+        "Der Fu\xC3\x9F\x62\x61ll \xC3\xBC\x62\x65r die Stra\xC3\x9F\x65. "
+        "\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 "
+        "\xE2\x82\xAC 42!\n";
+    for (int i = 0; i < 16; ++i)
+        input += text;
+    input_first = input.data();
+    input_last = input.data() + input.size();
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << "Input: " << input.size() << " bytes" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        100,        // This is the maximum repetitions to execute
+        (u8_to_u32_test)
+        (utf8_iterator_test)
+        (validate_and_parse_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}